@@ -0,0 +1,527 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: analises.c
+ * Descrição: Implementação das estatísticas de circulação
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#include "analises.h"
+#include "filas.h"
+#include "prazos.h"
+#include "visoes.h"
+
+// =============================================================================
+// RANKING POR CONTAGEM (BALDES)
+// =============================================================================
+
+/**
+ * Prepara um ranking vazio
+ */
+bool ranking_iniciar(RankingContagem* ranking) {
+    ranking->baldes = (BaldeRanking*)calloc(CAPACIDADE_INICIAL_RANKING, sizeof(BaldeRanking));
+    ranking->capacidade = CAPACIDADE_INICIAL_RANKING;
+    ranking->maior = 0;
+    ranking->menor = 0;
+    return ranking->baldes != NULL;
+}
+
+/**
+ * Prepara um item fora do ranking
+ */
+void ranking_iniciar_item(ItemRanking* item, void* dono) {
+    item->contagem = 0;
+    item->dono = dono;
+    item->anterior = NULL;
+    item->proximo = NULL;
+}
+
+/**
+ * Garante espaço para uma contagem
+ */
+bool ranking_reservar(RankingContagem* ranking, int contagem) {
+    if (contagem < ranking->capacidade) {
+        return true;
+    }
+
+    int nova_capacidade = ranking->capacidade * 2;
+    while (nova_capacidade <= contagem) {
+        nova_capacidade *= 2;
+    }
+
+    BaldeRanking* baldes = (BaldeRanking*)realloc(ranking->baldes, nova_capacidade * sizeof(BaldeRanking));
+    if (baldes == NULL) {
+        return false;
+    }
+
+    memset(baldes + ranking->capacidade, 0, (nova_capacidade - ranking->capacidade) * sizeof(BaldeRanking));
+    ranking->baldes = baldes;
+    ranking->capacidade = nova_capacidade;
+    return true;
+}
+
+/**
+ * Liga um balde vazio à lista de contagens entre abaixo e acima (0 = ponta)
+ */
+static void ligar_balde(RankingContagem* ranking, int contagem, int abaixo, int acima) {
+    BaldeRanking* balde = &ranking->baldes[contagem];
+    balde->abaixo = abaixo;
+    balde->acima = acima;
+
+    if (abaixo != 0) {
+        ranking->baldes[abaixo].acima = contagem;
+    } else {
+        ranking->menor = contagem;
+    }
+    if (acima != 0) {
+        ranking->baldes[acima].abaixo = contagem;
+    } else {
+        ranking->maior = contagem;
+    }
+}
+
+/**
+ * Tira um item do balde da sua contagem (o balde vazio sai da lista)
+ */
+static void retirar_do_balde(RankingContagem* ranking, ItemRanking* item) {
+    BaldeRanking* balde = &ranking->baldes[item->contagem];
+
+    if (item->anterior != NULL) {
+        item->anterior->proximo = item->proximo;
+    } else {
+        balde->itens = item->proximo;
+    }
+    if (item->proximo != NULL) {
+        item->proximo->anterior = item->anterior;
+    }
+    item->anterior = NULL;
+    item->proximo = NULL;
+
+    if (balde->itens == NULL) {
+        if (balde->abaixo != 0) {
+            ranking->baldes[balde->abaixo].acima = balde->acima;
+        } else {
+            ranking->menor = balde->acima;
+        }
+        if (balde->acima != 0) {
+            ranking->baldes[balde->acima].abaixo = balde->abaixo;
+        } else {
+            ranking->maior = balde->abaixo;
+        }
+    }
+}
+
+/**
+ * Coloca um item no balde de uma contagem já ligada à lista
+ */
+static void colocar_no_balde(RankingContagem* ranking, ItemRanking* item, int contagem) {
+    BaldeRanking* balde = &ranking->baldes[contagem];
+
+    item->contagem = contagem;
+    item->anterior = NULL;
+    item->proximo = balde->itens;
+    if (balde->itens != NULL) {
+        balde->itens->anterior = item;
+    }
+    balde->itens = item;
+}
+
+/**
+ * Soma 1 à contagem de um item
+ */
+void ranking_incrementar(RankingContagem* ranking, ItemRanking* item) {
+    int atual = item->contagem;
+    int nova = atual + 1;
+
+    // O balde novo entra logo acima do atual (ou no fim de baixo, para quem entra)
+    if (ranking->baldes[nova].itens == NULL) {
+        if (atual == 0) {
+            ligar_balde(ranking, nova, 0, ranking->menor);
+        } else {
+            ligar_balde(ranking, nova, atual, ranking->baldes[atual].acima);
+        }
+    }
+
+    if (atual != 0) {
+        retirar_do_balde(ranking, item);
+    }
+    colocar_no_balde(ranking, item, nova);
+}
+
+/**
+ * Subtrai 1 da contagem de um item
+ */
+void ranking_decrementar(RankingContagem* ranking, ItemRanking* item) {
+    int atual = item->contagem;
+    int nova = atual - 1;
+    if (atual <= 0) return;
+
+    // O balde novo entra logo abaixo do atual
+    if (nova > 0 && ranking->baldes[nova].itens == NULL) {
+        ligar_balde(ranking, nova, ranking->baldes[atual].abaixo, atual);
+    }
+
+    retirar_do_balde(ranking, item);
+    if (nova > 0) {
+        colocar_no_balde(ranking, item, nova);
+    } else {
+        item->contagem = 0;
+    }
+}
+
+/**
+ * Copia os donos dos itens de maior contagem
+ */
+int ranking_maiores(const RankingContagem* ranking, void** saida, int max) {
+    int copiados = 0;
+
+    for (int contagem = ranking->maior; contagem != 0 && copiados < max;
+         contagem = ranking->baldes[contagem].abaixo) {
+        for (ItemRanking* item = ranking->baldes[contagem].itens; item != NULL && copiados < max;
+             item = item->proximo) {
+            saida[copiados++] = item->dono;
+        }
+    }
+
+    return copiados;
+}
+
+/**
+ * Libera o vetor de baldes
+ */
+void ranking_liberar(RankingContagem* ranking) {
+    free(ranking->baldes);
+    ranking->baldes = NULL;
+    ranking->capacidade = 0;
+}
+
+// =============================================================================
+// ESBOÇO COUNT-MIN
+// =============================================================================
+
+/**
+ * Coluna de um título em cada linha do esboço (hash duplo: h1 + linha * h2)
+ */
+static void colunas_do_titulo(const char* titulo_busca, unsigned int colunas[PROFUNDIDADE_ESBOCO]) {
+    unsigned int h1 = calcular_hash(titulo_busca);
+
+    // Segundo hash derivado do primeiro (mistura de bits), sempre ímpar
+    unsigned int h2 = h1 * 0x9E3779B1u;
+    h2 ^= h2 >> 15;
+    h2 |= 1u;
+
+    for (int linha = 0; linha < PROFUNDIDADE_ESBOCO; linha++) {
+        colunas[linha] = (h1 + (unsigned int)linha * h2) & (LARGURA_ESBOCO - 1);
+    }
+}
+
+/**
+ * Estimativa de um título já em minúsculas (menor contador entre as linhas)
+ */
+static uint32_t estimar(const AnalisesEmprestimos* analises, const char* titulo_busca) {
+    unsigned int colunas[PROFUNDIDADE_ESBOCO];
+    colunas_do_titulo(titulo_busca, colunas);
+
+    uint32_t menor = analises->esboco[0][colunas[0]];
+    for (int linha = 1; linha < PROFUNDIDADE_ESBOCO; linha++) {
+        if (analises->esboco[linha][colunas[linha]] < menor) {
+            menor = analises->esboco[linha][colunas[linha]];
+        }
+    }
+    return menor;
+}
+
+// =============================================================================
+// HEAP DE MAIS EMPRESTADOS
+// =============================================================================
+
+/**
+ * Troca duas posições do heap
+ */
+static void trocar_frequentes(AnalisesEmprestimos* analises, int i, int j) {
+    TituloFrequente temporario = analises->frequentes[i];
+    analises->frequentes[i] = analises->frequentes[j];
+    analises->frequentes[j] = temporario;
+}
+
+/**
+ * Desce uma posição do heap mínimo até o lugar certo
+ */
+static void descer_frequente(AnalisesEmprestimos* analises, int i) {
+    while (true) {
+        int menor = i;
+        int esquerda = 2 * i + 1;
+        int direita = 2 * i + 2;
+
+        if (esquerda < analises->total_frequentes &&
+            analises->frequentes[esquerda].estimativa < analises->frequentes[menor].estimativa) {
+            menor = esquerda;
+        }
+        if (direita < analises->total_frequentes &&
+            analises->frequentes[direita].estimativa < analises->frequentes[menor].estimativa) {
+            menor = direita;
+        }
+        if (menor == i) {
+            return;
+        }
+
+        trocar_frequentes(analises, i, menor);
+        i = menor;
+    }
+}
+
+/**
+ * Sobe uma posição do heap mínimo até o lugar certo
+ */
+static void subir_frequente(AnalisesEmprestimos* analises, int i) {
+    while (i > 0) {
+        int pai = (i - 1) / 2;
+        if (analises->frequentes[pai].estimativa <= analises->frequentes[i].estimativa) {
+            return;
+        }
+        trocar_frequentes(analises, i, pai);
+        i = pai;
+    }
+}
+
+/**
+ * Compara dois títulos frequentes pela estimativa, maior primeiro (para qsort)
+ */
+static int comparar_frequentes(const void* a, const void* b) {
+    const TituloFrequente* x = (const TituloFrequente*)a;
+    const TituloFrequente* y = (const TituloFrequente*)b;
+    if (x->estimativa != y->estimativa) {
+        return (x->estimativa < y->estimativa) ? 1 : -1;
+    }
+    return strcmp(x->titulo_busca, y->titulo_busca);
+}
+
+// =============================================================================
+// ESTATÍSTICAS DE EMPRÉSTIMOS
+// =============================================================================
+
+/**
+ * Cria as estatísticas vazias
+ */
+AnalisesEmprestimos* criar_analises() {
+    AnalisesEmprestimos* analises = (AnalisesEmprestimos*)calloc(1, sizeof(AnalisesEmprestimos));
+    if (analises == NULL) {
+        return NULL;
+    }
+    return analises;
+}
+
+/**
+ * Registra um empréstimo
+ */
+void analises_registrar_emprestimo(AnalisesEmprestimos* analises, const NoLivro* livro) {
+    if (analises == NULL || livro == NULL) return;
+
+    unsigned int colunas[PROFUNDIDADE_ESBOCO];
+    colunas_do_titulo(livro->titulo_busca, colunas);
+    for (int linha = 0; linha < PROFUNDIDADE_ESBOCO; linha++) {
+        analises->esboco[linha][colunas[linha]]++;
+    }
+    analises->total_emprestimos++;
+
+    uint32_t estimativa = estimar(analises, livro->titulo_busca);
+
+    // Título já acompanhado: só a estimativa muda (e ela só cresce)
+    for (int i = 0; i < analises->total_frequentes; i++) {
+        if (strcmp(analises->frequentes[i].titulo_busca, livro->titulo_busca) == 0) {
+            analises->frequentes[i].estimativa = estimativa;
+            descer_frequente(analises, i);
+            return;
+        }
+    }
+
+    // Entra se há vaga ou se passou o menos emprestado do heap (que sai)
+    int posicao;
+    if (analises->total_frequentes < MAX_MAIS_EMPRESTADOS) {
+        posicao = analises->total_frequentes++;
+    } else if (estimativa > analises->frequentes[0].estimativa) {
+        posicao = 0;
+    } else {
+        return;
+    }
+
+    TituloFrequente* frequente = &analises->frequentes[posicao];
+    strcpy(frequente->titulo, livro->dados.titulo);
+    strcpy(frequente->titulo_busca, livro->titulo_busca);
+    frequente->estimativa = estimativa;
+
+    if (posicao == 0) {
+        descer_frequente(analises, 0);
+    } else {
+        subir_frequente(analises, posicao);
+    }
+}
+
+/**
+ * Registra uma devolução e a duração do empréstimo
+ */
+void analises_registrar_devolucao(AnalisesEmprestimos* analises, NoLivro* livro, time_t duracao) {
+    if (duracao < 0) {
+        duracao = 0;
+    }
+
+    if (livro != NULL) {
+        livro->soma_duracoes += duracao;
+        livro->total_devolucoes++;
+    }
+    if (analises != NULL) {
+        analises->soma_duracoes += duracao;
+        analises->total_devolucoes++;
+    }
+}
+
+/**
+ * Estima quantas vezes um título foi emprestado
+ */
+uint32_t analises_estimar_emprestimos(const AnalisesEmprestimos* analises, const char* titulo) {
+    if (analises == NULL || titulo == NULL) {
+        return 0;
+    }
+
+    char titulo_busca[MAX_TITULO];
+    para_minusculo(titulo_busca, titulo);
+    return estimar(analises, titulo_busca);
+}
+
+/**
+ * Copia os títulos mais emprestados
+ */
+int analises_mais_emprestados(const AnalisesEmprestimos* analises, TituloFrequente* saida, int max) {
+    if (analises == NULL || saida == NULL || max <= 0) {
+        return 0;
+    }
+
+    // O heap tem no máximo MAX_MAIS_EMPRESTADOS títulos: ordená-lo custa O(k log k)
+    TituloFrequente ordenados[MAX_MAIS_EMPRESTADOS];
+    int total = analises->total_frequentes;
+    memcpy(ordenados, analises->frequentes, total * sizeof(TituloFrequente));
+    qsort(ordenados, total, sizeof(TituloFrequente), comparar_frequentes);
+
+    if (max > total) {
+        max = total;
+    }
+    memcpy(saida, ordenados, max * sizeof(TituloFrequente));
+    return max;
+}
+
+/**
+ * Duração média dos empréstimos já devolvidos de um livro
+ */
+double analises_duracao_media(const NoLivro* livro) {
+    if (livro == NULL || livro->total_devolucoes == 0) {
+        return -1;
+    }
+    return (double)livro->soma_duracoes / livro->total_devolucoes;
+}
+
+/**
+ * Escreve uma duração em dias, horas e minutos
+ */
+static void formatar_duracao(double segundos, char* buffer, size_t tamanho) {
+    long total = (long)(segundos + 0.5);
+    long dias = total / SEGUNDOS_POR_DIA;
+    long horas = (total % SEGUNDOS_POR_DIA) / 3600;
+    long minutos = (total % 3600) / 60;
+
+    if (dias > 0) {
+        snprintf(buffer, tamanho, "%ldd %ldh %ldmin", dias, horas, minutos);
+    } else {
+        snprintf(buffer, tamanho, "%ldh %ldmin", horas, minutos);
+    }
+}
+
+/**
+ * Livro do catálogo com um título em minúsculas, pela visão por título: O(log n)
+ */
+static NoLivro* localizar_titulo(ListaLivros* catalogo, const char* titulo_busca) {
+    CursorVisao cursor;
+    NoLivro* livro = NULL;
+
+    visao_cursor_buscar(&cursor, ORDEM_TITULO, titulo_busca, 0);
+    if (visao_proxima_pagina(catalogo->visoes, &cursor, &livro, 1) == 1 &&
+        strcmp(livro->titulo_busca, titulo_busca) == 0) {
+        return livro;
+    }
+    return NULL;
+}
+
+/**
+ * Exibe o relatório de circulação
+ */
+void exibir_relatorio_analises(Biblioteca* bib, int quantidade) {
+    if (bib == NULL || bib->analises == NULL || quantidade <= 0) {
+        return;
+    }
+
+    AnalisesEmprestimos* analises = bib->analises;
+    char duracao_str[40];
+
+    printf("\n=== RELATÓRIO DE CIRCULAÇÃO ===\n");
+    printf("Empréstimos registrados: %lld\n", analises->total_emprestimos);
+    printf("Devoluções registradas: %lld\n", analises->total_devolucoes);
+    if (analises->total_devolucoes > 0) {
+        formatar_duracao((double)analises->soma_duracoes / analises->total_devolucoes,
+                         duracao_str, sizeof(duracao_str));
+        printf("Duração média dos empréstimos: %s\n", duracao_str);
+    }
+
+    // Mais emprestados (estimativas do esboço; a média vem do próprio livro)
+    TituloFrequente frequentes[MAX_MAIS_EMPRESTADOS];
+    int total = analises_mais_emprestados(analises, frequentes,
+                                          quantidade < MAX_MAIS_EMPRESTADOS ? quantidade : MAX_MAIS_EMPRESTADOS);
+
+    printf("\n--- Mais emprestados ---\n");
+    if (total == 0) {
+        printf("Nenhum empréstimo registrado.\n");
+    }
+    for (int i = 0; i < total; i++) {
+        NoLivro* livro = localizar_titulo(bib->catalogo, frequentes[i].titulo_busca);
+        double media = analises_duracao_media(livro);
+
+        printf("[%d] %s - %u empréstimo(s)", i + 1, frequentes[i].titulo, frequentes[i].estimativa);
+        if (media >= 0) {
+            formatar_duracao(media, duracao_str, sizeof(duracao_str));
+            printf(", duração média %s", duracao_str);
+        }
+        if (livro == NULL) {
+            printf(" (removido do catálogo)");
+        }
+        printf("\n");
+    }
+
+    // Mais disputados: os títulos com mais leitores aguardando
+    FilaTitulo** disputados = (FilaTitulo**)malloc(quantidade * sizeof(FilaTitulo*));
+    if (disputados == NULL) {
+        printf("Erro: Falha ao alocar memória!\n");
+        return;
+    }
+
+    total = filas_mais_disputadas(bib->fila_espera->por_titulo, disputados, quantidade);
+
+    printf("\n--- Mais disputados (fila de espera) ---\n");
+    if (total == 0) {
+        printf("Nenhum leitor aguardando.\n");
+    }
+    for (int i = 0; i < total; i++) {
+        NoLivro* livro = localizar_titulo(bib->catalogo, disputados[i]->titulo_busca);
+        printf("[%d] %s - %d leitor(es) aguardando\n", i + 1,
+               livro != NULL ? livro->dados.titulo : disputados[i]->titulo_busca, disputados[i]->total);
+    }
+
+    free(disputados);
+}
+
+/**
+ * Libera as estatísticas
+ */
+void liberar_analises(AnalisesEmprestimos* analises) {
+    free(analises);
+}
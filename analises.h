@@ -0,0 +1,215 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: analises.h
+ * Descrição: Estatísticas de circulação mantidas a cada empréstimo e devolução
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef ANALISES_H
+#define ANALISES_H
+
+#include "biblioteca.h"
+
+// =============================================================================
+// CONSTANTES DAS ANÁLISES
+// =============================================================================
+
+#define LARGURA_ESBOCO 1024         // Contadores por linha do esboço (potência de 2)
+#define PROFUNDIDADE_ESBOCO 4       // Linhas do esboço (funções de hash independentes)
+#define MAX_MAIS_EMPRESTADOS 32     // Títulos acompanhados no ranking de empréstimos
+#define CAPACIDADE_INICIAL_RANKING 8 // Contagens iniciais do ranking por contagem
+
+// =============================================================================
+// RANKING POR CONTAGEM (BALDES)
+// =============================================================================
+
+/**
+ * Item de um ranking por contagem (embutido na estrutura contada)
+ */
+typedef struct ItemRanking {
+    int contagem;                   // Contagem atual (0 = fora do ranking)
+    void* dono;                     // Estrutura que contém o item
+    struct ItemRanking* anterior;   // Item anterior no balde da mesma contagem
+    struct ItemRanking* proximo;    // Próximo item no balde da mesma contagem
+} ItemRanking;
+
+/**
+ * Balde dos itens com uma mesma contagem
+ * Os baldes não vazios formam uma lista da maior contagem para a menor.
+ */
+typedef struct BaldeRanking {
+    ItemRanking* itens;             // Itens com esta contagem
+    int acima;                      // Próxima contagem maior com itens (0 = nenhuma)
+    int abaixo;                     // Próxima contagem menor com itens (0 = nenhuma)
+} BaldeRanking;
+
+/**
+ * Ranking de itens cuja contagem sobe e desce de 1 em 1 (ex.: profundidade da fila)
+ * Os baldes ficam em um vetor indexado pela contagem, então subir ou descer um
+ * item custa O(1), e listar os k maiores custa O(k).
+ */
+typedef struct RankingContagem {
+    BaldeRanking* baldes;           // Balde de cada contagem (posição 0 não é usada)
+    int capacidade;                 // Posições do vetor de baldes
+    int maior;                      // Maior contagem com itens (0 = ranking vazio)
+    int menor;                      // Menor contagem com itens (0 = ranking vazio)
+} RankingContagem;
+
+/**
+ * Prepara um ranking vazio
+ * Parâmetros:
+ *   - ranking: Ranking a ser preparado
+ * Retorna: true se preparado, false se faltou memória
+ */
+bool ranking_iniciar(RankingContagem* ranking);
+
+/**
+ * Prepara um item fora do ranking (contagem 0)
+ * Parâmetros:
+ *   - item: Item a ser preparado
+ *   - dono: Estrutura que contém o item
+ */
+void ranking_iniciar_item(ItemRanking* item, void* dono);
+
+/**
+ * Garante espaço para uma contagem, para que ranking_incrementar() não falhe
+ * Parâmetros:
+ *   - ranking: Ponteiro para o ranking
+ *   - contagem: Maior contagem que será usada
+ * Retorna: true se há espaço, false se faltou memória
+ */
+bool ranking_reservar(RankingContagem* ranking, int contagem);
+
+/**
+ * Soma 1 à contagem de um item (espaço garantido por ranking_reservar())
+ * Parâmetros:
+ *   - ranking: Ponteiro para o ranking
+ *   - item: Item (entra no ranking se estava com contagem 0)
+ */
+void ranking_incrementar(RankingContagem* ranking, ItemRanking* item);
+
+/**
+ * Subtrai 1 da contagem de um item (sai do ranking ao chegar a 0)
+ * Parâmetros:
+ *   - ranking: Ponteiro para o ranking
+ *   - item: Item com contagem maior que 0
+ */
+void ranking_decrementar(RankingContagem* ranking, ItemRanking* item);
+
+/**
+ * Copia os donos dos itens de maior contagem, da maior para a menor
+ * Parâmetros:
+ *   - ranking: Ponteiro para o ranking
+ *   - saida: Vetor que receberá os donos
+ *   - max: Tamanho do vetor
+ * Retorna: Quantidade de donos copiados
+ */
+int ranking_maiores(const RankingContagem* ranking, void** saida, int max);
+
+/**
+ * Libera o vetor de baldes (os itens pertencem aos donos)
+ * Parâmetros:
+ *   - ranking: Ranking a ser liberado
+ */
+void ranking_liberar(RankingContagem* ranking);
+
+// =============================================================================
+// ESTATÍSTICAS DE EMPRÉSTIMOS
+// =============================================================================
+
+/**
+ * Título acompanhado no ranking de mais emprestados
+ */
+typedef struct TituloFrequente {
+    char titulo[MAX_TITULO];        // Título (como cadastrado)
+    char titulo_busca[MAX_TITULO];  // Título em minúsculas
+    uint32_t estimativa;            // Empréstimos estimados pelo esboço
+} TituloFrequente;
+
+/**
+ * Estatísticas de circulação atualizadas a cada empréstimo e devolução
+ * O número de empréstimos de cada título fica em um esboço count-min (memória
+ * fixa, nunca subestima). Os MAX_MAIS_EMPRESTADOS títulos de maior estimativa
+ * ficam em um heap mínimo: um título entra quando sua estimativa passa a do
+ * menor do heap. A duração dos empréstimos é acumulada em cada NoLivro.
+ */
+typedef struct AnalisesEmprestimos {
+    uint32_t esboco[PROFUNDIDADE_ESBOCO][LARGURA_ESBOCO]; // Esboço count-min
+    TituloFrequente frequentes[MAX_MAIS_EMPRESTADOS];     // Heap mínimo pela estimativa
+    int total_frequentes;           // Títulos no heap
+    long long total_emprestimos;    // Empréstimos registrados
+    long long total_devolucoes;     // Devoluções registradas
+    long long soma_duracoes;        // Soma das durações devolvidas (segundos)
+} AnalisesEmprestimos;
+
+/**
+ * Cria as estatísticas vazias
+ * Retorna: Ponteiro para as estatísticas, ou NULL em caso de erro
+ */
+AnalisesEmprestimos* criar_analises();
+
+/**
+ * Registra um empréstimo (esboço e ranking de mais emprestados)
+ * Parâmetros:
+ *   - analises: Ponteiro para as estatísticas
+ *   - livro: Livro emprestado
+ */
+void analises_registrar_emprestimo(AnalisesEmprestimos* analises, const NoLivro* livro);
+
+/**
+ * Registra uma devolução e a duração do empréstimo
+ * Parâmetros:
+ *   - analises: Ponteiro para as estatísticas
+ *   - livro: Livro devolvido (acumula a duração em soma_duracoes/total_devolucoes)
+ *   - duracao: Segundos entre o empréstimo e a devolução
+ */
+void analises_registrar_devolucao(AnalisesEmprestimos* analises, NoLivro* livro, time_t duracao);
+
+/**
+ * Estima quantas vezes um título foi emprestado
+ * Parâmetros:
+ *   - analises: Ponteiro para as estatísticas
+ *   - titulo: Título (qualquer capitalização)
+ * Retorna: Estimativa (nunca menor que o valor real)
+ */
+uint32_t analises_estimar_emprestimos(const AnalisesEmprestimos* analises, const char* titulo);
+
+/**
+ * Copia os títulos mais emprestados, do mais para o menos emprestado
+ * Parâmetros:
+ *   - analises: Ponteiro para as estatísticas
+ *   - saida: Vetor que receberá os títulos
+ *   - max: Tamanho do vetor (no máximo MAX_MAIS_EMPRESTADOS são acompanhados)
+ * Retorna: Quantidade de títulos copiados
+ */
+int analises_mais_emprestados(const AnalisesEmprestimos* analises, TituloFrequente* saida, int max);
+
+/**
+ * Duração média dos empréstimos já devolvidos de um livro
+ * Parâmetros:
+ *   - livro: Livro
+ * Retorna: Média em segundos, ou -1 se nenhum empréstimo foi devolvido
+ */
+double analises_duracao_media(const NoLivro* livro);
+
+/**
+ * Exibe o relatório de circulação: mais emprestados (com a duração média),
+ * títulos mais disputados pela fila de espera e médias gerais
+ * Parâmetros:
+ *   - bib: Ponteiro para a biblioteca
+ *   - quantidade: Títulos em cada ranking
+ */
+void exibir_relatorio_analises(Biblioteca* bib, int quantidade);
+
+/**
+ * Libera as estatísticas
+ * Parâmetros:
+ *   - analises: Ponteiro para as estatísticas
+ */
+void liberar_analises(AnalisesEmprestimos* analises);
+
+#endif // ANALISES_H
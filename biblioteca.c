@@ -10,6 +10,19 @@
  */
 
 #include "biblioteca.h"
+#include "busca.h"
+#include "indices.h"
+#include "leitores.h"
+#include "prazos.h"
+#include "filas.h"
+#include "visoes.h"
+#include "historico.h"
+#include "analises.h"
+#include "varredura.h"
+#include "textos.h"
+#include "saida.h"
+#include "persistencia.h"
+#include <unistd.h>
 
 // =============================================================================
 // FUNÇÕES AUXILIARES
@@ -27,6 +40,18 @@ void para_minusculo(char* dest, const char* src) {
     dest[i] = '\0';
 }
 
+/**
+ * Calcula o hash de uma string (FNV-1a de 32 bits)
+ */
+unsigned int calcular_hash(const char* texto) {
+    unsigned int hash = 2166136261u;
+    while (*texto) {
+        hash ^= (unsigned char)*texto++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
 /**
  * Formata um timestamp para string legível (DD/MM/YYYY HH:MM:SS)
  */
@@ -35,6 +60,58 @@ void formatar_data(time_t timestamp, char* buffer, size_t tamanho) {
     strftime(buffer, tamanho, "%d/%m/%Y %H:%M:%S", info);
 }
 
+/**
+ * Posiciona um cursor de listagem no início
+ */
+void iniciar_cursor(CursorListagem* cursor) {
+    if (cursor == NULL) return;
+
+    cursor->ultimo = NULL;
+    cursor->inicio = 0;
+    cursor->entregues = 0;
+    cursor->anterior = NULL;
+    cursor->proximo = NULL;
+}
+
+/**
+ * Registra um cursor na lista de cursores abertos de uma estrutura
+ */
+static void registrar_cursor(CursorListagem** cursores, CursorListagem* cursor) {
+    iniciar_cursor(cursor);
+    cursor->proximo = *cursores;
+    if (*cursores != NULL) {
+        (*cursores)->anterior = cursor;
+    }
+    *cursores = cursor;
+}
+
+/**
+ * Retira um cursor da lista de cursores abertos
+ */
+static void desregistrar_cursor(CursorListagem** cursores, CursorListagem* cursor) {
+    if (cursor->anterior != NULL) {
+        cursor->anterior->proximo = cursor->proximo;
+    } else if (*cursores == cursor) {
+        *cursores = cursor->proximo;
+    }
+    if (cursor->proximo != NULL) {
+        cursor->proximo->anterior = cursor->anterior;
+    }
+    cursor->anterior = NULL;
+    cursor->proximo = NULL;
+}
+
+/**
+ * Recua para o item anterior os cursores parados em um item que vai ser removido
+ */
+static void recuar_cursores(CursorListagem* cursores, const void* removido, const void* anterior) {
+    for (CursorListagem* cursor = cursores; cursor != NULL; cursor = cursor->proximo) {
+        if (cursor->ultimo == removido) {
+            cursor->ultimo = anterior;
+        }
+    }
+}
+
 /**
  * Limpa o buffer de entrada (stdin) para evitar lixo
  */
@@ -63,14 +140,23 @@ Biblioteca* inicializar_biblioteca() {
     bib->catalogo = criar_lista_livros();
     bib->fila_espera = criar_fila_espera();
     bib->historico = criar_pilha_historico();
+    bib->leitores = criar_cadastro_leitores();
+    bib->analises = criar_analises();
 
     // Verifica se todas as estruturas foram criadas com sucesso
-    if (bib->catalogo == NULL || bib->fila_espera == NULL || bib->historico == NULL) {
+    if (bib->catalogo == NULL || bib->fila_espera == NULL || bib->historico == NULL ||
+        bib->leitores == NULL || bib->analises == NULL) {
         printf("Erro: Falha ao inicializar as estruturas de dados!\n");
         liberar_biblioteca(bib);
         return NULL;
     }
 
+    // As solicitações da fila também ficam registradas no cadastro de cada leitor
+    bib->fila_espera->leitores = bib->leitores;
+
+    // Comparações de texto com a maior largura SIMD do processador (antes de qualquer thread)
+    textos_escolher_implementacao(IMPLEMENTACAO_AUTOMATICA);
+
     return bib;
 }
 
@@ -93,6 +179,14 @@ void liberar_biblioteca(Biblioteca* bib) {
         liberar_pilha_historico(bib->historico);
     }
 
+    if (bib->leitores != NULL) {
+        liberar_cadastro_leitores(bib->leitores);
+    }
+
+    if (bib->analises != NULL) {
+        liberar_analises(bib->analises);
+    }
+
     // Libera a estrutura principal
     free(bib);
 
@@ -114,11 +208,47 @@ ListaLivros* criar_lista_livros() {
     }
 
     lista->cabeca = NULL;
+    lista->cauda = NULL;
     lista->total = 0;
+    lista->cursores = NULL;
+
+    // Cria os índices de busca mantidos a cada inserção/remoção
+    lista->indice_textual = criar_indice_textual();
+    lista->trie_titulos = criar_trie_titulos();
+    lista->filtro_titulos = criar_filtro_bloom();
+    lista->indice_isbn = criar_indice_isbn();
+    lista->prazos = criar_controle_prazos();
+    lista->reservas = criar_roda_reservas(time(NULL));
+    lista->visoes = criar_visoes_ordenadas();
+    lista->paginas = criar_paginas_catalogo();
+    if (lista->indice_textual == NULL || lista->trie_titulos == NULL ||
+        lista->filtro_titulos == NULL || lista->indice_isbn == NULL ||
+        lista->prazos == NULL || lista->reservas == NULL || lista->visoes == NULL ||
+        lista->paginas == NULL) {
+        liberar_indice_textual(lista->indice_textual);
+        liberar_trie_titulos(lista->trie_titulos);
+        liberar_filtro_bloom(lista->filtro_titulos);
+        liberar_indice_isbn(lista->indice_isbn);
+        liberar_controle_prazos(lista->prazos);
+        liberar_roda_reservas(lista->reservas);
+        liberar_visoes_ordenadas(lista->visoes);
+        liberar_paginas_catalogo(lista->paginas);
+        free(lista);
+        return NULL;
+    }
 
     return lista;
 }
 
+/**
+ * Libera um nó do catálogo junto com seus exemplares
+ */
+static void liberar_no_livro(NoLivro* no_livro) {
+    free(no_livro->exemplares);
+    free(no_livro->livres);
+    free(no_livro);
+}
+
 /**
  * Adiciona um novo livro ao final do catálogo
  */
@@ -134,31 +264,131 @@ bool adicionar_livro(ListaLivros* lista, Livro livro) {
         return false;
     }
 
+    // Valida o ISBN (opcional) e verifica se já está cadastrado
+    uint64_t isbn_chave = 0;
+    if (strlen(livro.isbn) > 0) {
+        isbn_chave = normalizar_isbn(livro.isbn);
+        if (isbn_chave == 0) {
+            printf("Erro: ISBN '%s' inválido (informe um ISBN-10 ou ISBN-13)!\n", livro.isbn);
+            return false;
+        }
+        if (indice_isbn_buscar(lista->indice_isbn, isbn_chave) != NULL) {
+            printf("Erro: Já existe um livro com este ISBN no catálogo!\n");
+            return false;
+        }
+    }
+
     // Cria um novo nó
     NoLivro* novo = (NoLivro*)malloc(sizeof(NoLivro));
     if (novo == NULL) {
         printf("Erro: Falha ao alocar memória para o livro!\n");
         return false;
     }
+    novo->exemplares = NULL;
+    novo->livres = NULL;
+
+    // Todo título tem pelo menos um exemplar
+    if (livro.quantidade < 1) {
+        livro.quantidade = 1;
+    }
+
+    novo->exemplares = (Exemplar*)malloc(livro.quantidade * sizeof(Exemplar));
+    novo->livres = (int*)malloc(livro.quantidade * sizeof(int));
+    if (novo->exemplares == NULL || novo->livres == NULL) {
+        printf("Erro: Falha ao alocar memória para os exemplares!\n");
+        liberar_no_livro(novo);
+        return false;
+    }
 
     // Copia os dados do livro
     novo->dados = livro;
+    novo->dados.status = true;
+    para_minusculo(novo->titulo_busca, livro.titulo);
+    novo->total_emprestimos = 0;
+    novo->soma_duracoes = 0;
+    novo->total_devolucoes = 0;
+    novo->isbn_chave = isbn_chave;
+    novo->vaga = -1;
     novo->proximo = NULL;
 
+    // Todos os exemplares começam livres; a pilha é montada de trás para frente
+    // para que o exemplar 1 seja o primeiro a sair
+    for (int i = 0; i < livro.quantidade; i++) {
+        Exemplar* exemplar = &novo->exemplares[i];
+        exemplar->numero = i + 1;
+        exemplar->status = true;
+        strcpy(exemplar->nome_leitor_atual, "");
+        exemplar->data_emprestimo = 0;
+        exemplar->data_devolucao_prevista = 0;
+        strcpy(exemplar->nome_reserva, "");
+        exemplar->fim_reserva = 0;
+        exemplar->livro = novo;
+        exemplar->leitor_atual = NULL;
+        exemplar->anterior_do_leitor = NULL;
+        exemplar->proximo_do_leitor = NULL;
+        exemplar->posicao_prazo = SEM_PRAZO;
+        exemplar->anterior_atrasado = NULL;
+        exemplar->proximo_atrasado = NULL;
+        exemplar->balde_reserva = SEM_RESERVA;
+        exemplar->anterior_reserva = NULL;
+        exemplar->proximo_reserva = NULL;
+
+        novo->livres[i] = livro.quantidade - 1 - i;
+    }
+    novo->total_livres = livro.quantidade;
+    novo->total_separados = 0;
+
+    // Indexa título e autor para a busca por palavras-chave e o título para sugestões
+    if (!indice_textual_adicionar(lista->indice_textual, novo)) {
+        printf("Erro: Falha ao indexar o livro!\n");
+        liberar_no_livro(novo);
+        return false;
+    }
+    if (!trie_titulos_adicionar(lista->trie_titulos, novo)) {
+        printf("Erro: Falha ao indexar o livro!\n");
+        indice_textual_remover(lista->indice_textual, novo);
+        liberar_no_livro(novo);
+        return false;
+    }
+    if (isbn_chave != 0 && !indice_isbn_adicionar(lista->indice_isbn, isbn_chave, novo)) {
+        printf("Erro: Falha ao indexar o livro!\n");
+        indice_textual_remover(lista->indice_textual, novo);
+        trie_titulos_remover(lista->trie_titulos, novo);
+        liberar_no_livro(novo);
+        return false;
+    }
+    if (!visoes_adicionar(lista->visoes, novo)) {
+        printf("Erro: Falha ao indexar o livro!\n");
+        indice_textual_remover(lista->indice_textual, novo);
+        trie_titulos_remover(lista->trie_titulos, novo);
+        indice_isbn_remover(lista->indice_isbn, isbn_chave);
+        liberar_no_livro(novo);
+        return false;
+    }
+    if (!paginas_inserir(lista->paginas, novo)) {
+        printf("Erro: Falha ao indexar o livro!\n");
+        indice_textual_remover(lista->indice_textual, novo);
+        trie_titulos_remover(lista->trie_titulos, novo);
+        indice_isbn_remover(lista->indice_isbn, isbn_chave);
+        visoes_remover(lista->visoes, novo);
+        liberar_no_livro(novo);
+        return false;
+    }
+
     // Insere no final da lista
     if (lista->cabeca == NULL) {
         // Lista vazia - primeiro elemento
         lista->cabeca = novo;
     } else {
-        // Percorre até o último nó
-        NoLivro* atual = lista->cabeca;
-        while (atual->proximo != NULL) {
-            atual = atual->proximo;
-        }
-        atual->proximo = novo;
+        lista->cauda->proximo = novo;
     }
+    lista->cauda = novo;
 
     lista->total++;
+
+    // Registra o título no filtro (dobrando-o se estiver cheio demais)
+    filtro_bloom_adicionar(lista->filtro_titulos, novo->titulo_busca);
+    filtro_bloom_ajustar(lista->filtro_titulos, lista);
     return true;
 }
 
@@ -174,24 +404,48 @@ NoLivro* buscar_por_titulo(ListaLivros* lista, const char* titulo) {
     char titulo_busca[MAX_TITULO];
     para_minusculo(titulo_busca, titulo);
 
-    // Percorre a lista
+    // Títulos que não estão no catálogo são descartados sem percorrer a lista
+    if (!filtro_bloom_talvez_contem(lista->filtro_titulos, titulo_busca)) {
+        return NULL;
+    }
+
+    // Percorre a lista (o título de cada nó já está em minúsculas)
     NoLivro* atual = lista->cabeca;
     while (atual != NULL) {
-        // Converte o título do livro atual para minúsculas
-        char titulo_atual[MAX_TITULO];
-        para_minusculo(titulo_atual, atual->dados.titulo);
-
         // Compara os títulos
-        if (strcmp(titulo_atual, titulo_busca) == 0) {
+        if (strcmp(atual->titulo_busca, titulo_busca) == 0) {
             return atual;
         }
 
         atual = atual->proximo;
     }
 
+    // O filtro indicou "talvez", mas o título não existe
+    if (lista->filtro_titulos != NULL) {
+        lista->filtro_titulos->falsos_positivos++;
+    }
+
     return NULL; // Não encontrado
 }
 
+/**
+ * Busca um livro pelo ISBN (consulta direta na tabela hash, sem comparar strings)
+ */
+NoLivro* buscar_por_isbn(ListaLivros* lista, const char* isbn) {
+    if (lista == NULL || isbn == NULL) {
+        return NULL;
+    }
+
+    return indice_isbn_buscar(lista->indice_isbn, normalizar_isbn(isbn));
+}
+
+/**
+ * Condição da busca por autor: o autor buscado está contido no do livro (sem caixa)
+ */
+static bool autor_contem(const NoLivro* livro, const void* contexto) {
+    return procurar_sem_caixa(livro->dados.autor, (const char*)contexto) != NULL;
+}
+
 /**
  * Busca livros por autor (comparação parcial e case-insensitive)
  */
@@ -200,42 +454,30 @@ int buscar_por_autor(ListaLivros* lista, const char* autor) {
         return 0;
     }
 
-    // Converte o autor buscado para minúsculas
-    char autor_busca[MAX_AUTOR];
-    para_minusculo(autor_busca, autor);
+    // Substring não tem índice: o catálogo é varrido em paralelo
+    ResultadoVarredura resultado;
+    if (!varrer_catalogo(lista, autor_contem, autor, 0, &resultado)) {
+        printf("Erro: Falha ao alocar memória para a busca!\n");
+        return 0;
+    }
 
-    int encontrados = 0;
-    NoLivro* atual = lista->cabeca;
+    int encontrados = resultado.total;
 
     printf("\n=== LIVROS DO AUTOR '%s' ===\n", autor);
 
-    // Percorre a lista
-    while (atual != NULL) {
-        // Converte o autor do livro atual para minúsculas
-        char autor_atual[MAX_AUTOR];
-        para_minusculo(autor_atual, atual->dados.autor);
-
-        // Verifica se o autor buscado está contido no autor do livro
-        if (strstr(autor_atual, autor_busca) != NULL) {
-            encontrados++;
-
-            printf("\n[%d] Título: %s\n", encontrados, atual->dados.titulo);
-            printf("    Autor: %s\n", atual->dados.autor);
-            printf("    Ano: %d\n", atual->dados.ano_publicacao);
-            printf("    ISBN: %s\n", strlen(atual->dados.isbn) > 0 ? atual->dados.isbn : "N/A");
-            printf("    Status: %s\n", atual->dados.status ? "Disponível" : "Emprestado");
-
-            if (!atual->dados.status) {
-                char data_str[30];
-                formatar_data(atual->dados.data_emprestimo, data_str, sizeof(data_str));
-                printf("    Emprestado para: %s (em %s)\n",
-                       atual->dados.nome_leitor_atual, data_str);
-            }
-        }
+    for (int i = 0; i < encontrados; i++) {
+        NoLivro* atual = resultado.livros[i];
 
-        atual = atual->proximo;
+        printf("\n[%d] Título: %s\n", i + 1, atual->dados.titulo);
+        printf("    Autor: %s\n", atual->dados.autor);
+        printf("    Ano: %d\n", atual->dados.ano_publicacao);
+        printf("    ISBN: %s\n", strlen(atual->dados.isbn) > 0 ? atual->dados.isbn : "N/A");
+        printf("    Status: %s\n", atual->dados.status ? "Disponível" : "Indisponível");
+        exibir_exemplares(atual);
     }
 
+    liberar_resultado_varredura(&resultado);
+
     if (encontrados == 0) {
         printf("Nenhum livro encontrado para o autor '%s'.\n", autor);
     } else {
@@ -262,10 +504,7 @@ bool remover_livro(ListaLivros* lista, const char* titulo) {
 
     // Procura o livro na lista
     while (atual != NULL) {
-        char titulo_atual[MAX_TITULO];
-        para_minusculo(titulo_atual, atual->dados.titulo);
-
-        if (strcmp(titulo_atual, titulo_busca) == 0) {
+        if (strcmp(atual->titulo_busca, titulo_busca) == 0) {
             // Livro encontrado - remove
             if (anterior == NULL) {
                 // Remove o primeiro nó
@@ -274,8 +513,24 @@ bool remover_livro(ListaLivros* lista, const char* titulo) {
                 // Remove um nó do meio ou fim
                 anterior->proximo = atual->proximo;
             }
+            if (lista->cauda == atual) {
+                lista->cauda = anterior;
+            }
 
-            free(atual);
+            recuar_cursores(lista->cursores, atual, anterior);
+            indice_textual_remover(lista->indice_textual, atual);
+            trie_titulos_remover(lista->trie_titulos, atual);
+            filtro_bloom_remover(lista->filtro_titulos, atual->titulo_busca);
+            indice_isbn_remover(lista->indice_isbn, atual->isbn_chave);
+            visoes_remover(lista->visoes, atual);
+            paginas_remover(lista->paginas, atual);
+            for (int i = 0; i < atual->dados.quantidade; i++) {
+                Exemplar* exemplar = &atual->exemplares[i];
+                leitor_desvincular_emprestimo(exemplar);
+                prazos_remover(lista->prazos, exemplar);
+                roda_reservas_remover(lista->reservas, exemplar);
+            }
+            liberar_no_livro(atual);
             lista->total--;
             return true;
         }
@@ -287,6 +542,18 @@ bool remover_livro(ListaLivros* lista, const char* titulo) {
     return false; // Não encontrado
 }
 
+/**
+ * Exibe os dados de um livro da listagem do catálogo
+ */
+static void exibir_livro(int numero, NoLivro* livro) {
+    printf("\n[%d] Título: %s\n", numero, livro->dados.titulo);
+    printf("    Autor: %s\n", livro->dados.autor);
+    printf("    Ano: %d\n", livro->dados.ano_publicacao);
+    printf("    ISBN: %s\n", strlen(livro->dados.isbn) > 0 ? livro->dados.isbn : "N/A");
+    printf("    Status: %s\n", livro->dados.status ? "Disponível" : "Indisponível");
+    exibir_exemplares(livro);
+}
+
 /**
  * Lista todos os livros do catálogo
  */
@@ -303,26 +570,87 @@ void listar_todos_livros(ListaLivros* lista) {
     int contador = 1;
 
     while (atual != NULL) {
-        printf("\n[%d] Título: %s\n", contador, atual->dados.titulo);
-        printf("    Autor: %s\n", atual->dados.autor);
-        printf("    Ano: %d\n", atual->dados.ano_publicacao);
-        printf("    ISBN: %s\n", strlen(atual->dados.isbn) > 0 ? atual->dados.isbn : "N/A");
-        printf("    Status: %s\n", atual->dados.status ? "Disponível" : "Emprestado");
+        exibir_livro(contador, atual);
+        atual = atual->proximo;
+        contador++;
+    }
+}
 
-        if (!atual->dados.status) {
-            char data_str[30];
-            formatar_data(atual->dados.data_emprestimo, data_str, sizeof(data_str));
-            printf("    Emprestado para: %s (em %s)\n",
-                   atual->dados.nome_leitor_atual, data_str);
-        }
+/**
+ * Abre um cursor no início do catálogo
+ */
+void catalogo_abrir_cursor(ListaLivros* lista, CursorListagem* cursor) {
+    if (lista == NULL || cursor == NULL) return;
+    registrar_cursor(&lista->cursores, cursor);
+}
+
+/**
+ * Fecha um cursor do catálogo
+ */
+void catalogo_fechar_cursor(ListaLivros* lista, CursorListagem* cursor) {
+    if (lista == NULL || cursor == NULL) return;
+    desregistrar_cursor(&lista->cursores, cursor);
+}
 
+/**
+ * Copia a próxima página do catálogo e avança o cursor
+ */
+int catalogo_pagina(ListaLivros* lista, CursorListagem* cursor, NoLivro** saida, int max) {
+    if (lista == NULL || cursor == NULL || saida == NULL) {
+        return 0;
+    }
+
+    // Continua logo depois do último livro entregue
+    NoLivro* atual = cursor->ultimo != NULL ? ((const NoLivro*)cursor->ultimo)->proximo : lista->cabeca;
+    int copiados = 0;
+
+    while (atual != NULL && copiados < max) {
+        saida[copiados++] = atual;
+        cursor->ultimo = atual;
         atual = atual->proximo;
-        contador++;
     }
+
+    cursor->entregues += copiados;
+    return copiados;
+}
+
+/**
+ * Exibe a próxima página do catálogo
+ */
+int listar_livros_pagina(ListaLivros* lista, CursorListagem* cursor, int tamanho) {
+    if (lista == NULL || cursor == NULL || tamanho <= 0) {
+        return 0;
+    }
+
+    NoLivro** pagina = (NoLivro**)malloc(tamanho * sizeof(NoLivro*));
+    if (pagina == NULL) {
+        printf("Erro: Falha ao alocar memória!\n");
+        return 0;
+    }
+
+    int primeiro = cursor->entregues + 1;
+    int encontrados = catalogo_pagina(lista, cursor, pagina, tamanho);
+
+    if (primeiro == 1 && encontrados == 0) {
+        printf("\nO catálogo está vazio!\n");
+    } else if (encontrados == 0) {
+        printf("\nFim do catálogo.\n");
+    } else {
+        if (primeiro == 1) {
+            printf("\n=== CATÁLOGO COMPLETO ===\n");
+            printf("Total de livros: %d\n", lista->total);
+        }
+        for (int i = 0; i < encontrados; i++) {
+            exibir_livro(primeiro + i, pagina[i]);
+        }
+    }
+
+    free(pagina);
+    return encontrados;
 }
 
 /**
- * Lista apenas os livros com status "disponível"
+ * Lista apenas os livros com pelo menos um exemplar livre
  */
 void listar_livros_disponiveis(ListaLivros* lista) {
     if (lista == NULL || lista->cabeca == NULL) {
@@ -336,12 +664,13 @@ void listar_livros_disponiveis(ListaLivros* lista) {
     int contador = 0;
 
     while (atual != NULL) {
-        if (atual->dados.status) { // Se disponível
+        if (atual->dados.status) { // Se há exemplar livre
             contador++;
             printf("\n[%d] Título: %s\n", contador, atual->dados.titulo);
             printf("    Autor: %s\n", atual->dados.autor);
             printf("    Ano: %d\n", atual->dados.ano_publicacao);
             printf("    ISBN: %s\n", strlen(atual->dados.isbn) > 0 ? atual->dados.isbn : "N/A");
+            printf("    Exemplares livres: %d de %d\n", atual->total_livres, atual->dados.quantidade);
         }
 
         atual = atual->proximo;
@@ -355,7 +684,7 @@ void listar_livros_disponiveis(ListaLivros* lista) {
 }
 
 /**
- * Lista apenas os livros com status "emprestado"
+ * Lista os exemplares emprestados
  */
 void listar_livros_emprestados(ListaLivros* lista) {
     if (lista == NULL || lista->cabeca == NULL) {
@@ -363,30 +692,69 @@ void listar_livros_emprestados(ListaLivros* lista) {
         return;
     }
 
-    printf("\n=== LIVROS EMPRESTADOS ===\n");
+    SaidaRelatorio* saida = criar_saida(STDOUT_FILENO, saida_formato_padrao());
+    if (saida == NULL) {
+        printf("Erro: Falha ao alocar memória para o relatório!\n");
+        return;
+    }
+
+    saida_iniciar_relatorio(saida, "LIVROS EMPRESTADOS",
+                            "titulo,exemplar,autor,leitor,data_emprestimo,devolver_ate");
 
     NoLivro* atual = lista->cabeca;
     int contador = 0;
 
     while (atual != NULL) {
-        if (!atual->dados.status) { // Se emprestado
-            contador++;
-            char data_str[30];
-            formatar_data(atual->dados.data_emprestimo, data_str, sizeof(data_str));
+        for (int i = 0; i < atual->dados.quantidade; i++) {
+            Exemplar* exemplar = &atual->exemplares[i];
+            if (exemplar->status) continue; // Só os emprestados
 
-            printf("\n[%d] Título: %s\n", contador, atual->dados.titulo);
-            printf("    Autor: %s\n", atual->dados.autor);
-            printf("    Emprestado para: %s\n", atual->dados.nome_leitor_atual);
-            printf("    Data do empréstimo: %s\n", data_str);
+            contador++;
+            saida_iniciar_registro(saida);
+            saida_campo_texto(saida, "Título", "titulo", atual->dados.titulo);
+            saida_campo_inteiro(saida, "Exemplar", "exemplar", exemplar->numero);
+            saida_campo_texto(saida, "Autor", "autor", atual->dados.autor);
+            saida_campo_texto(saida, "Emprestado para", "leitor", exemplar->nome_leitor_atual);
+            saida_campo_data(saida, "Data do empréstimo", "data_emprestimo", exemplar->data_emprestimo);
+            saida_campo_data(saida, "Devolver até", "devolver_ate", exemplar->data_devolucao_prevista);
+            saida_terminar_registro(saida);
         }
 
         atual = atual->proximo;
     }
 
     if (contador == 0) {
-        printf("Não há livros emprestados no momento.\n");
+        saida_nota(saida, "Não há livros emprestados no momento.\n");
     } else {
-        printf("\nTotal de livros emprestados: %d\n", contador);
+        saida_nota(saida, "\nTotal de exemplares emprestados: %d\n", contador);
+    }
+    saida_terminar_relatorio(saida);
+    liberar_saida(saida);
+}
+
+/**
+ * Exibe a quantidade de exemplares e os que estão emprestados ou separados
+ */
+void exibir_exemplares(NoLivro* livro) {
+    if (livro == NULL) return;
+
+    printf("    Exemplares: %d livre(s) de %d\n", livro->total_livres, livro->dados.quantidade);
+
+    for (int i = 0; i < livro->dados.quantidade; i++) {
+        Exemplar* exemplar = &livro->exemplares[i];
+        char data_str[30];
+
+        if (!exemplar->status) {
+            char prazo_str[30];
+            formatar_data(exemplar->data_emprestimo, data_str, sizeof(data_str));
+            formatar_data(exemplar->data_devolucao_prevista, prazo_str, sizeof(prazo_str));
+            printf("    - Exemplar %d: emprestado para %s (em %s, devolver até %s)\n",
+                   exemplar->numero, exemplar->nome_leitor_atual, data_str, prazo_str);
+        } else if (strlen(exemplar->nome_reserva) > 0) {
+            formatar_data(exemplar->fim_reserva, data_str, sizeof(data_str));
+            printf("    - Exemplar %d: separado para %s (até %s)\n",
+                   exemplar->numero, exemplar->nome_reserva, data_str);
+        }
     }
 }
 
@@ -402,10 +770,18 @@ void liberar_lista_livros(ListaLivros* lista) {
     // Percorre a lista liberando cada nó
     while (atual != NULL) {
         proximo = atual->proximo;
-        free(atual);
+        liberar_no_livro(atual);
         atual = proximo;
     }
 
+    liberar_indice_textual(lista->indice_textual);
+    liberar_trie_titulos(lista->trie_titulos);
+    liberar_filtro_bloom(lista->filtro_titulos);
+    liberar_indice_isbn(lista->indice_isbn);
+    liberar_controle_prazos(lista->prazos);
+    liberar_roda_reservas(lista->reservas);
+    liberar_visoes_ordenadas(lista->visoes);
+    liberar_paginas_catalogo(lista->paginas);
     free(lista);
 }
 
@@ -426,18 +802,50 @@ FilaEspera* criar_fila_espera() {
     fila->frente = NULL;
     fila->tras = NULL;
     fila->total = 0;
+    fila->leitores = NULL;
+    fila->cursores = NULL;
+
+    fila->por_titulo = criar_filas_por_titulo();
+    if (fila->por_titulo == NULL) {
+        free(fila);
+        return NULL;
+    }
 
     return fila;
 }
 
 /**
  * Adiciona um leitor à fila de espera (final da fila - FIFO)
+ * A classe de prioridade vem do cadastro do leitor, se houver.
  */
 bool enfileirar(FilaEspera* fila, const char* nome_leitor, const char* titulo_livro) {
     if (fila == NULL || nome_leitor == NULL || titulo_livro == NULL) {
         return false;
     }
 
+    int prioridade = PRIORIDADE_GERAL;
+    Leitor* leitor = buscar_leitor(fila->leitores, nome_leitor);
+    if (leitor != NULL) {
+        prioridade = leitor->prioridade;
+    }
+
+    return enfileirar_com_prioridade(fila, nome_leitor, titulo_livro, prioridade);
+}
+
+/**
+ * Adiciona um leitor à fila de espera com uma classe de prioridade explícita
+ */
+bool enfileirar_com_prioridade(FilaEspera* fila, const char* nome_leitor,
+                               const char* titulo_livro, int prioridade) {
+    if (fila == NULL || nome_leitor == NULL || titulo_livro == NULL) {
+        return false;
+    }
+
+    // O leitor já aguarda este título: mantém a solicitação (e a posição) existente
+    if (filas_buscar_solicitacao(fila->por_titulo, nome_leitor, titulo_livro) != NULL) {
+        return true;
+    }
+
     // Cria um novo nó
     NoFila* novo = (NoFila*)malloc(sizeof(NoFila));
     if (novo == NULL) {
@@ -449,8 +857,26 @@ bool enfileirar(FilaEspera* fila, const char* nome_leitor, const char* titulo_li
     strcpy(novo->dados.nome_leitor, nome_leitor);
     strcpy(novo->dados.titulo_livro, titulo_livro);
     novo->dados.data_solicitacao = time(NULL);
+    novo->dados.prioridade = prioridade;
+    novo->leitor = NULL;
+    novo->anterior_do_leitor = NULL;
+    novo->proximo_do_leitor = NULL;
+    novo->fila_titulo = NULL;
+    novo->posicao_heap = -1;
+    novo->anterior = NULL;
     novo->proximo = NULL;
 
+    // Coloca na fila do título (define a ordem de atendimento)
+    if (!filas_adicionar(fila->por_titulo, novo)) {
+        free(novo);
+        return false;
+    }
+
+    // Registra a solicitação no cadastro do leitor
+    if (fila->leitores != NULL) {
+        leitor_vincular_solicitacao(obter_leitor(fila->leitores, nome_leitor), novo);
+    }
+
     // Insere no final da fila
     if (fila->tras == NULL) {
         // Fila vazia - primeiro elemento
@@ -458,6 +884,7 @@ bool enfileirar(FilaEspera* fila, const char* nome_leitor, const char* titulo_li
         fila->tras = novo;
     } else {
         // Adiciona no final
+        novo->anterior = fila->tras;
         fila->tras->proximo = novo;
         fila->tras = novo;
     }
@@ -468,53 +895,39 @@ bool enfileirar(FilaEspera* fila, const char* nome_leitor, const char* titulo_li
 
 /**
  * Remove o próximo leitor da fila para um livro específico
+ * O próximo é o topo do heap do título: O(log n), sem percorrer a fila.
  */
 bool desenfileirar_especifico(FilaEspera* fila, const char* titulo_livro, char* nome_leitor_saida) {
     if (fila == NULL || titulo_livro == NULL || fila->frente == NULL) {
         return false;
     }
 
-    // Converte o título para minúsculas
-    char titulo_busca[MAX_TITULO];
-    para_minusculo(titulo_busca, titulo_livro);
-
-    NoFila* atual = fila->frente;
-    NoFila* anterior = NULL;
-
-    // Procura o primeiro leitor aguardando este livro
-    while (atual != NULL) {
-        char titulo_atual[MAX_TITULO];
-        para_minusculo(titulo_atual, atual->dados.titulo_livro);
-
-        if (strcmp(titulo_atual, titulo_busca) == 0) {
-            // Encontrou - copia o nome do leitor
-            strcpy(nome_leitor_saida, atual->dados.nome_leitor);
-
-            // Remove da fila
-            if (anterior == NULL) {
-                // Remove da frente
-                fila->frente = atual->proximo;
-                if (fila->frente == NULL) {
-                    fila->tras = NULL; // Fila ficou vazia
-                }
-            } else {
-                // Remove do meio
-                anterior->proximo = atual->proximo;
-                if (atual == fila->tras) {
-                    fila->tras = anterior; // Era o último
-                }
-            }
+    NoFila* atual = filas_proxima(fila->por_titulo, titulo_livro);
+    if (atual == NULL) {
+        return false; // Ninguém aguarda este livro
+    }
 
-            free(atual);
-            fila->total--;
-            return true;
-        }
+    // Copia o nome do leitor
+    strcpy(nome_leitor_saida, atual->dados.nome_leitor);
+    recuar_cursores(fila->cursores, atual, atual->anterior);
 
-        anterior = atual;
-        atual = atual->proximo;
+    // Remove da lista em ordem de chegada (duplamente encadeada)
+    if (atual->anterior == NULL) {
+        fila->frente = atual->proximo; // Remove da frente
+    } else {
+        atual->anterior->proximo = atual->proximo;
+    }
+    if (atual->proximo == NULL) {
+        fila->tras = atual->anterior; // Era o último
+    } else {
+        atual->proximo->anterior = atual->anterior;
     }
 
-    return false; // Não encontrado
+    filas_remover(fila->por_titulo, atual);
+    leitor_desvincular_solicitacao(atual);
+    free(atual);
+    fila->total--;
+    return true;
 }
 
 /**
@@ -525,35 +938,14 @@ int consultar_posicao(FilaEspera* fila, const char* nome_leitor, const char* tit
         return 0;
     }
 
-    // Converte para minúsculas
-    char titulo_busca[MAX_TITULO];
-    char nome_busca[MAX_NOME_LEITOR];
-    para_minusculo(titulo_busca, titulo_livro);
-    para_minusculo(nome_busca, nome_leitor);
-
-    NoFila* atual = fila->frente;
-    int posicao = 0;
-
-    while (atual != NULL) {
-        char titulo_atual[MAX_TITULO];
-        char nome_atual[MAX_NOME_LEITOR];
-        para_minusculo(titulo_atual, atual->dados.titulo_livro);
-        para_minusculo(nome_atual, atual->dados.nome_leitor);
-
-        // Conta apenas para este livro específico
-        if (strcmp(titulo_atual, titulo_busca) == 0) {
-            posicao++;
-
-            // Verifica se é o leitor procurado
-            if (strcmp(nome_atual, nome_busca) == 0) {
-                return posicao;
-            }
-        }
-
-        atual = atual->proximo;
+    // Acha a solicitação direto no conjunto de pares (leitor, título)
+    NoFila* solicitacao = filas_buscar_solicitacao(fila->por_titulo, nome_leitor, titulo_livro);
+    if (solicitacao == NULL) {
+        return 0; // Não encontrado
     }
 
-    return 0; // Não encontrado
+    // Posição pela ordem de atendimento (classe de prioridade e chegada)
+    return filas_posicao(fila->por_titulo, solicitacao);
 }
 
 /**
@@ -565,40 +957,54 @@ int listar_fila_livro(FilaEspera* fila, const char* titulo_livro) {
         return 0;
     }
 
-    // Converte o título para minúsculas
-    char titulo_busca[MAX_TITULO];
-    para_minusculo(titulo_busca, titulo_livro);
-
     printf("\n=== FILA DE ESPERA PARA: %s ===\n", titulo_livro);
 
-    NoFila* atual = fila->frente;
-    int posicao = 0;
-
-    while (atual != NULL) {
-        char titulo_atual[MAX_TITULO];
-        para_minusculo(titulo_atual, atual->dados.titulo_livro);
+    FilaTitulo* fila_titulo = filas_buscar(fila->por_titulo, titulo_livro);
+    if (fila_titulo == NULL) {
+        printf("Não há leitores aguardando por este livro.\n");
+        return 0;
+    }
 
-        if (strcmp(titulo_atual, titulo_busca) == 0) {
-            posicao++;
-            char data_str[30];
-            formatar_data(atual->dados.data_solicitacao, data_str, sizeof(data_str));
+    // Copia as solicitações do título na ordem de atendimento
+    NoFila** ordem = (NoFila**)malloc(fila_titulo->total * sizeof(NoFila*));
+    if (ordem == NULL) {
+        printf("Erro: Falha ao alocar memória!\n");
+        return 0;
+    }
+    filas_ordenar(fila->por_titulo, fila_titulo, ordem);
 
-            printf("[Posição %d] %s - Solicitado em: %s\n",
-                   posicao, atual->dados.nome_leitor, data_str);
-        }
+    for (int i = 0; i < fila_titulo->total; i++) {
+        char data_str[30];
+        formatar_data(ordem[i]->dados.data_solicitacao, data_str, sizeof(data_str));
 
-        atual = atual->proximo;
+        printf("[Posição %d] %s%s - Solicitado em: %s\n", i + 1, ordem[i]->dados.nome_leitor,
+               ordem[i]->dados.prioridade == PRIORIDADE_PREFERENCIAL ? " (preferencial)" : "",
+               data_str);
     }
 
-    if (posicao == 0) {
-        printf("Não há leitores aguardando por este livro.\n");
-    } else {
-        printf("\nTotal de leitores na fila: %d\n", posicao);
+    int posicao = fila_titulo->total;
+    free(ordem);
+
+    printf("\nTotal de leitores na fila: %d\n", posicao);
+    if (fila->por_titulo->modo_prioridade) {
+        printf("Modo prioridade ativo: leitores preferenciais são atendidos primeiro.\n");
     }
 
     return posicao;
 }
 
+/**
+ * Exibe os dados de uma solicitação da listagem da fila
+ */
+static void exibir_solicitacao(int numero, NoFila* solicitacao) {
+    char data_str[30];
+    formatar_data(solicitacao->dados.data_solicitacao, data_str, sizeof(data_str));
+
+    printf("\n[%d] Leitor: %s\n", numero, solicitacao->dados.nome_leitor);
+    printf("    Livro: %s\n", solicitacao->dados.titulo_livro);
+    printf("    Solicitado em: %s\n", data_str);
+}
+
 /**
  * Lista todas as solicitações em todas as filas de espera
  */
@@ -615,37 +1021,113 @@ void listar_todas_filas(FilaEspera* fila) {
     int contador = 1;
 
     while (atual != NULL) {
-        char data_str[30];
-        formatar_data(atual->dados.data_solicitacao, data_str, sizeof(data_str));
-
-        printf("\n[%d] Leitor: %s\n", contador, atual->dados.nome_leitor);
-        printf("    Livro: %s\n", atual->dados.titulo_livro);
-        printf("    Solicitado em: %s\n", data_str);
-
+        exibir_solicitacao(contador, atual);
         atual = atual->proximo;
         contador++;
     }
 }
 
 /**
- * Libera toda a memória da fila de espera
+ * Abre um cursor no início da fila de espera
  */
-void liberar_fila_espera(FilaEspera* fila) {
-    if (fila == NULL) return;
+void fila_abrir_cursor(FilaEspera* fila, CursorListagem* cursor) {
+    if (fila == NULL || cursor == NULL) return;
+    registrar_cursor(&fila->cursores, cursor);
+}
 
-    NoFila* atual = fila->frente;
-    NoFila* proximo;
+/**
+ * Fecha um cursor da fila de espera
+ */
+void fila_fechar_cursor(FilaEspera* fila, CursorListagem* cursor) {
+    if (fila == NULL || cursor == NULL) return;
+    desregistrar_cursor(&fila->cursores, cursor);
+}
 
-    // Percorre a fila liberando cada nó
-    while (atual != NULL) {
-        proximo = atual->proximo;
+/**
+ * Copia a próxima página de solicitações e avança o cursor
+ */
+int fila_pagina(FilaEspera* fila, CursorListagem* cursor, NoFila** saida, int max) {
+    if (fila == NULL || cursor == NULL || saida == NULL) {
+        return 0;
+    }
+
+    NoFila* atual = cursor->ultimo != NULL ? ((const NoFila*)cursor->ultimo)->proximo : fila->frente;
+    int copiados = 0;
+
+    while (atual != NULL && copiados < max) {
+        saida[copiados++] = atual;
+        cursor->ultimo = atual;
+        atual = atual->proximo;
+    }
+
+    cursor->entregues += copiados;
+    return copiados;
+}
+
+/**
+ * Exibe a próxima página de solicitações em espera
+ */
+int listar_filas_pagina(FilaEspera* fila, CursorListagem* cursor, int tamanho) {
+    if (fila == NULL || cursor == NULL || tamanho <= 0) {
+        return 0;
+    }
+
+    NoFila** pagina = (NoFila**)malloc(tamanho * sizeof(NoFila*));
+    if (pagina == NULL) {
+        printf("Erro: Falha ao alocar memória!\n");
+        return 0;
+    }
+
+    int primeiro = cursor->entregues + 1;
+    int encontrados = fila_pagina(fila, cursor, pagina, tamanho);
+
+    if (primeiro == 1 && encontrados == 0) {
+        printf("\nNão há solicitações na fila de espera!\n");
+    } else if (encontrados == 0) {
+        printf("\nFim da fila de espera.\n");
+    } else {
+        if (primeiro == 1) {
+            printf("\n=== TODAS AS SOLICITAÇÕES EM ESPERA ===\n");
+            printf("Total de solicitações: %d\n", fila->total);
+        }
+        for (int i = 0; i < encontrados; i++) {
+            exibir_solicitacao(primeiro + i, pagina[i]);
+        }
+    }
+
+    free(pagina);
+    return encontrados;
+}
+
+/**
+ * Libera toda a memória da fila de espera
+ */
+void liberar_fila_espera(FilaEspera* fila) {
+    if (fila == NULL) return;
+
+    NoFila* atual = fila->frente;
+    NoFila* proximo;
+
+    // Percorre a fila liberando cada nó
+    while (atual != NULL) {
+        proximo = atual->proximo;
         free(atual);
         atual = proximo;
     }
 
+    liberar_filas_por_titulo(fila->por_titulo);
     free(fila);
 }
 
+/**
+ * Liga ou desliga o modo de prioridade da fila de espera
+ */
+void definir_modo_prioridade(FilaEspera* fila, bool modo_prioridade) {
+    if (fila == NULL) return;
+
+    filas_definir_modo(fila->por_titulo, modo_prioridade);
+}
+
 // =============================================================================
 // FUNÇÕES DA PILHA (HISTÓRICO DE OPERAÇÕES)
 // =============================================================================
@@ -660,12 +1142,30 @@ PilhaHistorico* criar_pilha_historico() {
         return NULL;
     }
 
-    pilha->topo = NULL;
     pilha->total = 0;
+    pilha->registros = criar_registros_historico();
+
+    if (pilha->registros == NULL) {
+        free(pilha);
+        return NULL;
+    }
 
     return pilha;
 }
 
+/**
+ * Horário da próxima operação: nunca anterior ao da última registrada,
+ * mesmo se o relógio do sistema for atrasado, para manter os horários ordenados
+ */
+static time_t horario_operacao(PilhaHistorico* pilha) {
+    time_t agora = time(NULL);
+
+    if (pilha->total > 0 && agora < pilha->registros->ultima_data) {
+        return pilha->registros->ultima_data;
+    }
+    return agora;
+}
+
 /**
  * Adiciona uma nova operação ao topo da pilha (LIFO)
  */
@@ -675,260 +1175,1261 @@ bool empilhar(PilhaHistorico* pilha, const char* tipo_operacao,
         return false;
     }
 
-    // Cria um novo nó
-    NoPilha* novo = (NoPilha*)malloc(sizeof(NoPilha));
-    if (novo == NULL) {
-        printf("Erro: Falha ao alocar memória para o histórico!\n");
+    // Preenche os dados da operação
+    Operacao operacao;
+    strcpy(operacao.tipo_operacao, tipo_operacao);
+    strcpy(operacao.titulo_livro, titulo_livro);
+    strcpy(operacao.nome_leitor, nome_leitor);
+
+    // Grava o registro compacto no topo (fim da cronologia)
+    if (!registros_adicionar(pilha->registros, &operacao, 1, horario_operacao(pilha))) {
+        printf("Erro: Falha ao registrar a operação no histórico!\n");
         return false;
     }
 
-    // Preenche os dados da operação
-    strcpy(novo->dados.tipo_operacao, tipo_operacao);
-    strcpy(novo->dados.titulo_livro, titulo_livro);
-    strcpy(novo->dados.nome_leitor, nome_leitor);
-    novo->dados.data_operacao = time(NULL);
+    pilha->total++;
+    return true;
+}
+
+/**
+ * Adiciona um bloco de operações ao topo da pilha
+ */
+bool empilhar_lote(PilhaHistorico* pilha, const Operacao* operacoes, int total) {
+    if (pilha == NULL || operacoes == NULL || total <= 0) {
+        return total == 0;
+    }
 
-    // Insere no topo da pilha
-    novo->proximo = pilha->topo;
-    pilha->topo = novo;
+    // A última operação do vetor fica no topo
+    if (!registros_adicionar(pilha->registros, operacoes, total, horario_operacao(pilha))) {
+        printf("Erro: Falha ao registrar as operações no histórico!\n");
+        return false;
+    }
 
-    pilha->total++;
+    pilha->total += total;
+    return true;
+}
+
+/**
+ * Adiciona operações ao topo da pilha mantendo o horário de cada uma
+ */
+bool empilhar_com_horarios(PilhaHistorico* pilha, const Operacao* operacoes, int total) {
+    if (pilha == NULL || operacoes == NULL || total <= 0) {
+        return total == 0;
+    }
+
+    time_t anterior = pilha->total > 0 ? pilha->registros->ultima_data : operacoes[0].data_operacao;
+    for (int i = 0; i < total; i++) {
+        if (operacoes[i].data_operacao < anterior) {
+            printf("Erro: Operações do histórico fora de ordem cronológica!\n");
+            return false;
+        }
+        anterior = operacoes[i].data_operacao;
+    }
+
+    // Cada sequência de operações do mesmo segundo é gravada de uma vez
+    int inicio = 0;
+    while (inicio < total) {
+        int fim = inicio + 1;
+        while (fim < total && operacoes[fim].data_operacao == operacoes[inicio].data_operacao) {
+            fim++;
+        }
+        if (!registros_adicionar(pilha->registros, operacoes + inicio, fim - inicio,
+                                 operacoes[inicio].data_operacao)) {
+            printf("Erro: Falha ao registrar as operações no histórico!\n");
+            return false;
+        }
+        pilha->total += fim - inicio;
+        inicio = fim;
+    }
     return true;
 }
 
+#define COLUNAS_OPERACAO "operacao,livro,leitor,data" // Cabeçalho CSV das listagens do histórico
+
+/**
+ * Escreve uma operação do histórico como registro de um relatório
+ */
+static void escrever_operacao(SaidaRelatorio* saida, const Operacao* operacao) {
+    saida_iniciar_registro(saida);
+    saida_campo_texto(saida, "Operação", "operacao", operacao->tipo_operacao);
+    saida_campo_texto(saida, "Livro", "livro", operacao->titulo_livro);
+    saida_campo_texto(saida, "Leitor", "leitor", operacao->nome_leitor);
+    saida_campo_data(saida, "Data/Hora", "data", operacao->data_operacao);
+    saida_terminar_registro(saida);
+}
+
 /**
  * Exibe as operações mais recentes do histórico
  */
 void exibir_historico(PilhaHistorico* pilha, int limite) {
-    if (pilha == NULL || pilha->topo == NULL) {
+    if (pilha == NULL || pilha->total == 0) {
         printf("\nO histórico está vazio!\n");
         return;
     }
 
-    printf("\n=== HISTÓRICO DE OPERAÇÕES ===\n");
+    SaidaRelatorio* saida = criar_saida(STDOUT_FILENO, saida_formato_padrao());
+    if (saida == NULL) {
+        printf("Erro: Falha ao alocar memória para o relatório!\n");
+        return;
+    }
+
+    saida_iniciar_relatorio(saida, "HISTÓRICO DE OPERAÇÕES", COLUNAS_OPERACAO);
 
     if (limite == 0 || limite > pilha->total) {
         limite = pilha->total;
-        printf("Total de operações: %d\n", pilha->total);
+        saida_nota(saida, "Total de operações: %d\n", pilha->total);
     } else {
-        printf("Exibindo as %d operações mais recentes (total: %d)\n", limite, pilha->total);
+        saida_nota(saida, "Exibindo as %d operações mais recentes (total: %d)\n", limite, pilha->total);
     }
 
-    NoPilha* atual = pilha->topo;
-    int contador = 1;
-
-    while (atual != NULL && contador <= limite) {
-        char data_str[30];
-        formatar_data(atual->dados.data_operacao, data_str, sizeof(data_str));
-
-        printf("\n[%d] Operação: %s\n", contador, atual->dados.tipo_operacao);
-        printf("    Livro: %s\n", atual->dados.titulo_livro);
-        printf("    Leitor: %s\n", atual->dados.nome_leitor);
-        printf("    Data/Hora: %s\n", data_str);
-
-        atual = atual->proximo;
-        contador++;
+    // Decodifica do registro mais recente para o mais antigo
+    Operacao operacao;
+    for (int contador = 1; contador <= limite; contador++) {
+        if (!registros_ler(pilha->registros, pilha->total - contador, &operacao)) {
+            break;
+        }
+        escrever_operacao(saida, &operacao);
     }
+
+    saida_terminar_relatorio(saida);
+    liberar_saida(saida);
 }
 
 /**
- * Exibe todo o histórico de operações para um livro específico
+ * Copia a próxima página do histórico e avança o cursor
  */
-int historico_livro(PilhaHistorico* pilha, const char* titulo_livro) {
-    if (pilha == NULL || titulo_livro == NULL || pilha->topo == NULL) {
-        printf("\nO histórico está vazio!\n");
+int historico_pagina(PilhaHistorico* pilha, CursorListagem* cursor, Operacao* saida, int max) {
+    if (pilha == NULL || cursor == NULL || saida == NULL) {
         return 0;
     }
 
-    // Converte o título para minúsculas
-    char titulo_busca[MAX_TITULO];
-    para_minusculo(titulo_busca, titulo_livro);
-
-    printf("\n=== HISTÓRICO DO LIVRO: %s ===\n", titulo_livro);
+    // A listagem começa no topo do momento da primeira página; operações
+    // registradas depois ficam acima dela e não deslocam as posições seguintes
+    if (cursor->entregues == 0) {
+        cursor->inicio = pilha->total - 1;
+    }
 
-    NoPilha* atual = pilha->topo;
-    int encontrados = 0;
+    int posicao = cursor->inicio - cursor->entregues;
+    int copiados = 0;
 
-    while (atual != NULL) {
-        char titulo_atual[MAX_TITULO];
-        para_minusculo(titulo_atual, atual->dados.titulo_livro);
+    while (posicao >= 0 && copiados < max &&
+           registros_ler(pilha->registros, posicao, &saida[copiados])) {
+        posicao--;
+        copiados++;
+    }
 
-        if (strcmp(titulo_atual, titulo_busca) == 0) {
-            encontrados++;
-            char data_str[30];
-            formatar_data(atual->dados.data_operacao, data_str, sizeof(data_str));
+    cursor->entregues += copiados;
+    return copiados;
+}
 
-            printf("\n[%d] Operação: %s\n", encontrados, atual->dados.tipo_operacao);
-            printf("    Leitor: %s\n", atual->dados.nome_leitor);
-            printf("    Data/Hora: %s\n", data_str);
-        }
+/**
+ * Exibe a próxima página do histórico
+ */
+int exibir_historico_pagina(PilhaHistorico* pilha, CursorListagem* cursor, int tamanho) {
+    if (pilha == NULL || cursor == NULL || tamanho <= 0) {
+        return 0;
+    }
 
-        atual = atual->proximo;
+    Operacao* pagina = (Operacao*)malloc(tamanho * sizeof(Operacao));
+    if (pagina == NULL) {
+        printf("Erro: Falha ao alocar memória!\n");
+        return 0;
     }
 
-    if (encontrados == 0) {
-        printf("Não há operações registradas para este livro.\n");
+    int primeiro = cursor->entregues + 1;
+    int encontrados = historico_pagina(pilha, cursor, pagina, tamanho);
+
+    if (primeiro == 1 && encontrados == 0) {
+        printf("\nO histórico está vazio!\n");
+    } else if (encontrados == 0) {
+        printf("\nFim do histórico.\n");
     } else {
-        printf("\nTotal de operações encontradas: %d\n", encontrados);
+        if (primeiro == 1) {
+            printf("\n=== HISTÓRICO DE OPERAÇÕES ===\n");
+            printf("Total de operações: %d\n", pilha->total);
+        }
+
+        // A página interativa é sempre em texto, numerada a partir do cursor
+        SaidaRelatorio* saida = criar_saida(STDOUT_FILENO, FORMATO_TEXTO);
+        if (saida == NULL) {
+            printf("Erro: Falha ao alocar memória!\n");
+        } else {
+            saida->registros = primeiro - 1;
+            for (int i = 0; i < encontrados; i++) {
+                escrever_operacao(saida, &pagina[i]);
+            }
+            liberar_saida(saida);
+        }
     }
 
+    free(pagina);
     return encontrados;
 }
 
 /**
- * Libera toda a memória da pilha de histórico
+ * Localiza as operações registradas em um intervalo de tempo
  */
-void liberar_pilha_historico(PilhaHistorico* pilha) {
-    if (pilha == NULL) return;
+int historico_intervalo(PilhaHistorico* pilha, time_t inicio, time_t fim, int* primeira) {
+    if (primeira != NULL) {
+        *primeira = 0;
+    }
+    if (pilha == NULL || primeira == NULL || inicio >= fim) {
+        return 0;
+    }
 
-    NoPilha* atual = pilha->topo;
-    NoPilha* proximo;
+    *primeira = registros_primeira_desde(pilha->registros, inicio);
+    return registros_primeira_desde(pilha->registros, fim) - *primeira;
+}
 
-    // Percorre a pilha liberando cada nó
-    while (atual != NULL) {
-        proximo = atual->proximo;
-        free(atual);
-        atual = proximo;
+/**
+ * Decodifica a operação de uma posição da cronologia
+ */
+bool historico_obter(PilhaHistorico* pilha, int posicao, Operacao* saida) {
+    if (pilha == NULL || saida == NULL || posicao < 0 || posicao >= pilha->total) {
+        return false;
     }
 
-    free(pilha);
+    return registros_ler(pilha->registros, posicao, saida);
 }
 
-// =============================================================================
-// FUNÇÕES DE ALTO NÍVEL (LÓGICA DO SISTEMA)
-// =============================================================================
+/**
+ * Início (hora local) da hora ou do dia que contém o instante
+ */
+static time_t inicio_do_periodo(time_t instante, int periodo) {
+    struct tm data = *localtime(&instante);
+
+    data.tm_min = 0;
+    data.tm_sec = 0;
+    if (periodo == PERIODO_DIA) {
+        data.tm_hour = 0;
+    }
+    data.tm_isdst = -1;
+
+    return mktime(&data);
+}
 
 /**
- * Realiza o empréstimo de um livro
+ * Início do período seguinte (mktime normaliza virada de dia, mês e horário de verão)
  */
-int emprestar_livro(Biblioteca* bib, const char* titulo, const char* nome_leitor) {
-    if (bib == NULL || titulo == NULL || nome_leitor == NULL) {
-        return 1;
+static time_t proximo_periodo(time_t inicio, int periodo) {
+    struct tm data = *localtime(&inicio);
+
+    if (periodo == PERIODO_DIA) {
+        data.tm_mday++;
+    } else {
+        data.tm_hour++;
     }
+    data.tm_isdst = -1;
 
-    // Busca o livro no catálogo
-    NoLivro* no_livro = buscar_por_titulo(bib->catalogo, titulo);
+    time_t proximo = mktime(&data);
+    if (proximo <= inicio) {
+        proximo = inicio + (periodo == PERIODO_DIA ? 24 * 60 * 60 : 60 * 60);
+    }
+    return proximo;
+}
 
-    if (no_livro == NULL) {
-        printf("\nErro: Livro '%s' não encontrado no catálogo!\n", titulo);
-        return 1; // Livro não encontrado
+/**
+ * Conta as operações de um intervalo por hora ou por dia
+ */
+int historico_agregar(PilhaHistorico* pilha, time_t inicio, time_t fim, int periodo,
+                      ContagemPeriodo* saida, int max) {
+    if (pilha == NULL || saida == NULL || inicio >= fim ||
+        (periodo != PERIODO_HORA && periodo != PERIODO_DIA)) {
+        return 0;
     }
 
-    // Verifica se o livro está disponível
-    if (no_livro->dados.status) {
-        // Livro disponível - realiza o empréstimo
-        no_livro->dados.status = false;
-        strcpy(no_livro->dados.nome_leitor_atual, nome_leitor);
-        no_livro->dados.data_emprestimo = time(NULL);
+    int preenchidos = 0;
+    int posicao = registros_primeira_desde(pilha->registros, inicio);
+    time_t atual = inicio_do_periodo(inicio, periodo);
 
-        // Registra no histórico
-        empilhar(bib->historico, "EMPRESTIMO", titulo, nome_leitor);
+    while (atual < fim && preenchidos < max) {
+        time_t seguinte = proximo_periodo(atual, periodo);
+        int depois = registros_primeira_desde(pilha->registros, seguinte < fim ? seguinte : fim);
 
-        char data_str[30];
-        formatar_data(no_livro->dados.data_emprestimo, data_str, sizeof(data_str));
+        ContagemPeriodo* contagem = &saida[preenchidos++];
+        contagem->inicio = atual;
+        contagem->emprestimos = 0;
+        contagem->devolucoes = 0;
+        contagem->total = 0;
 
-        printf("\n✓ Empréstimo realizado com sucesso!\n");
-        printf("  Livro: %s\n", no_livro->dados.titulo);
-        printf("  Leitor: %s\n", nome_leitor);
-        printf("  Data: %s\n", data_str);
+        for (; posicao < depois; posicao++) {
+            const RegistroHistorico* registro = registros_obter(pilha->registros, posicao);
+            if (registro == NULL) {
+                return -1; // Segmento em disco ausente ou corrompido
+            }
+            contagem->total++;
+            if (registro->tipo == OPERACAO_EMPRESTIMO) {
+                contagem->emprestimos++;
+            } else if (registro->tipo == OPERACAO_DEVOLUCAO) {
+                contagem->devolucoes++;
+            }
+        }
 
-        return 0; // Sucesso
-    } else {
-        // Livro já emprestado - adiciona à fila de espera
-        enfileirar(bib->fila_espera, nome_leitor, titulo);
+        atual = seguinte;
+    }
 
-        int posicao = consultar_posicao(bib->fila_espera, nome_leitor, titulo);
+    return preenchidos;
+}
 
-        printf("\n⚠ Livro '%s' já está emprestado!\n", titulo);
-        printf("  Emprestado para: %s\n", no_livro->dados.nome_leitor_atual);
-        printf("  Você foi adicionado à fila de espera.\n");
-        printf("  Sua posição na fila: %d\n", posicao);
+/**
+ * Exibe as operações de um intervalo de tempo
+ */
+int exibir_historico_periodo(PilhaHistorico* pilha, time_t inicio, time_t fim) {
+    int primeira;
+    int total = historico_intervalo(pilha, inicio, fim, &primeira);
+
+    char inicio_str[30];
+    char fim_str[30];
+    char titulo[80];
+    formatar_data(inicio, inicio_str, sizeof(inicio_str));
+    formatar_data(fim, fim_str, sizeof(fim_str));
+    snprintf(titulo, sizeof(titulo), "HISTÓRICO DE %s A %s", inicio_str, fim_str);
+
+    SaidaRelatorio* saida = criar_saida(STDOUT_FILENO, saida_formato_padrao());
+    if (saida == NULL) {
+        printf("Erro: Falha ao alocar memória para o relatório!\n");
+        return 0;
+    }
+    saida_iniciar_relatorio(saida, titulo, COLUNAS_OPERACAO);
+
+    if (total == 0) {
+        saida_nota(saida, "Não há operações registradas neste período.\n");
+    }
 
-        return 2; // Livro já emprestado
+    Operacao operacao;
+    int exibidas = 0;
+    for (; exibidas < total; exibidas++) {
+        if (!historico_obter(pilha, primeira + exibidas, &operacao)) {
+            saida_nota(saida, "\nErro: Não foi possível ler o histórico gravado em disco!\n");
+            break;
+        }
+        escrever_operacao(saida, &operacao);
     }
+    if (exibidas > 0) {
+        saida_nota(saida, "\nTotal de operações no período: %d\n", exibidas);
+    }
+
+    saida_terminar_relatorio(saida);
+    liberar_saida(saida);
+    return exibidas;
 }
 
 /**
- * Realiza a devolução de um livro
+ * Exibe o movimento de um intervalo por hora ou por dia
  */
-int devolver_livro(Biblioteca* bib, const char* titulo) {
-    if (bib == NULL || titulo == NULL) {
-        return 1;
+void exibir_movimento_historico(PilhaHistorico* pilha, time_t inicio, time_t fim, int periodo) {
+    if (pilha == NULL || inicio >= fim) {
+        printf("\nPeríodo inválido!\n");
+        return;
     }
 
-    // Busca o livro no catálogo
-    NoLivro* no_livro = buscar_por_titulo(bib->catalogo, titulo);
-
-    if (no_livro == NULL) {
-        printf("\nErro: Livro '%s' não encontrado no catálogo!\n", titulo);
-        return 1; // Livro não encontrado
+    // Conta quantos períodos cabem no intervalo para alocar o vetor
+    int periodos = 0;
+    for (time_t atual = inicio_do_periodo(inicio, periodo); atual < fim;
+         atual = proximo_periodo(atual, periodo)) {
+        periodos++;
     }
 
-    // Verifica se o livro está emprestado
-    if (!no_livro->dados.status) {
-        // Salva o nome do leitor antes de limpar
-        char leitor_anterior[MAX_NOME_LEITOR];
-        strcpy(leitor_anterior, no_livro->dados.nome_leitor_atual);
+    ContagemPeriodo* contagens = (ContagemPeriodo*)malloc(periodos * sizeof(ContagemPeriodo));
+    if (contagens == NULL) {
+        printf("Erro: Falha ao alocar memória!\n");
+        return;
+    }
 
-        // Marca como disponível
-        no_livro->dados.status = true;
-        strcpy(no_livro->dados.nome_leitor_atual, "");
-        no_livro->dados.data_emprestimo = 0;
+    int preenchidos = historico_agregar(pilha, inicio, fim, periodo, contagens, periodos);
+    if (preenchidos < 0) {
+        printf("\nErro: Não foi possível ler o histórico gravado em disco!\n");
+        free(contagens);
+        return;
+    }
+    int emprestimos = 0;
+    int devolucoes = 0;
+    int total = 0;
 
-        // Registra no histórico
-        empilhar(bib->historico, "DEVOLUCAO", titulo, leitor_anterior);
+    printf("\n=== MOVIMENTO POR %s ===\n", periodo == PERIODO_DIA ? "DIA" : "HORA");
 
-        printf("\n✓ Devolução realizada com sucesso!\n");
-        printf("  Livro: %s\n", no_livro->dados.titulo);
-        printf("  Devolvido por: %s\n", leitor_anterior);
+    for (int i = 0; i < preenchidos; i++) {
+        char periodo_str[30];
+        strftime(periodo_str, sizeof(periodo_str),
+                 periodo == PERIODO_DIA ? "%d/%m/%Y" : "%d/%m/%Y %Hh",
+                 localtime(&contagens[i].inicio));
 
-        // Verifica se há alguém na fila de espera
-        char proximo_leitor[MAX_NOME_LEITOR];
-        if (desenfileirar_especifico(bib->fila_espera, titulo, proximo_leitor)) {
-            printf("\n📢 NOTIFICAÇÃO:\n");
-            printf("  O leitor '%s' estava aguardando este livro.\n", proximo_leitor);
-            printf("  Por favor, notifique-o que o livro está disponível!\n");
-        }
+        printf("%s - Empréstimos: %d | Devoluções: %d | Total: %d\n", periodo_str,
+               contagens[i].emprestimos, contagens[i].devolucoes, contagens[i].total);
 
-        return 0; // Sucesso
-    } else {
-        printf("\nErro: O livro '%s' já está disponível (não estava emprestado)!\n", titulo);
-        return 2; // Livro já disponível
+        emprestimos += contagens[i].emprestimos;
+        devolucoes += contagens[i].devolucoes;
+        total += contagens[i].total;
     }
+
+    printf("\nNo período: %d empréstimo(s), %d devolução(ões), %d operação(ões)\n",
+           emprestimos, devolucoes, total);
+    free(contagens);
 }
 
 /**
- * Exibe um relatório completo do sistema
+ * Exibe todo o histórico de operações para um livro específico
  */
-void relatorio_sistema(Biblioteca* bib) {
-    if (bib == NULL) {
-        printf("\nErro: Sistema não inicializado!\n");
-        return;
+int historico_livro(PilhaHistorico* pilha, const char* titulo_livro) {
+    if (pilha == NULL || titulo_livro == NULL || pilha->total == 0) {
+        printf("\nO histórico está vazio!\n");
+        return 0;
     }
 
-    // Conta livros disponíveis e emprestados
-    int disponiveis = 0;
-    int emprestados = 0;
+    SaidaRelatorio* saida = criar_saida(STDOUT_FILENO, saida_formato_padrao());
+    if (saida == NULL) {
+        printf("Erro: Falha ao alocar memória para o relatório!\n");
+        return 0;
+    }
 
-    NoLivro* atual = bib->catalogo->cabeca;
-    while (atual != NULL) {
-        if (atual->dados.status) {
-            disponiveis++;
-        } else {
-            emprestados++;
+    char titulo[MAX_TITULO + 32];
+    snprintf(titulo, sizeof(titulo), "HISTÓRICO DO LIVRO: %s", titulo_livro);
+    saida_iniciar_relatorio(saida, titulo, "operacao,leitor,data");
+
+    // Ids do título (sem diferenciar maiúsculas); os registros são filtrados pelo id
+    bool* mesmo_titulo = registros_marcar_titulo(pilha->registros, titulo_livro);
+    int encontrados = 0;
+
+    // Percorre do mais recente ao mais antigo; segmentos em disco sem o título são pulados
+    int posicao = registros_anterior_com_titulo(pilha->registros, mesmo_titulo, pilha->total - 1);
+    for (; posicao >= 0;
+         posicao = registros_anterior_com_titulo(pilha->registros, mesmo_titulo, posicao - 1)) {
+        Operacao operacao;
+        if (!registros_ler(pilha->registros, posicao, &operacao)) {
+            break;
         }
-        atual = atual->proximo;
+        encontrados++;
+
+        saida_iniciar_registro(saida);
+        saida_campo_texto(saida, "Operação", "operacao", operacao.tipo_operacao);
+        saida_campo_texto(saida, "Leitor", "leitor", operacao.nome_leitor);
+        saida_campo_data(saida, "Data/Hora", "data", operacao.data_operacao);
+        saida_terminar_registro(saida);
     }
+    free(mesmo_titulo);
 
-    // Exibe o relatório
-    printf("\n");
-    printf("╔════════════════════════════════════════════════════════╗\n");
-    printf("║       RELATÓRIO DO SISTEMA DE BIBLIOTECA              ║\n");
-    printf("╠════════════════════════════════════════════════════════╣\n");
-    printf("║ Total de livros no catálogo:        %-5d            ║\n", bib->catalogo->total);
-    printf("║ Livros disponíveis:                 %-5d            ║\n", disponiveis);
-    printf("║ Livros emprestados:                 %-5d            ║\n", emprestados);
-    printf("║ Leitores na fila de espera:         %-5d            ║\n", bib->fila_espera->total);
-    printf("║ Operações registradas no histórico: %-5d            ║\n", bib->historico->total);
+    if (encontrados == 0) {
+        saida_nota(saida, "Não há operações registradas para este livro.\n");
+    } else {
+        saida_nota(saida, "\nTotal de operações encontradas: %d\n", encontrados);
+    }
+
+    saida_terminar_relatorio(saida);
+    liberar_saida(saida);
+    return encontrados;
+}
+
+/**
+ * Ativa o arquivamento em disco das operações antigas
+ */
+bool historico_ativar_arquivamento(PilhaHistorico* pilha, const char* prefixo, int operacoes_em_memoria) {
+    if (pilha == NULL) {
+        return false;
+    }
+    return registros_ativar_arquivamento(pilha->registros, prefixo, operacoes_em_memoria);
+}
+
+/**
+ * Libera toda a memória da pilha de histórico
+ */
+void liberar_pilha_historico(PilhaHistorico* pilha) {
+    if (pilha == NULL) return;
+
+    liberar_registros_historico(pilha->registros);
+    free(pilha);
+}
+
+// =============================================================================
+// FUNÇÕES DE ALTO NÍVEL (LÓGICA DO SISTEMA)
+// =============================================================================
+
+/**
+ * Atualiza o status do título (true = há exemplar livre)
+ */
+static void atualizar_status(NoLivro* no_livro) {
+    no_livro->dados.status = no_livro->total_livres > 0;
+}
+
+/**
+ * Retira um exemplar livre do topo da pilha (O(1))
+ */
+static Exemplar* retirar_exemplar_livre(NoLivro* no_livro) {
+    if (no_livro->total_livres == 0) {
+        return NULL;
+    }
+
+    no_livro->total_livres--;
+    Exemplar* exemplar = &no_livro->exemplares[no_livro->livres[no_livro->total_livres]];
+    atualizar_status(no_livro);
+    return exemplar;
+}
+
+/**
+ * Devolve um exemplar ao topo da pilha de livres (O(1))
+ */
+static void guardar_exemplar_livre(Exemplar* exemplar) {
+    NoLivro* no_livro = exemplar->livro;
+    no_livro->livres[no_livro->total_livres] = exemplar->numero - 1;
+    no_livro->total_livres++;
+    atualizar_status(no_livro);
+}
+
+/**
+ * Retira a reserva de um exemplar (se houver)
+ */
+static void cancelar_reserva(ListaLivros* lista, Exemplar* exemplar) {
+    if (strlen(exemplar->nome_reserva) > 0) {
+        exemplar->livro->total_separados--;
+    }
+    strcpy(exemplar->nome_reserva, "");
+    exemplar->fim_reserva = 0;
+    roda_reservas_remover(lista->reservas, exemplar);
+    paginas_marcar(lista->paginas, exemplar->livro);
+}
+
+/**
+ * Separa o exemplar para o próximo leitor da fila daquele título (sem mensagens)
+ * Retorna: true se havia alguém na fila
+ */
+static bool reservar_para_proximo(Biblioteca* bib, Exemplar* exemplar) {
+    char proximo_leitor[MAX_NOME_LEITOR];
+    if (!desenfileirar_especifico(bib->fila_espera, exemplar->livro->dados.titulo, proximo_leitor)) {
+        return false;
+    }
+
+    strcpy(exemplar->nome_reserva, proximo_leitor);
+    exemplar->fim_reserva = time(NULL) + PRAZO_RESERVA_HORAS * 3600;
+    exemplar->livro->total_separados++;
+    roda_reservas_adicionar(bib->catalogo->reservas, exemplar);
+    paginas_marcar(bib->catalogo->paginas, exemplar->livro);
+    return true;
+}
+
+/**
+ * Separa o exemplar para o próximo leitor da fila e avisa quem foi notificado
+ * Retorna: true se havia alguém na fila
+ */
+static bool separar_para_proximo(Biblioteca* bib, Exemplar* exemplar) {
+    if (!reservar_para_proximo(bib, exemplar)) {
+        return false;
+    }
+
+    char data_str[30];
+    formatar_data(exemplar->fim_reserva, data_str, sizeof(data_str));
+
+    printf("\n📢 NOTIFICAÇÃO:\n");
+    printf("  O leitor '%s' estava aguardando '%s'.\n", exemplar->nome_reserva,
+           exemplar->livro->dados.titulo);
+    printf("  O exemplar %d foi separado para ele até %s.\n", exemplar->numero, data_str);
+    return true;
+}
+
+/**
+ * Procura um exemplar do título separado para o leitor
+ */
+static Exemplar* exemplar_separado_para(NoLivro* no_livro, const char* nome_leitor) {
+    if (no_livro->total_separados == 0) {
+        return NULL;
+    }
+
+    for (int i = 0; i < no_livro->dados.quantidade; i++) {
+        Exemplar* exemplar = &no_livro->exemplares[i];
+        if (strlen(exemplar->nome_reserva) > 0 && iguais_sem_caixa(exemplar->nome_reserva, nome_leitor)) {
+            return exemplar;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Marca um exemplar como emprestado ao leitor e registra o prazo de devolução
+ */
+static void registrar_emprestimo(Biblioteca* bib, Exemplar* exemplar, Leitor* leitor,
+                                 const char* nome_leitor) {
+    exemplar->status = false;
+    strcpy(exemplar->nome_leitor_atual, nome_leitor);
+    exemplar->data_emprestimo = time(NULL);
+    exemplar->data_devolucao_prevista = exemplar->data_emprestimo +
+                                        PRAZO_EMPRESTIMO_DIAS * SEGUNDOS_POR_DIA;
+    leitor_vincular_emprestimo(leitor, exemplar);
+    prazos_registrar(bib->catalogo->prazos, exemplar);
+    exemplar->livro->total_emprestimos++;
+    analises_registrar_emprestimo(bib->analises, exemplar->livro);
+    paginas_marcar(bib->catalogo->paginas, exemplar->livro);
+}
+
+/**
+ * Marca um exemplar como não emprestado e retira seu prazo de devolução
+ */
+static void encerrar_emprestimo(Biblioteca* bib, Exemplar* exemplar) {
+    analises_registrar_devolucao(bib->analises, exemplar->livro, time(NULL) - exemplar->data_emprestimo);
+    exemplar->status = true;
+    strcpy(exemplar->nome_leitor_atual, "");
+    exemplar->data_emprestimo = 0;
+    exemplar->data_devolucao_prevista = 0;
+    leitor_desvincular_emprestimo(exemplar);
+    prazos_remover(bib->catalogo->prazos, exemplar);
+    paginas_marcar(bib->catalogo->paginas, exemplar->livro);
+}
+
+/**
+ * Restaura os empréstimos e reservas de um título recuperado de um ponto de controle
+ */
+bool restaurar_situacao_livro(Biblioteca* bib, NoLivro* no_livro, const Exemplar* situacao) {
+    no_livro->total_livres = 0;
+    no_livro->total_separados = 0;
+
+    // De trás para frente, para o exemplar 1 ficar no topo da pilha de livres
+    for (int i = no_livro->dados.quantidade - 1; i >= 0; i--) {
+        Exemplar* exemplar = &no_livro->exemplares[i];
+
+        if (!situacao[i].status) {
+            Leitor* leitor = obter_leitor(bib->leitores, situacao[i].nome_leitor_atual);
+            if (leitor == NULL) {
+                return false;
+            }
+            exemplar->status = false;
+            strcpy(exemplar->nome_leitor_atual, situacao[i].nome_leitor_atual);
+            exemplar->data_emprestimo = situacao[i].data_emprestimo;
+            exemplar->data_devolucao_prevista = situacao[i].data_devolucao_prevista;
+            leitor_vincular_emprestimo(leitor, exemplar);
+            if (!prazos_registrar(bib->catalogo->prazos, exemplar)) {
+                return false;
+            }
+        } else if (strlen(situacao[i].nome_reserva) > 0) {
+            strcpy(exemplar->nome_reserva, situacao[i].nome_reserva);
+            exemplar->fim_reserva = situacao[i].fim_reserva;
+            no_livro->total_separados++;
+            roda_reservas_adicionar(bib->catalogo->reservas, exemplar);
+        } else {
+            no_livro->livres[no_livro->total_livres++] = i;
+        }
+    }
+
+    atualizar_status(no_livro);
+    return true;
+}
+
+/**
+ * Empresta um livro já localizado no catálogo (comum às buscas por título e por ISBN)
+ */
+static int emprestar_no(Biblioteca* bib, NoLivro* no_livro, const char* nome_leitor) {
+    const char* titulo = no_livro->dados.titulo;
+
+    // Um exemplar separado só pode ser retirado pelo leitor da reserva
+    Exemplar* separado = exemplar_separado_para(no_livro, nome_leitor);
+
+    // Verifica se há exemplar para o leitor
+    if (separado != NULL || no_livro->total_livres > 0) {
+        // Verifica o limite de empréstimos do leitor (sem percorrer o catálogo)
+        Leitor* leitor = obter_leitor(bib->leitores, nome_leitor);
+        if (leitor == NULL) {
+            printf("\nErro: Não foi possível cadastrar o leitor '%s'!\n", nome_leitor);
+            return 4; // Sem leitor não há como controlar o limite nem devolver
+        }
+        if (!leitor_pode_emprestar(bib->leitores, leitor)) {
+            printf("\nErro: O leitor '%s' já está com %d livro(s) emprestado(s) (limite: %d)!\n",
+                   nome_leitor, leitor->total_emprestimos, bib->leitores->limite_emprestimos);
+            return 3; // Limite de empréstimos atingido
+        }
+
+        Exemplar* exemplar;
+        if (separado != NULL) {
+            // O leitor da reserva veio buscar o exemplar
+            cancelar_reserva(bib->catalogo, separado);
+            exemplar = separado;
+        } else {
+            exemplar = retirar_exemplar_livre(no_livro);
+        }
+
+        // Realiza o empréstimo do exemplar
+        registrar_emprestimo(bib, exemplar, leitor, nome_leitor);
+
+        // Atualiza a popularidade usada nas sugestões de títulos
+        trie_titulos_atualizar(bib->catalogo->trie_titulos, no_livro);
+
+        // Registra no histórico
+        empilhar(bib->historico, "EMPRESTIMO", titulo, nome_leitor);
+
+        char data_str[30];
+        char prazo_str[30];
+        formatar_data(exemplar->data_emprestimo, data_str, sizeof(data_str));
+        formatar_data(exemplar->data_devolucao_prevista, prazo_str, sizeof(prazo_str));
+
+        printf("\n✓ Empréstimo realizado com sucesso!\n");
+        printf("  Livro: %s (exemplar %d de %d)\n", titulo, exemplar->numero, no_livro->dados.quantidade);
+        printf("  Leitor: %s\n", nome_leitor);
+        printf("  Data: %s\n", data_str);
+        printf("  Devolver até: %s\n", prazo_str);
+
+        return 0; // Sucesso
+    } else {
+        // Todos os exemplares emprestados ou separados - adiciona à fila de espera (sem duplicar)
+        bool ja_estava = filas_buscar_solicitacao(bib->fila_espera->por_titulo,
+                                                  nome_leitor, titulo) != NULL;
+        enfileirar(bib->fila_espera, nome_leitor, titulo);
+
+        int posicao = consultar_posicao(bib->fila_espera, nome_leitor, titulo);
+        int emprestados = no_livro->dados.quantidade - no_livro->total_separados;
+
+        printf("\n⚠ Nenhum exemplar de '%s' está livre!\n", titulo);
+        printf("  Exemplares emprestados: %d, separados para a fila: %d\n",
+               emprestados, no_livro->total_separados);
+        if (ja_estava) {
+            printf("  Você já estava na fila de espera deste livro.\n");
+        } else {
+            printf("  Você foi adicionado à fila de espera.\n");
+        }
+        printf("  Sua posição na fila: %d\n", posicao);
+
+        return 2; // Nenhum exemplar livre
+    }
+}
+
+/**
+ * Devolve um exemplar emprestado
+ */
+static int devolver_exemplar(Biblioteca* bib, Exemplar* exemplar) {
+    const char* titulo = exemplar->livro->dados.titulo;
+
+    // Salva o nome do leitor antes de limpar
+    char leitor_anterior[MAX_NOME_LEITOR];
+    strcpy(leitor_anterior, exemplar->nome_leitor_atual);
+
+    // Marca o exemplar como não emprestado
+    encerrar_emprestimo(bib, exemplar);
+
+    // Registra no histórico
+    empilhar(bib->historico, "DEVOLUCAO", titulo, leitor_anterior);
+
+    printf("\n✓ Devolução realizada com sucesso!\n");
+    printf("  Livro: %s (exemplar %d)\n", titulo, exemplar->numero);
+    printf("  Devolvido por: %s\n", leitor_anterior);
+
+    // Se há alguém na fila de espera, o exemplar fica separado para ele;
+    // senão volta para a pilha de livres
+    if (!separar_para_proximo(bib, exemplar)) {
+        guardar_exemplar_livre(exemplar);
+    }
+
+    return 0; // Sucesso
+}
+
+/**
+ * Devolve um livro já localizado no catálogo (comum às buscas por título e por ISBN)
+ * Sem o nome do leitor, só é possível quando um único exemplar está emprestado.
+ */
+static int devolver_no(Biblioteca* bib, NoLivro* no_livro) {
+    Exemplar* emprestado = NULL;
+    int emprestados = 0;
+
+    for (int i = 0; i < no_livro->dados.quantidade; i++) {
+        if (!no_livro->exemplares[i].status) {
+            emprestado = &no_livro->exemplares[i];
+            emprestados++;
+        }
+    }
+
+    if (emprestados == 0) {
+        printf("\nErro: O livro '%s' já está disponível (não estava emprestado)!\n",
+               no_livro->dados.titulo);
+        return 2; // Nenhum exemplar emprestado
+    }
+    if (emprestados > 1) {
+        printf("\nErro: Há %d exemplares de '%s' emprestados; informe o leitor que está devolvendo!\n",
+               emprestados, no_livro->dados.titulo);
+        return 3; // É preciso saber qual exemplar está voltando
+    }
+
+    return devolver_exemplar(bib, emprestado);
+}
+
+/**
+ * Realiza o empréstimo de um livro
+ */
+int emprestar_livro(Biblioteca* bib, const char* titulo, const char* nome_leitor) {
+    if (bib == NULL || titulo == NULL || nome_leitor == NULL) {
+        return 1;
+    }
+
+    // Busca o livro no catálogo
+    NoLivro* no_livro = buscar_por_titulo(bib->catalogo, titulo);
+
+    if (no_livro == NULL) {
+        printf("\nErro: Livro '%s' não encontrado no catálogo!\n", titulo);
+        return 1; // Livro não encontrado
+    }
+
+    return emprestar_no(bib, no_livro, nome_leitor);
+}
+
+/**
+ * Realiza o empréstimo de um livro identificado pelo ISBN
+ */
+int emprestar_livro_isbn(Biblioteca* bib, const char* isbn, const char* nome_leitor) {
+    if (bib == NULL || isbn == NULL || nome_leitor == NULL) {
+        return 1;
+    }
+
+    NoLivro* no_livro = buscar_por_isbn(bib->catalogo, isbn);
+
+    if (no_livro == NULL) {
+        printf("\nErro: Nenhum livro com ISBN '%s' no catálogo!\n", isbn);
+        return 1; // Livro não encontrado
+    }
+
+    return emprestar_no(bib, no_livro, nome_leitor);
+}
+
+/**
+ * Realiza a devolução de um livro
+ */
+int devolver_livro(Biblioteca* bib, const char* titulo) {
+    if (bib == NULL || titulo == NULL) {
+        return 1;
+    }
+
+    // Busca o livro no catálogo
+    NoLivro* no_livro = buscar_por_titulo(bib->catalogo, titulo);
+
+    if (no_livro == NULL) {
+        printf("\nErro: Livro '%s' não encontrado no catálogo!\n", titulo);
+        return 1; // Livro não encontrado
+    }
+
+    return devolver_no(bib, no_livro);
+}
+
+/**
+ * Realiza a devolução do exemplar que está com um leitor
+ */
+int devolver_livro_leitor(Biblioteca* bib, const char* titulo, const char* nome_leitor) {
+    if (bib == NULL || titulo == NULL || nome_leitor == NULL) {
+        return 1;
+    }
+
+    NoLivro* no_livro = buscar_por_titulo(bib->catalogo, titulo);
+
+    if (no_livro == NULL) {
+        printf("\nErro: Livro '%s' não encontrado no catálogo!\n", titulo);
+        return 1; // Livro não encontrado
+    }
+
+    // Procura o exemplar entre os empréstimos do leitor (sem percorrer os exemplares)
+    Leitor* leitor = buscar_leitor(bib->leitores, nome_leitor);
+    Exemplar* exemplar = leitor != NULL ? leitor->emprestimos : NULL;
+    while (exemplar != NULL && exemplar->livro != no_livro) {
+        exemplar = exemplar->proximo_do_leitor;
+    }
+
+    if (exemplar == NULL) {
+        printf("\nErro: O leitor '%s' não está com o livro '%s'!\n", nome_leitor, no_livro->dados.titulo);
+        return 2; // O leitor não está com o livro
+    }
+
+    return devolver_exemplar(bib, exemplar);
+}
+
+/**
+ * Realiza a devolução de um livro identificado pelo ISBN
+ */
+int devolver_livro_isbn(Biblioteca* bib, const char* isbn) {
+    if (bib == NULL || isbn == NULL) {
+        return 1;
+    }
+
+    NoLivro* no_livro = buscar_por_isbn(bib->catalogo, isbn);
+
+    if (no_livro == NULL) {
+        printf("\nErro: Nenhum livro com ISBN '%s' no catálogo!\n", isbn);
+        return 1; // Livro não encontrado
+    }
+
+    return devolver_no(bib, no_livro);
+}
+
+/**
+ * Notifica os empréstimos que venceram desde a última verificação
+ */
+int verificar_atrasos(Biblioteca* bib) {
+    if (bib == NULL) {
+        return 0;
+    }
+
+    time_t agora = time(NULL);
+    Exemplar* vencidos[LOTE_VARREDURA];
+    int total = 0;
+    int encontrados;
+
+    // Só olha o topo do heap de prazos; processa em lotes até não haver mais vencidos
+    do {
+        encontrados = prazos_varrer(bib->catalogo->prazos, agora, vencidos, LOTE_VARREDURA);
+
+        for (int i = 0; i < encontrados; i++) {
+            char data_str[30];
+            formatar_data(vencidos[i]->data_devolucao_prevista, data_str, sizeof(data_str));
+
+            if (total == 0) {
+                printf("\n📢 NOTIFICAÇÃO DE ATRASO:\n");
+            }
+            printf("  '%s' (exemplar %d) deveria ter sido devolvido por %s até %s.\n",
+                   vencidos[i]->livro->dados.titulo, vencidos[i]->numero,
+                   vencidos[i]->nome_leitor_atual, data_str);
+            total++;
+        }
+    } while (encontrados == LOTE_VARREDURA);
+
+    return total;
+}
+
+/**
+ * Encerra as reservas expiradas, passando cada exemplar ao próximo da fila
+ */
+int verificar_reservas(Biblioteca* bib) {
+    if (bib == NULL) {
+        return 0;
+    }
+
+    Exemplar* expiradas[LOTE_VARREDURA];
+    int total = 0;
+    int encontradas;
+
+    // A roda entrega só as reservas vencidas, sem percorrer o catálogo
+    do {
+        encontradas = roda_reservas_avancar(bib->catalogo->reservas, time(NULL),
+                                            expiradas, LOTE_VARREDURA);
+
+        for (int i = 0; i < encontradas; i++) {
+            Exemplar* exemplar = expiradas[i];
+
+            printf("\n⏰ A reserva de '%s' (exemplar %d) para '%s' expirou sem retirada.\n",
+                   exemplar->livro->dados.titulo, exemplar->numero, exemplar->nome_reserva);
+            cancelar_reserva(bib->catalogo, exemplar);
+
+            if (!separar_para_proximo(bib, exemplar)) {
+                guardar_exemplar_livre(exemplar);
+                printf("  Ninguém mais na fila: o exemplar voltou a ficar disponível.\n");
+            }
+            total++;
+        }
+    } while (encontradas == LOTE_VARREDURA);
+
+    return total;
+}
+
+// =============================================================================
+// OPERAÇÕES EM LOTE
+// =============================================================================
+
+/**
+ * Item de um lote: o livro localizado e a posição do item no vetor original
+ */
+typedef struct {
+    NoLivro* livro;
+    int indice;
+} ItemLote;
+
+/**
+ * Comparador para qsort: agrupa os itens por livro, mantendo a ordem original
+ */
+static int comparar_itens_lote(const void* a, const void* b) {
+    const ItemLote* item_a = (const ItemLote*)a;
+    const ItemLote* item_b = (const ItemLote*)b;
+    uintptr_t livro_a = (uintptr_t)item_a->livro;
+    uintptr_t livro_b = (uintptr_t)item_b->livro;
+    if (livro_a != livro_b) {
+        return (livro_a > livro_b) - (livro_a < livro_b);
+    }
+    return item_a->indice - item_b->indice;
+}
+
+/**
+ * Localiza cada item do lote (ISBN ou título) e agrupa os itens do mesmo livro
+ * Cada item custa uma consulta ao índice de ISBN ou uma descida na árvore de
+ * títulos, nunca uma volta pela lista. Os itens não encontrados (ou com texto
+ * maior que um título) recebem o código 1 e ficam no início do vetor.
+ */
+static ItemLote* agrupar_lote(ListaLivros* lista, const char* itens[], int total, int codigos[]) {
+    ItemLote* lote = (ItemLote*)malloc(total * sizeof(ItemLote));
+    if (lote == NULL) {
+        return NULL;
+    }
+
+    for (int i = 0; i < total; i++) {
+        NoLivro* livro = NULL;
+        if (itens[i] != NULL && strlen(itens[i]) < MAX_TITULO) {
+            if (normalizar_isbn(itens[i]) != 0) {
+                livro = buscar_por_isbn(lista, itens[i]);
+            }
+            if (livro == NULL) {
+                livro = trie_titulos_buscar(lista->trie_titulos, itens[i]);
+            }
+        }
+
+        lote[i].livro = livro;
+        lote[i].indice = i;
+        codigos[i] = 1; // Livro não encontrado, até ser processado
+    }
+
+    qsort(lote, total, sizeof(ItemLote), comparar_itens_lote);
+    return lote;
+}
+
+/**
+ * Comparador para qsort: empréstimos mais antigos primeiro (empate: menor número de exemplar)
+ */
+static int comparar_emprestimos_antigos(const void* a, const void* b) {
+    const Exemplar* exemplar_a = *(Exemplar* const*)a;
+    const Exemplar* exemplar_b = *(Exemplar* const*)b;
+    if (exemplar_a->data_emprestimo != exemplar_b->data_emprestimo) {
+        return exemplar_a->data_emprestimo < exemplar_b->data_emprestimo ? -1 : 1;
+    }
+    return exemplar_a->numero - exemplar_b->numero;
+}
+
+/**
+ * Preenche uma operação do histórico
+ */
+static void preencher_operacao(Operacao* operacao, const char* tipo_operacao,
+                               const char* titulo_livro, const char* nome_leitor) {
+    strcpy(operacao->tipo_operacao, tipo_operacao);
+    strcpy(operacao->titulo_livro, titulo_livro);
+    strcpy(operacao->nome_leitor, nome_leitor);
+    operacao->data_operacao = 0;
+}
+
+/**
+ * Empresta vários livros de uma vez
+ */
+int emprestar_lote(Biblioteca* bib, const char* itens[], const char* nomes_leitores[],
+                   int total, int codigos[]) {
+    if (bib == NULL || itens == NULL || nomes_leitores == NULL || codigos == NULL || total <= 0) {
+        return 0;
+    }
+
+    ItemLote* lote = agrupar_lote(bib->catalogo, itens, total, codigos);
+    Operacao* operacoes = (Operacao*)malloc(total * sizeof(Operacao));
+    if (lote == NULL || operacoes == NULL) {
+        printf("Erro: Falha ao alocar memória para o lote!\n");
+        free(lote);
+        free(operacoes);
+        return -1;
+    }
+
+    int realizados = 0;
+    int inicio = 0;
+
+    while (inicio < total) {
+        NoLivro* livro = lote[inicio].livro;
+        int fim = inicio;
+        while (fim < total && lote[fim].livro == livro) {
+            fim++;
+        }
+
+        if (livro != NULL) {
+            int emprestimos_antes = livro->total_emprestimos;
+
+            for (int k = inicio; k < fim; k++) {
+                int indice = lote[k].indice;
+                const char* nome_leitor = nomes_leitores[indice];
+                if (nome_leitor == NULL || strlen(nome_leitor) >= MAX_NOME_LEITOR) {
+                    codigos[indice] = 4; // Leitor que não pode ser cadastrado
+                    continue;
+                }
+
+                // Sem exemplar para o leitor: entra na fila de espera (sem duplicar)
+                Exemplar* exemplar = exemplar_separado_para(livro, nome_leitor);
+                if (exemplar == NULL && livro->total_livres == 0) {
+                    enfileirar(bib->fila_espera, nome_leitor, livro->dados.titulo);
+                    codigos[indice] = 2;
+                    continue;
+                }
+
+                Leitor* leitor = obter_leitor(bib->leitores, nome_leitor);
+                if (leitor == NULL) {
+                    codigos[indice] = 4;
+                    continue;
+                }
+                if (!leitor_pode_emprestar(bib->leitores, leitor)) {
+                    codigos[indice] = 3;
+                    continue;
+                }
+
+                if (exemplar != NULL) {
+                    cancelar_reserva(bib->catalogo, exemplar);
+                } else {
+                    exemplar = retirar_exemplar_livre(livro);
+                }
+                registrar_emprestimo(bib, exemplar, leitor, nome_leitor);
+
+                preencher_operacao(&operacoes[realizados], "EMPRESTIMO", livro->dados.titulo, nome_leitor);
+                codigos[indice] = 0;
+                realizados++;
+            }
+
+            // A posição do título nas sugestões é atualizada uma vez por grupo
+            if (livro->total_emprestimos != emprestimos_antes) {
+                trie_titulos_atualizar(bib->catalogo->trie_titulos, livro);
+            }
+        }
+
+        inicio = fim;
+    }
+
+    empilhar_lote(bib->historico, operacoes, realizados);
+
+    free(operacoes);
+    free(lote);
+    return realizados;
+}
+
+/**
+ * Devolve vários livros de uma vez
+ */
+int devolver_lote(Biblioteca* bib, const char* itens[], int total, int codigos[]) {
+    if (bib == NULL || itens == NULL || codigos == NULL || total <= 0) {
+        return 0;
+    }
+
+    ItemLote* lote = agrupar_lote(bib->catalogo, itens, total, codigos);
+    Operacao* operacoes = (Operacao*)malloc(total * sizeof(Operacao));
+    if (lote == NULL || operacoes == NULL) {
+        printf("Erro: Falha ao alocar memória para o lote!\n");
+        free(lote);
+        free(operacoes);
+        return -1;
+    }
+
+    int realizadas = 0;
+    int inicio = 0;
+    bool faltou_memoria = false;
+
+    while (inicio < total) {
+        NoLivro* livro = lote[inicio].livro;
+        int fim = inicio;
+        while (fim < total && lote[fim].livro == livro) {
+            fim++;
+        }
+
+        if (livro != NULL) {
+            // Exemplares emprestados, do empréstimo mais antigo ao mais recente
+            Exemplar** emprestados = (Exemplar**)malloc(livro->dados.quantidade * sizeof(Exemplar*));
+            if (emprestados == NULL) {
+                printf("Erro: Falha ao alocar memória para o lote!\n");
+                faltou_memoria = true;
+                break;
+            }
+            int total_emprestados = 0;
+            for (int i = 0; i < livro->dados.quantidade; i++) {
+                if (!livro->exemplares[i].status) {
+                    emprestados[total_emprestados++] = &livro->exemplares[i];
+                }
+            }
+            qsort(emprestados, total_emprestados, sizeof(Exemplar*), comparar_emprestimos_antigos);
+
+            // Cada item devolve exatamente um exemplar, na ordem dos itens; a fila
+            // do título é consultada só enquanto ainda houver alguém aguardando
+            bool tem_fila = filas_buscar(bib->fila_espera->por_titulo, livro->dados.titulo) != NULL;
+            for (int k = inicio; k < fim; k++) {
+                if (k - inicio >= total_emprestados) {
+                    codigos[lote[k].indice] = 2; // Item a mais que exemplares emprestados
+                    continue;
+                }
+
+                Exemplar* exemplar = emprestados[k - inicio];
+                preencher_operacao(&operacoes[realizadas], "DEVOLUCAO", livro->dados.titulo,
+                                   exemplar->nome_leitor_atual);
+                encerrar_emprestimo(bib, exemplar);
+
+                if (!tem_fila || !reservar_para_proximo(bib, exemplar)) {
+                    tem_fila = false;
+                    guardar_exemplar_livre(exemplar);
+                }
+
+                codigos[lote[k].indice] = 0;
+                realizadas++;
+            }
+            free(emprestados);
+        }
+
+        inicio = fim;
+    }
+
+    // O que já voltou entra no histórico mesmo se o lote parou no meio
+    empilhar_lote(bib->historico, operacoes, realizadas);
+
+    free(operacoes);
+    free(lote);
+    return faltou_memoria ? -1 : realizadas;
+}
+
+/**
+ * Define a classe de prioridade de um leitor e de suas solicitações na fila
+ */
+bool definir_prioridade_leitor(Biblioteca* bib, const char* nome_leitor, int prioridade) {
+    if (bib == NULL || nome_leitor == NULL) {
+        return false;
+    }
+
+    Leitor* leitor = obter_leitor(bib->leitores, nome_leitor);
+    if (leitor == NULL) {
+        return false;
+    }
+
+    leitor->prioridade = prioridade;
+
+    // As solicitações já feitas mudam de lugar na fila do título
+    NoFila* solicitacao = leitor->solicitacoes;
+    while (solicitacao != NULL) {
+        solicitacao->dados.prioridade = prioridade;
+        filas_reposicionar(bib->fila_espera->por_titulo, solicitacao);
+        solicitacao = solicitacao->proximo_do_leitor;
+    }
+
+    return true;
+}
+
+/**
+ * Exibe um relatório completo do sistema
+ */
+void relatorio_sistema(Biblioteca* bib) {
+    if (bib == NULL) {
+        printf("\nErro: Sistema não inicializado!\n");
+        return;
+    }
+
+    // Conta os exemplares livres, emprestados e separados de cada título
+    int exemplares = 0;
+    int disponiveis = 0;
+    int separados = 0;
+
+    NoLivro* atual = bib->catalogo->cabeca;
+    while (atual != NULL) {
+        exemplares += atual->dados.quantidade;
+        disponiveis += atual->total_livres;
+        separados += atual->total_separados;
+        atual = atual->proximo;
+    }
+    int emprestados = exemplares - disponiveis - separados;
+
+    // Exibe o relatório
+    printf("\n");
+    printf("╔════════════════════════════════════════════════════════╗\n");
+    printf("║       RELATÓRIO DO SISTEMA DE BIBLIOTECA              ║\n");
+    printf("╠════════════════════════════════════════════════════════╣\n");
+    printf("║ Total de livros no catálogo:        %-5d            ║\n", bib->catalogo->total);
+    printf("║ Total de exemplares:                %-5d            ║\n", exemplares);
+    printf("║ Exemplares disponíveis:             %-5d            ║\n", disponiveis);
+    printf("║ Exemplares emprestados:             %-5d            ║\n", emprestados);
+    printf("║ Exemplares separados para a fila:   %-5d            ║\n", separados);
+    printf("║ Exemplares com devolução atrasada:  %-5d            ║\n",
+           bib->catalogo->prazos->total_atrasados);
+    printf("║ Leitores na fila de espera:         %-5d            ║\n", bib->fila_espera->total);
+    printf("║ Operações registradas no histórico: %-5d            ║\n", bib->historico->total);
+    printf("╠════════════════════════════════════════════════════════╣\n");
+    printf("║ Filtro de títulos - falsos positivos estimados: %6.2f%% ║\n",
+           100.0 * filtro_bloom_taxa_estimada(bib->catalogo->filtro_titulos));
+    printf("║ Filtro de títulos - falsos positivos observados: %5.2f%% ║\n",
+           100.0 * filtro_bloom_taxa_observada(bib->catalogo->filtro_titulos));
     printf("╚════════════════════════════════════════════════════════╝\n");
 }
\ No newline at end of file
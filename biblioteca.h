@@ -18,6 +18,7 @@
 #include <time.h>
 #include <ctype.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 // =============================================================================
 // CONSTANTES DO SISTEMA
@@ -27,38 +28,120 @@
 #define MAX_AUTOR 100       // Tamanho máximo para nome do autor
 #define MAX_ISBN 20         // Tamanho máximo para ISBN
 #define MAX_NOME_LEITOR 100 // Tamanho máximo para nome do leitor
+#define MAX_EMPRESTIMOS_POR_LEITOR 5 // Limite padrão de livros emprestados ao mesmo leitor
+#define PRIORIDADE_PREFERENCIAL 0   // Docentes e leitores com necessidades de acessibilidade
+#define PRIORIDADE_GERAL 1          // Demais leitores
+#define TAMANHO_PAGINA 10           // Itens por página nas listagens do menu
+#define PERIODO_HORA 0              // Agregação do histórico por hora
+#define PERIODO_DIA 1               // Agregação do histórico por dia
+#define OPERACOES_HISTORICO_EM_MEMORIA 65536 // Operações recentes do histórico fora dos arquivos
+
+// =============================================================================
+// CURSOR DE LISTAGEM (PAGINAÇÃO)
+// =============================================================================
+
+/**
+ * Posição de uma listagem paginada (catálogo, fila de espera ou histórico)
+ * Guarda o último item entregue: a próxima página começa logo depois dele e
+ * custa O(tamanho da página), e itens inseridos no fim continuam aparecendo.
+ * Os cursores do catálogo e da fila ficam registrados na estrutura percorrida,
+ * que recua o cursor para o item anterior quando o último entregue é removido.
+ * Os campos são internos: use apenas as funções de cursor.
+ */
+typedef struct CursorListagem {
+    const void* ultimo;                 // Último item entregue (NULL = início)
+    int inicio;                         // Posição do primeiro item (listagens sobre vetores)
+    int entregues;                      // Itens já entregues (numeração da listagem)
+    struct CursorListagem* anterior;    // Cursor aberto anterior na mesma estrutura
+    struct CursorListagem* proximo;     // Próximo cursor aberto na mesma estrutura
+} CursorListagem;
 
 // =============================================================================
 // ESTRUTURA 1: LISTA ENCADEADA (CATÁLOGO DE LIVROS)
 // =============================================================================
 
 /**
- * Estrutura que representa um LIVRO no catálogo
+ * Estrutura que representa um LIVRO (título) no catálogo
  */
 typedef struct {
     char titulo[MAX_TITULO];              // Título do livro
     char autor[MAX_AUTOR];                // Nome do autor
     int ano_publicacao;                   // Ano de publicação
     char isbn[MAX_ISBN];                  // ISBN (opcional)
-    bool status;                          // true = disponível, false = emprestado
+    int quantidade;                       // Número de exemplares (cópias físicas)
+    bool status;                          // true = há exemplar livre, false = todos emprestados/separados
+} Livro;
+
+/**
+ * Estrutura que representa um EXEMPLAR (cópia física) de um livro
+ * Empréstimo, prazo de devolução e reserva pertencem a cada exemplar.
+ */
+typedef struct Exemplar {
+    int numero;                           // Número do exemplar no título (1, 2, ...)
+    bool status;                          // true = não emprestado, false = emprestado
     char nome_leitor_atual[MAX_NOME_LEITOR]; // Nome do leitor (se emprestado)
     time_t data_emprestimo;               // Data do empréstimo (timestamp)
-} Livro;
+    time_t data_devolucao_prevista;       // Prazo para devolução (0 se não emprestado)
+    char nome_reserva[MAX_NOME_LEITOR];   // Leitor para quem está separado ("" se nenhum)
+    time_t fim_reserva;                   // Fim do prazo para retirar o exemplar separado
+    struct NoLivro* livro;                // Título ao qual o exemplar pertence
+    struct Leitor* leitor_atual;          // Leitor que está com o exemplar (NULL se livre)
+    struct Exemplar* anterior_do_leitor;  // Empréstimo anterior do mesmo leitor
+    struct Exemplar* proximo_do_leitor;   // Próximo empréstimo do mesmo leitor
+    int posicao_prazo;                    // Posição no heap de prazos (ver prazos.h)
+    struct Exemplar* anterior_atrasado;   // Exemplar atrasado anterior (lista de atrasados)
+    struct Exemplar* proximo_atrasado;    // Próximo exemplar atrasado
+    int balde_reserva;                    // Posição na roda de reservas (ver prazos.h)
+    struct Exemplar* anterior_reserva;    // Reserva anterior na mesma posição da roda
+    struct Exemplar* proximo_reserva;     // Próxima reserva na mesma posição da roda
+} Exemplar;
 
 /**
  * Nó da Lista Encadeada de Livros
+ * Os exemplares livres (nem emprestados nem separados) ficam em uma pilha de
+ * índices, então pegar um exemplar livre ou devolvê-lo à estante custa O(1).
  */
 typedef struct NoLivro {
     Livro dados;                // Dados do livro
+    char titulo_busca[MAX_TITULO]; // Título em minúsculas (calculado na inserção)
+    int termos_indexados;       // Quantidade de termos no índice textual (BM25)
+    int total_emprestimos;      // Quantas vezes o livro já foi emprestado (popularidade)
+    long long soma_duracoes;    // Soma das durações dos empréstimos devolvidos (segundos)
+    int total_devolucoes;       // Empréstimos devolvidos (para a duração média)
+    uint64_t isbn_chave;        // ISBN-13 normalizado em um inteiro (0 = sem ISBN)
+    int vaga;                   // Vaga nas páginas dos pontos de controle (ver persistencia.h)
+    Exemplar* exemplares;       // Vetor com dados.quantidade exemplares
+    int* livres;                // Pilha de índices dos exemplares livres
+    int total_livres;           // Exemplares livres (topo da pilha)
+    int total_separados;        // Exemplares separados para leitores da fila
     struct NoLivro* proximo;    // Ponteiro para o próximo nó
 } NoLivro;
 
+struct IndiceTextual; // Índice invertido de título e autor (definido em busca.h)
+struct TrieTitulos;   // Árvore radix de títulos para sugestões (definida em busca.h)
+struct FiltroBloom;   // Filtro de títulos inexistentes (definido em indices.h)
+struct IndiceISBN;    // Tabela hash de ISBNs (definida em indices.h)
+struct ControlePrazos; // Heap de prazos de devolução (definido em prazos.h)
+struct RodaReservas;  // Roda de expiração das reservas (definida em prazos.h)
+struct VisoesOrdenadas; // Catálogo ordenado por título, autor e ano (definido em visoes.h)
+struct PaginasCatalogo; // Páginas sujas para os pontos de controle (definidas em persistencia.h)
+
 /**
  * Estrutura da Lista Encadeada (Catálogo)
  */
 typedef struct {
     NoLivro* cabeca;    // Ponteiro para o primeiro livro
+    NoLivro* cauda;     // Ponteiro para o último livro (inserção em O(1))
     int total;          // Total de livros no catálogo
+    struct IndiceTextual* indice_textual; // Índice para busca por palavras-chave
+    struct TrieTitulos* trie_titulos;     // Árvore de prefixos para autocompletar
+    struct FiltroBloom* filtro_titulos;   // Descarta rapidamente títulos inexistentes
+    struct IndiceISBN* indice_isbn;       // Busca direta por ISBN
+    struct ControlePrazos* prazos;        // Prazos de devolução dos livros emprestados
+    struct RodaReservas* reservas;        // Expiração dos livros separados para a fila
+    struct VisoesOrdenadas* visoes;       // Ordens por título, autor e ano (paginação)
+    struct PaginasCatalogo* paginas;      // Vagas e páginas alteradas (pontos de controle)
+    CursorListagem* cursores;             // Cursores abertos sobre o catálogo
 } ListaLivros;
 
 // =============================================================================
@@ -72,6 +155,7 @@ typedef struct {
     char nome_leitor[MAX_NOME_LEITOR];  // Nome do leitor que está aguardando
     char titulo_livro[MAX_TITULO];      // Título do livro desejado
     time_t data_solicitacao;            // Data da solicitação (timestamp)
+    int prioridade;                     // Classe de prioridade (PRIORIDADE_*)
 } Solicitacao;
 
 /**
@@ -79,17 +163,34 @@ typedef struct {
  */
 typedef struct NoFila {
     Solicitacao dados;          // Dados da solicitação
+    struct Leitor* leitor;              // Leitor que fez a solicitação (cadastro de leitores)
+    struct NoFila* anterior_do_leitor;  // Solicitação anterior do mesmo leitor
+    struct NoFila* proximo_do_leitor;   // Próxima solicitação do mesmo leitor
+    long long sequencia;                // Ordem de chegada (desempate dentro da classe)
+    int posicao_heap;                   // Posição no heap do título (ver filas.h)
+    struct FilaTitulo* fila_titulo;     // Fila do título desta solicitação
+    unsigned int hash_par;              // Hash do par (leitor, título)
+    struct NoFila* proximo_par;         // Próxima solicitação no mesmo balde de pares
+    struct NoFila* anterior;    // Ponteiro para o nó anterior (ordem de chegada)
     struct NoFila* proximo;     // Ponteiro para o próximo nó
 } NoFila;
 
+struct CadastroLeitores; // Tabela hash de leitores (definida em leitores.h)
+struct FilasPorTitulo;   // Fila (heap) de cada título (definida em filas.h)
+
 /**
  * Estrutura da Fila (Lista de Espera)
- * Princípio: FIFO (First In, First Out)
+ * Princípio: FIFO (First In, First Out), ou por classe de prioridade no modo prioridade
+ * A lista encadeada guarda a ordem de chegada de todas as solicitações; a ordem
+ * de atendimento de cada título fica no heap daquele título (por_titulo).
  */
 typedef struct {
     NoFila* frente;     // Ponteiro para o início da fila
     NoFila* tras;       // Ponteiro para o final da fila
     int total;          // Total de solicitações na fila
+    struct CadastroLeitores* leitores; // Cadastro onde as solicitações são registradas (opcional)
+    struct FilasPorTitulo* por_titulo; // Ordem de atendimento de cada título
+    CursorListagem* cursores;           // Cursores abertos sobre a fila
 } FilaEspera;
 
 // =============================================================================
@@ -97,7 +198,7 @@ typedef struct {
 // =============================================================================
 
 /**
- * Estrutura que representa uma OPERAÇÃO no histórico
+ * Estrutura que representa uma OPERAÇÃO no histórico (forma decodificada)
  */
 typedef struct {
     char tipo_operacao[20];             // "EMPRESTIMO" ou "DEVOLUCAO"
@@ -106,27 +207,37 @@ typedef struct {
     time_t data_operacao;               // Data/hora da operação (timestamp)
 } Operacao;
 
-/**
- * Nó da Pilha de Histórico
- */
-typedef struct NoPilha {
-    Operacao dados;             // Dados da operação
-    struct NoPilha* proximo;    // Ponteiro para o próximo nó (abaixo)
-} NoPilha;
+struct RegistrosHistorico; // Registros compactos do histórico (definidos em historico.h)
 
 /**
  * Estrutura da Pilha (Histórico)
  * Princípio: LIFO (Last In, First Out)
+ * As operações ficam em registros compactos de 16 bytes (tipo, ids do título e
+ * do leitor e horário relativo ao bloco), da mais antiga (posição 0) para a
+ * mais recente (topo). Os horários nunca diminuem, então um intervalo de datas
+ * é achado por busca binária; as listagens decodificam os registros na hora.
  */
 typedef struct {
-    NoPilha* topo;      // Ponteiro para o topo da pilha
-    int total;          // Total de operações registradas
+    struct RegistrosHistorico* registros; // Operações codificadas em ordem de registro
+    int total;                            // Total de operações registradas
 } PilhaHistorico;
 
+/**
+ * Movimento de um período (uma hora ou um dia) do histórico
+ */
+typedef struct {
+    time_t inicio;          // Início do período (hora local)
+    int emprestimos;        // Operações "EMPRESTIMO" no período
+    int devolucoes;         // Operações "DEVOLUCAO" no período
+    int total;              // Todas as operações do período
+} ContagemPeriodo;
+
 // =============================================================================
 // ESTRUTURA PRINCIPAL: SISTEMA DA BIBLIOTECA
 // =============================================================================
 
+struct AnalisesEmprestimos; // Estatísticas de circulação (definidas em analises.h)
+
 /**
  * Estrutura que integra todas as estruturas de dados
  */
@@ -134,6 +245,8 @@ typedef struct {
     ListaLivros* catalogo;      // Catálogo de livros (lista encadeada)
     FilaEspera* fila_espera;    // Fila de espera (fila)
     PilhaHistorico* historico;  // Histórico de operações (pilha)
+    struct CadastroLeitores* leitores; // Cadastro de leitores (tabela hash)
+    struct AnalisesEmprestimos* analises; // Estatísticas de circulação (analises.h)
 } Biblioteca;
 
 // =============================================================================
@@ -181,9 +294,18 @@ bool adicionar_livro(ListaLivros* lista, Livro livro);
  */
 NoLivro* buscar_por_titulo(ListaLivros* lista, const char* titulo);
 
+/**
+ * Busca um livro pelo ISBN (ISBN-10 ou ISBN-13, com ou sem hífens)
+ * Parâmetros:
+ *   - lista: Ponteiro para a lista de livros
+ *   - isbn: String com o ISBN a ser buscado
+ * Retorna: Ponteiro para o nó do livro encontrado, ou NULL se não encontrado
+ */
+NoLivro* buscar_por_isbn(ListaLivros* lista, const char* isbn);
+
 /**
  * Busca livros por autor (comparação parcial e case-insensitive)
- * Exibe todos os livros do autor encontrado
+ * Exibe todos os livros do autor encontrado, em ordem de título (varredura paralela)
  * Parâmetros:
  *   - lista: Ponteiro para a lista de livros
  *   - autor: String com o nome do autor a ser buscado
@@ -207,6 +329,44 @@ bool remover_livro(ListaLivros* lista, const char* titulo);
  */
 void listar_todos_livros(ListaLivros* lista);
 
+/**
+ * Abre um cursor no início do catálogo (ordem de cadastro)
+ * O cursor fica registrado no catálogo até ser fechado.
+ * Parâmetros:
+ *   - lista: Ponteiro para a lista de livros
+ *   - cursor: Cursor a ser aberto (memória do chamador)
+ */
+void catalogo_abrir_cursor(ListaLivros* lista, CursorListagem* cursor);
+
+/**
+ * Fecha um cursor do catálogo
+ * Parâmetros:
+ *   - lista: Ponteiro para a lista de livros
+ *   - cursor: Cursor aberto com catalogo_abrir_cursor()
+ */
+void catalogo_fechar_cursor(ListaLivros* lista, CursorListagem* cursor);
+
+/**
+ * Copia a próxima página do catálogo e avança o cursor
+ * Parâmetros:
+ *   - lista: Ponteiro para a lista de livros
+ *   - cursor: Cursor aberto com catalogo_abrir_cursor()
+ *   - saida: Vetor que receberá os livros
+ *   - max: Tamanho do vetor
+ * Retorna: Quantidade de livros colocados no vetor (0 = fim do catálogo)
+ */
+int catalogo_pagina(ListaLivros* lista, CursorListagem* cursor, NoLivro** saida, int max);
+
+/**
+ * Exibe a próxima página do catálogo
+ * Parâmetros:
+ *   - lista: Ponteiro para a lista de livros
+ *   - cursor: Cursor aberto com catalogo_abrir_cursor()
+ *   - tamanho: Livros por página
+ * Retorna: Quantidade de livros exibidos (menos que tamanho = fim do catálogo)
+ */
+int listar_livros_pagina(ListaLivros* lista, CursorListagem* cursor, int tamanho);
+
 /**
  * Lista apenas os livros com status "disponível"
  * Parâmetros:
@@ -221,6 +381,13 @@ void listar_livros_disponiveis(ListaLivros* lista);
  */
 void listar_livros_emprestados(ListaLivros* lista);
 
+/**
+ * Exibe a quantidade de exemplares de um livro e os que estão emprestados ou separados
+ * Parâmetros:
+ *   - livro: Nó do livro
+ */
+void exibir_exemplares(NoLivro* livro);
+
 /**
  * Libera toda a memória da lista de livros
  * Parâmetros:
@@ -240,14 +407,27 @@ FilaEspera* criar_fila_espera();
 
 /**
  * Adiciona um leitor à fila de espera para um livro
+ * Se o leitor já aguarda este título, a solicitação existente é mantida (não duplica).
  * Parâmetros:
  *   - fila: Ponteiro para a fila de espera
  *   - nome_leitor: Nome do leitor que está solicitando
  *   - titulo_livro: Título do livro desejado
- * Retorna: true se enfileirado com sucesso, false caso contrário
+ * Retorna: true se enfileirado (ou se já estava na fila), false caso contrário
  */
 bool enfileirar(FilaEspera* fila, const char* nome_leitor, const char* titulo_livro);
 
+/**
+ * Adiciona um leitor à fila de espera com uma classe de prioridade explícita
+ * Parâmetros:
+ *   - fila: Ponteiro para a fila de espera
+ *   - nome_leitor: Nome do leitor
+ *   - titulo_livro: Título do livro desejado
+ *   - prioridade: PRIORIDADE_PREFERENCIAL ou PRIORIDADE_GERAL
+ * Retorna: true se adicionado com sucesso, false caso contrário
+ */
+bool enfileirar_com_prioridade(FilaEspera* fila, const char* nome_leitor,
+                               const char* titulo_livro, int prioridade);
+
 /**
  * Remove o próximo leitor da fila que aguarda por um livro específico
  * Parâmetros:
@@ -284,6 +464,44 @@ int listar_fila_livro(FilaEspera* fila, const char* titulo_livro);
  */
 void listar_todas_filas(FilaEspera* fila);
 
+/**
+ * Abre um cursor no início da fila de espera (ordem de chegada)
+ * O cursor fica registrado na fila até ser fechado.
+ * Parâmetros:
+ *   - fila: Ponteiro para a fila de espera
+ *   - cursor: Cursor a ser aberto (memória do chamador)
+ */
+void fila_abrir_cursor(FilaEspera* fila, CursorListagem* cursor);
+
+/**
+ * Fecha um cursor da fila de espera
+ * Parâmetros:
+ *   - fila: Ponteiro para a fila de espera
+ *   - cursor: Cursor aberto com fila_abrir_cursor()
+ */
+void fila_fechar_cursor(FilaEspera* fila, CursorListagem* cursor);
+
+/**
+ * Copia a próxima página de solicitações e avança o cursor
+ * Parâmetros:
+ *   - fila: Ponteiro para a fila de espera
+ *   - cursor: Cursor aberto com fila_abrir_cursor()
+ *   - saida: Vetor que receberá as solicitações
+ *   - max: Tamanho do vetor
+ * Retorna: Quantidade de solicitações colocadas no vetor (0 = fim da fila)
+ */
+int fila_pagina(FilaEspera* fila, CursorListagem* cursor, NoFila** saida, int max);
+
+/**
+ * Exibe a próxima página de solicitações em espera
+ * Parâmetros:
+ *   - fila: Ponteiro para a fila de espera
+ *   - cursor: Cursor aberto com fila_abrir_cursor()
+ *   - tamanho: Solicitações por página
+ * Retorna: Quantidade de solicitações exibidas (menos que tamanho = fim da fila)
+ */
+int listar_filas_pagina(FilaEspera* fila, CursorListagem* cursor, int tamanho);
+
 /**
  * Libera toda a memória da fila de espera
  * Parâmetros:
@@ -291,6 +509,16 @@ void listar_todas_filas(FilaEspera* fila);
  */
 void liberar_fila_espera(FilaEspera* fila);
 
+/**
+ * Liga ou desliga o modo de prioridade da fila de espera
+ * No modo prioridade, leitores preferenciais são atendidos antes dos demais;
+ * dentro de cada classe vale a ordem de chegada.
+ * Parâmetros:
+ *   - fila: Ponteiro para a fila de espera
+ *   - modo_prioridade: true = por classe de prioridade, false = FIFO
+ */
+void definir_modo_prioridade(FilaEspera* fila, bool modo_prioridade);
+
 // =============================================================================
 // FUNÇÕES DA PILHA (HISTÓRICO DE OPERAÇÕES)
 // =============================================================================
@@ -313,6 +541,31 @@ PilhaHistorico* criar_pilha_historico();
 bool empilhar(PilhaHistorico* pilha, const char* tipo_operacao,
               const char* titulo_livro, const char* nome_leitor);
 
+/**
+ * Adiciona um bloco de operações ao topo da pilha, todas com o mesmo horário
+ * Cada operação vira um registro compacto de 16 bytes (ver historico.h); os ids
+ * de título e leitor e os blocos de registros são obtidos antes de gravar o
+ * primeiro: ou entram todos ou nenhum.
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - operacoes: Vetor de operações (data_operacao é ignorada)
+ *   - total: Quantidade de operações
+ * Retorna: true se empilhado com sucesso, false caso contrário
+ */
+bool empilhar_lote(PilhaHistorico* pilha, const Operacao* operacoes, int total);
+
+/**
+ * Adiciona operações ao topo da pilha mantendo o horário de cada uma
+ * Usada na importação de um histórico exportado: os horários devem vir em ordem
+ * crescente e não podem ser anteriores ao da última operação registrada.
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - operacoes: Vetor de operações, da mais antiga para a mais recente
+ *   - total: Quantidade de operações
+ * Retorna: true se empilhadas, false se um horário está fora de ordem ou faltou memória
+ */
+bool empilhar_com_horarios(PilhaHistorico* pilha, const Operacao* operacoes, int total);
+
 /**
  * Exibe as operações mais recentes do histórico
  * Parâmetros:
@@ -321,6 +574,89 @@ bool empilhar(PilhaHistorico* pilha, const char* tipo_operacao,
  */
 void exibir_historico(PilhaHistorico* pilha, int limite);
 
+/**
+ * Copia a próxima página do histórico (da operação mais recente para a mais antiga)
+ * O histórico nunca remove operações e as novas entram acima do início da
+ * listagem, então o cursor não precisa ser registrado: basta iniciá-lo.
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - cursor: Cursor iniciado com iniciar_cursor()
+ *   - saida: Vetor que receberá as operações
+ *   - max: Tamanho do vetor
+ * Retorna: Quantidade de operações colocadas no vetor (0 = fim do histórico)
+ */
+int historico_pagina(PilhaHistorico* pilha, CursorListagem* cursor, Operacao* saida, int max);
+
+/**
+ * Exibe a próxima página do histórico
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - cursor: Cursor iniciado com iniciar_cursor()
+ *   - tamanho: Operações por página
+ * Retorna: Quantidade de operações exibidas (menos que tamanho = fim do histórico)
+ */
+int exibir_historico_pagina(PilhaHistorico* pilha, CursorListagem* cursor, int tamanho);
+
+/**
+ * Localiza as operações registradas em um intervalo de tempo
+ * Faz duas buscas binárias nos horários: custa O(log n).
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - inicio: Primeiro instante do intervalo (incluído)
+ *   - fim: Fim do intervalo (excluído)
+ *   - primeira: Recebe a posição da operação mais antiga do intervalo
+ * Retorna: Quantidade de operações no intervalo (posições consecutivas a
+ *          partir de primeira, lidas com historico_obter())
+ */
+int historico_intervalo(PilhaHistorico* pilha, time_t inicio, time_t fim, int* primeira);
+
+/**
+ * Decodifica a operação de uma posição do histórico
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - posicao: Posição (0 = operação mais antiga, total - 1 = topo)
+ *   - saida: Recebe a operação
+ * Retorna: true se a posição existe, false caso contrário
+ */
+bool historico_obter(PilhaHistorico* pilha, int posicao, Operacao* saida);
+
+/**
+ * Conta as operações de um intervalo por hora ou por dia
+ * Cada período é delimitado por busca binária; só as operações do intervalo
+ * são percorridas (para separar empréstimos de devoluções).
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - inicio: Primeiro instante do intervalo (incluído)
+ *   - fim: Fim do intervalo (excluído)
+ *   - periodo: PERIODO_HORA ou PERIODO_DIA
+ *   - saida: Vetor que receberá um período por posição, inclusive os vazios
+ *   - max: Tamanho do vetor
+ * Retorna: Quantidade de períodos colocados no vetor, ou -1 se um segmento do
+ *          histórico em disco não pôde ser lido
+ */
+int historico_agregar(PilhaHistorico* pilha, time_t inicio, time_t fim, int periodo,
+                      ContagemPeriodo* saida, int max);
+
+/**
+ * Exibe as operações de um intervalo de tempo, da mais antiga para a mais recente
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - inicio: Primeiro instante do intervalo (incluído)
+ *   - fim: Fim do intervalo (excluído)
+ * Retorna: Número de operações exibidas
+ */
+int exibir_historico_periodo(PilhaHistorico* pilha, time_t inicio, time_t fim);
+
+/**
+ * Exibe o movimento (empréstimos e devoluções) de um intervalo por hora ou por dia
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - inicio: Primeiro instante do intervalo (incluído)
+ *   - fim: Fim do intervalo (excluído)
+ *   - periodo: PERIODO_HORA ou PERIODO_DIA
+ */
+void exibir_movimento_historico(PilhaHistorico* pilha, time_t inicio, time_t fim, int periodo);
+
 /**
  * Exibe todo o histórico de operações para um livro específico
  * Parâmetros:
@@ -330,6 +666,19 @@ void exibir_historico(PilhaHistorico* pilha, int limite);
  */
 int historico_livro(PilhaHistorico* pilha, const char* titulo_livro);
 
+/**
+ * Ativa o modo em camadas: só as operações mais recentes ficam em memória e as
+ * antigas são seladas em arquivos compactados e imutáveis (prefixo_000000.seg, ...)
+ * As listagens e buscas do histórico continuam iguais e leem os arquivos quando
+ * preciso. Os arquivos são apagados por liberar_pilha_historico().
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - prefixo: Caminho e início do nome dos arquivos (ex.: "historico")
+ *   - operacoes_em_memoria: Quantas das operações mais recentes ficam em memória
+ * Retorna: true se ativado, false se os parâmetros são inválidos ou a gravação falhou
+ */
+bool historico_ativar_arquivamento(PilhaHistorico* pilha, const char* prefixo, int operacoes_em_memoria);
+
 /**
  * Libera toda a memória da pilha de histórico
  * Parâmetros:
@@ -343,6 +692,8 @@ void liberar_pilha_historico(PilhaHistorico* pilha);
 
 /**
  * Realiza o empréstimo de um livro
+ * Usa o exemplar separado para o leitor (se houver) ou qualquer exemplar livre;
+ * o leitor só entra na fila quando nenhum exemplar está livre para ele.
  * Parâmetros:
  *   - bib: Ponteiro para a estrutura Biblioteca
  *   - titulo: Título do livro a ser emprestado
@@ -350,22 +701,129 @@ void liberar_pilha_historico(PilhaHistorico* pilha);
  * Retorna:
  *   0 = Empréstimo realizado com sucesso
  *   1 = Livro não encontrado
- *   2 = Livro já emprestado (leitor adicionado à fila)
+ *   2 = Nenhum exemplar livre (leitor adicionado à fila)
+ *   3 = Leitor atingiu o limite de empréstimos simultâneos
+ *   4 = Leitor não pôde ser cadastrado (nome muito longo ou falta de memória)
  */
 int emprestar_livro(Biblioteca* bib, const char* titulo, const char* nome_leitor);
 
+/**
+ * Realiza o empréstimo de um livro identificado pelo ISBN (ex.: leitor de código de barras)
+ * Parâmetros:
+ *   - bib: Ponteiro para a estrutura Biblioteca
+ *   - isbn: ISBN do livro a ser emprestado
+ *   - nome_leitor: Nome do leitor
+ * Retorna: Os mesmos códigos de emprestar_livro()
+ */
+int emprestar_livro_isbn(Biblioteca* bib, const char* isbn, const char* nome_leitor);
+
 /**
  * Realiza a devolução de um livro
+ * Se houver fila, o exemplar fica separado para o próximo leitor por PRAZO_RESERVA_HORAS.
  * Parâmetros:
  *   - bib: Ponteiro para a estrutura Biblioteca
  *   - titulo: Título do livro a ser devolvido
  * Retorna:
  *   0 = Devolução realizada com sucesso
  *   1 = Livro não encontrado
- *   2 = Livro já está disponível (não estava emprestado)
+ *   2 = Livro já está disponível (nenhum exemplar emprestado)
+ *   3 = Mais de um exemplar emprestado (use devolver_livro_leitor)
  */
 int devolver_livro(Biblioteca* bib, const char* titulo);
 
+/**
+ * Realiza a devolução do exemplar de um livro que está com um leitor
+ * Parâmetros:
+ *   - bib: Ponteiro para a estrutura Biblioteca
+ *   - titulo: Título do livro a ser devolvido
+ *   - nome_leitor: Nome do leitor que está devolvendo
+ * Retorna: Os mesmos códigos de devolver_livro() (2 = o leitor não está com o livro)
+ */
+int devolver_livro_leitor(Biblioteca* bib, const char* titulo, const char* nome_leitor);
+
+/**
+ * Realiza a devolução de um livro identificado pelo ISBN
+ * Parâmetros:
+ *   - bib: Ponteiro para a estrutura Biblioteca
+ *   - isbn: ISBN do livro a ser devolvido
+ * Retorna: Os mesmos códigos de devolver_livro()
+ */
+int devolver_livro_isbn(Biblioteca* bib, const char* isbn);
+
+/**
+ * Notifica os empréstimos cujo prazo de devolução venceu desde a última verificação
+ * Cada atraso é notificado uma única vez, sem percorrer o catálogo.
+ * Parâmetros:
+ *   - bib: Ponteiro para a estrutura Biblioteca
+ * Retorna: Quantidade de novos atrasos notificados
+ */
+int verificar_atrasos(Biblioteca* bib);
+
+/**
+ * Encerra as reservas cujo prazo de retirada expirou
+ * Cada livro passa automaticamente para o próximo leitor da fila daquele título
+ * (ou volta a ficar livre, se a fila estiver vazia).
+ * Parâmetros:
+ *   - bib: Ponteiro para a estrutura Biblioteca
+ * Retorna: Quantidade de reservas expiradas
+ */
+int verificar_reservas(Biblioteca* bib);
+
+/**
+ * Restaura os empréstimos e reservas de um título recuperado de um ponto de controle
+ * Os empréstimos voltam para os leitores e para o controle de prazos, e as
+ * reservas para a roda de expiração; os demais exemplares ficam livres.
+ * Parâmetros:
+ *   - bib: Ponteiro para a estrutura Biblioteca
+ *   - no_livro: Título recém-cadastrado (todos os exemplares livres)
+ *   - situacao: Situação gravada de cada exemplar (status, leitor, datas e reserva)
+ * Retorna: true se restaurado, false se faltou memória ou leitor (o título fica
+ *          pela metade e deve ser retirado com remover_livro())
+ */
+bool restaurar_situacao_livro(Biblioteca* bib, NoLivro* no_livro, const Exemplar* situacao);
+
+/**
+ * Empresta vários livros de uma vez, sem mensagens por item
+ * Os itens são agrupados por título: cada livro é localizado uma única vez,
+ * o histórico recebe um único bloco e a popularidade é atualizada por título.
+ * Parâmetros:
+ *   - bib: Ponteiro para a estrutura Biblioteca
+ *   - itens: Títulos ou ISBNs dos livros
+ *   - nomes_leitores: Leitor de cada item
+ *   - total: Quantidade de itens
+ *   - codigos: Vetor que receberá o código de cada item (os de emprestar_livro())
+ * Retorna: Quantidade de empréstimos realizados (-1 se faltou memória)
+ */
+int emprestar_lote(Biblioteca* bib, const char* itens[], const char* nomes_leitores[],
+                   int total, int codigos[]);
+
+/**
+ * Devolve vários livros de uma vez (ex.: esvaziar a caixa de devolução), sem mensagens por item
+ * Os itens são agrupados por título e cada item devolve exatamente um exemplar,
+ * sem precisar saber o leitor: no mesmo título, os itens (na ordem do vetor)
+ * ficam com os empréstimos mais antigos primeiro (empate: menor número de
+ * exemplar). Os exemplares devolvidos passam juntos para a fila do título.
+ * Parâmetros:
+ *   - bib: Ponteiro para a estrutura Biblioteca
+ *   - itens: Títulos ou ISBNs dos livros
+ *   - total: Quantidade de itens
+ *   - codigos: Vetor que receberá o código de cada item: 0 = devolvido,
+ *     1 = livro não encontrado, 2 = item a mais que exemplares emprestados
+ * Retorna: Quantidade de devoluções realizadas (-1 se faltou memória; as
+ *          devoluções feitas até ali ficam no histórico)
+ */
+int devolver_lote(Biblioteca* bib, const char* itens[], int total, int codigos[]);
+
+/**
+ * Define a classe de prioridade de um leitor (e de suas solicitações já na fila)
+ * Parâmetros:
+ *   - bib: Ponteiro para a estrutura Biblioteca
+ *   - nome_leitor: Nome do leitor
+ *   - prioridade: PRIORIDADE_PREFERENCIAL ou PRIORIDADE_GERAL
+ * Retorna: true se a classe foi definida, false em caso de erro
+ */
+bool definir_prioridade_leitor(Biblioteca* bib, const char* nome_leitor, int prioridade);
+
 /**
  * Exibe um relatório completo do sistema
  * Parâmetros:
@@ -385,6 +843,14 @@ void relatorio_sistema(Biblioteca* bib);
  */
 void para_minusculo(char* dest, const char* src);
 
+/**
+ * Calcula o hash de uma string (FNV-1a de 32 bits)
+ * Parâmetros:
+ *   - texto: String de entrada
+ * Retorna: Valor de hash da string
+ */
+unsigned int calcular_hash(const char* texto);
+
 /**
  * Formata um timestamp para string legível
  * Parâmetros:
@@ -394,6 +860,13 @@ void para_minusculo(char* dest, const char* src);
  */
 void formatar_data(time_t timestamp, char* buffer, size_t tamanho);
 
+/**
+ * Posiciona um cursor de listagem no início, sem registrá-lo em nenhuma estrutura
+ * Parâmetros:
+ *   - cursor: Cursor a ser iniciado
+ */
+void iniciar_cursor(CursorListagem* cursor);
+
 /**
  * Limpa o buffer de entrada (stdin)
  */
@@ -0,0 +1,1207 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: busca.c
+ * Descrição: Implementação das buscas avançadas no catálogo
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#include "busca.h"
+#include "textos.h"
+#include <stdint.h>
+#include <math.h>
+
+// =============================================================================
+// BUSCA APROXIMADA (DISTÂNCIA DE EDIÇÃO)
+// =============================================================================
+
+/**
+ * Distância de edição por programação dinâmica, calculando apenas a faixa
+ * diagonal de largura 2 * limite + 1 (padrões com mais de 64 caracteres)
+ */
+static int distancia_faixa(const char* padrao, int m, const char* texto, int n, int limite) {
+    int* anterior = (int*)malloc((n + 1) * sizeof(int));
+    int* corrente = (int*)malloc((n + 1) * sizeof(int));
+    if (anterior == NULL || corrente == NULL) {
+        free(anterior);
+        free(corrente);
+        return limite + 1;
+    }
+
+    int infinito = limite + 1;
+    for (int j = 0; j <= n; j++) {
+        anterior[j] = j <= limite ? j : infinito;
+    }
+
+    for (int i = 1; i <= m; i++) {
+        int inicio = i - limite > 1 ? i - limite : 1;
+        int fim = i + limite < n ? i + limite : n;
+        int menor_linha = infinito;
+
+        corrente[0] = i <= limite ? i : infinito;
+        if (inicio > 1) {
+            corrente[inicio - 1] = infinito;
+        }
+
+        for (int j = inicio; j <= fim; j++) {
+            int custo = padrao[i - 1] == texto[j - 1] ? 0 : 1;
+            int valor = anterior[j - 1] + custo;
+            if (anterior[j] + 1 < valor) valor = anterior[j] + 1;
+            if (corrente[j - 1] + 1 < valor) valor = corrente[j - 1] + 1;
+            if (valor > infinito) valor = infinito;
+            corrente[j] = valor;
+            if (valor < menor_linha) menor_linha = valor;
+        }
+        if (fim < n) {
+            corrente[fim + 1] = infinito;
+        }
+
+        // Nenhuma célula da linha está dentro do limite: não há como melhorar
+        if (menor_linha > limite) {
+            free(anterior);
+            free(corrente);
+            return infinito;
+        }
+
+        int* troca = anterior;
+        anterior = corrente;
+        corrente = troca;
+    }
+
+    int resultado = anterior[n];
+    free(anterior);
+    free(corrente);
+    return resultado;
+}
+
+/**
+ * Distância de edição bit-paralela (Myers/Hyyrö) para padrões de até 64 caracteres
+ * A tabela peq contém, para cada byte, a máscara das posições do padrão onde ele ocorre.
+ */
+static int distancia_myers(const uint64_t* peq, int m, const char* texto, int n, int limite) {
+    uint64_t mascara_alta = (uint64_t)1 << (m - 1);
+    uint64_t pv = m == 64 ? ~(uint64_t)0 : (((uint64_t)1 << m) - 1);
+    uint64_t mv = 0;
+    int pontuacao = m;
+
+    for (int j = 0; j < n; j++) {
+        uint64_t eq = peq[(unsigned char)texto[j]];
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+
+        if (ph & mascara_alta) {
+            pontuacao++;
+        } else if (mh & mascara_alta) {
+            pontuacao--;
+        }
+
+        // O bit 1 inserido em ph representa a primeira linha da matriz (D[0][j] = j)
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+
+        // Cada caractere restante reduz a distância em no máximo 1
+        if (pontuacao - (n - j - 1) > limite) {
+            return limite + 1;
+        }
+    }
+
+    return pontuacao;
+}
+
+/**
+ * Monta a tabela de máscaras do padrão usada pelo algoritmo de Myers
+ */
+static void montar_tabela_myers(uint64_t* peq, const char* padrao, int m) {
+    memset(peq, 0, 256 * sizeof(uint64_t));
+    for (int i = 0; i < m; i++) {
+        peq[(unsigned char)padrao[i]] |= (uint64_t)1 << i;
+    }
+}
+
+/**
+ * Calcula a distância de edição com limite (ver biblioteca de busca)
+ */
+int distancia_edicao(const char* padrao, const char* texto, int limite) {
+    if (padrao == NULL || texto == NULL || limite < 0) {
+        return limite + 1;
+    }
+
+    int m = (int)strlen(padrao);
+    int n = (int)strlen(texto);
+
+    // Filtro de comprimento: cada caractere de diferença exige uma edição
+    if (abs(m - n) > limite) {
+        return limite + 1;
+    }
+    if (m == 0 || n == 0) {
+        return m > n ? m : n;
+    }
+
+    if (m > 64) {
+        return distancia_faixa(padrao, m, texto, n, limite);
+    }
+
+    uint64_t peq[256];
+    montar_tabela_myers(peq, padrao, m);
+    return distancia_myers(peq, m, texto, n, limite);
+}
+
+/**
+ * Insere um resultado no vetor ordenado por distância (estável para empates)
+ */
+static void inserir_resultado(ResultadoAproximado* resultados, int* total, int k,
+                              NoLivro* livro, int distancia) {
+    int posicao = *total;
+    while (posicao > 0 && resultados[posicao - 1].distancia > distancia) {
+        posicao--;
+    }
+    if (posicao >= k) {
+        return;
+    }
+
+    int ultimo = *total < k ? *total : k - 1;
+    for (int i = ultimo; i > posicao; i--) {
+        resultados[i] = resultados[i - 1];
+    }
+    resultados[posicao].livro = livro;
+    resultados[posicao].distancia = distancia;
+
+    if (*total < k) {
+        (*total)++;
+    }
+}
+
+/**
+ * Busca os k títulos mais próximos do termo informado
+ */
+int buscar_titulo_aproximado(ListaLivros* lista, const char* titulo, int distancia_maxima,
+                             ResultadoAproximado* resultados, int k) {
+    if (lista == NULL || titulo == NULL || resultados == NULL || k <= 0 || distancia_maxima < 0) {
+        return 0;
+    }
+    if (strlen(titulo) >= MAX_TITULO) {
+        return 0;
+    }
+
+    // Converte o termo buscado para minúsculas
+    char titulo_busca[MAX_TITULO];
+    para_minusculo(titulo_busca, titulo);
+    int m = (int)strlen(titulo_busca);
+
+    // A tabela do padrão é montada uma única vez para todo o catálogo
+    uint64_t peq[256];
+    if (m > 0 && m <= 64) {
+        montar_tabela_myers(peq, titulo_busca, m);
+    }
+
+    int total = 0;
+    int limite = distancia_maxima;
+
+    NoLivro* atual = lista->cabeca;
+    while (atual != NULL) {
+        int n = (int)strlen(atual->titulo_busca);
+        int distancia;
+
+        if (abs(m - n) > limite) {
+            distancia = limite + 1;
+        } else if (m == 0 || n == 0) {
+            distancia = m > n ? m : n;
+        } else if (m <= 64) {
+            distancia = distancia_myers(peq, m, atual->titulo_busca, n, limite);
+        } else {
+            distancia = distancia_faixa(titulo_busca, m, atual->titulo_busca, n, limite);
+        }
+
+        if (distancia <= limite) {
+            inserir_resultado(resultados, &total, k, atual, distancia);
+
+            // Com k resultados, só interessam títulos estritamente mais próximos
+            // que o pior deles (empates mantêm a ordem do catálogo)
+            if (total == k) {
+                limite = resultados[k - 1].distancia - 1;
+                if (limite < 0) {
+                    break; // Já temos k correspondências exatas
+                }
+            }
+        }
+
+        atual = atual->proximo;
+    }
+
+    return total;
+}
+
+// =============================================================================
+// FUNÇÕES AUXILIARES DE BUSCA
+// =============================================================================
+
+/**
+ * Converte a segunda parte de um caractere UTF-8 iniciado por 0xC3
+ * (Latin-1: À..ÿ) na letra sem acento correspondente, ou 0 se não houver
+ */
+static char letra_sem_acento(unsigned char c) {
+    c |= 0x20; // Maiúsculas (0x80..0x9F) viram minúsculas (0xA0..0xBF)
+    if (c >= 0xA0 && c <= 0xA5) return 'a';
+    if (c == 0xA7) return 'c';
+    if (c >= 0xA8 && c <= 0xAB) return 'e';
+    if (c >= 0xAC && c <= 0xAF) return 'i';
+    if (c == 0xB1) return 'n';
+    if (c >= 0xB2 && c <= 0xB6) return 'o';
+    if (c >= 0xB9 && c <= 0xBC) return 'u';
+    if (c == 0xBD || c == 0xBF) return 'y';
+    return 0;
+}
+
+/**
+ * Normaliza um texto para busca: minúsculas e sem acentos (UTF-8)
+ */
+void normalizar_texto(char* dest, const char* src) {
+    int i = 0;
+    int j = 0;
+    while (src[i]) {
+        unsigned char c = (unsigned char)src[i];
+        if (c == 0xC3 && src[i + 1] != '\0') {
+            char letra = letra_sem_acento((unsigned char)src[i + 1]);
+            if (letra != 0) {
+                dest[j++] = letra;
+                i += 2;
+                continue;
+            }
+        }
+        dest[j++] = (char)tolower(c);
+        i++;
+    }
+    dest[j] = '\0';
+}
+
+// =============================================================================
+// ÍNDICE INVERTIDO (BUSCA POR PALAVRAS-CHAVE COM BM25)
+// =============================================================================
+
+/**
+ * Indica se um byte faz parte de um termo (letras, dígitos e bytes UTF-8)
+ */
+static bool caractere_de_termo(unsigned char c) {
+    return isalnum(c) || c >= 0x80;
+}
+
+/**
+ * Separa um texto em termos normalizados, acumulando as frequências
+ * Retorna: Novo total de termos distintos no vetor
+ */
+static int extrair_termos(const char* texto, char termos[][MAX_TERMO], int* frequencias,
+                          int total, int* total_ocorrencias) {
+    char limitado[MAX_TITULO + MAX_AUTOR];
+    char normalizado[MAX_TITULO + MAX_AUTOR];
+    snprintf(limitado, sizeof(limitado), "%s", texto);
+    normalizar_texto(normalizado, limitado);
+
+    int i = 0;
+    while (normalizado[i]) {
+        // Pula separadores
+        while (normalizado[i] && !caractere_de_termo((unsigned char)normalizado[i])) {
+            i++;
+        }
+        if (!normalizado[i]) {
+            break;
+        }
+
+        // Copia o termo (truncado em MAX_TERMO - 1 caracteres)
+        char termo[MAX_TERMO];
+        int tamanho = 0;
+        while (normalizado[i] && caractere_de_termo((unsigned char)normalizado[i])) {
+            if (tamanho < MAX_TERMO - 1) {
+                termo[tamanho++] = normalizado[i];
+            }
+            i++;
+        }
+        termo[tamanho] = '\0';
+        (*total_ocorrencias)++;
+
+        // Acumula a frequência se o termo já apareceu
+        int existente = -1;
+        for (int t = 0; t < total; t++) {
+            if (strcmp(termos[t], termo) == 0) {
+                existente = t;
+                break;
+            }
+        }
+
+        if (existente >= 0) {
+            frequencias[existente]++;
+        } else if (total < MAX_TERMOS_LIVRO) {
+            strcpy(termos[total], termo);
+            frequencias[total] = 1;
+            total++;
+        }
+    }
+
+    return total;
+}
+
+/**
+ * Extrai os termos do título e do autor de um livro
+ */
+static int termos_do_livro(NoLivro* livro, char termos[][MAX_TERMO], int* frequencias,
+                           int* total_ocorrencias) {
+    *total_ocorrencias = 0;
+    int total = extrair_termos(livro->dados.titulo, termos, frequencias, 0, total_ocorrencias);
+    return extrair_termos(livro->dados.autor, termos, frequencias, total, total_ocorrencias);
+}
+
+/**
+ * Procura um termo na tabela hash do índice
+ */
+static TermoIndexado* procurar_termo(IndiceTextual* indice, const char* termo) {
+    TermoIndexado* atual = indice->baldes[calcular_hash(termo) % indice->capacidade];
+    while (atual != NULL) {
+        if (strcmp(atual->termo, termo) == 0) {
+            return atual;
+        }
+        atual = atual->proximo;
+    }
+    return NULL;
+}
+
+/**
+ * Dobra o número de baldes da tabela de termos
+ */
+static bool redimensionar_indice(IndiceTextual* indice) {
+    int nova_capacidade = indice->capacidade * 2;
+    TermoIndexado** novos = (TermoIndexado**)calloc(nova_capacidade, sizeof(TermoIndexado*));
+    if (novos == NULL) {
+        return false;
+    }
+
+    for (int i = 0; i < indice->capacidade; i++) {
+        TermoIndexado* atual = indice->baldes[i];
+        while (atual != NULL) {
+            TermoIndexado* proximo = atual->proximo;
+            unsigned int balde = calcular_hash(atual->termo) % nova_capacidade;
+            atual->proximo = novos[balde];
+            novos[balde] = atual;
+            atual = proximo;
+        }
+    }
+
+    free(indice->baldes);
+    indice->baldes = novos;
+    indice->capacidade = nova_capacidade;
+    return true;
+}
+
+/**
+ * Retira as ocorrências de um livro de todos os seus termos
+ * (não altera as estatísticas do índice)
+ */
+static void remover_ocorrencias(IndiceTextual* indice, NoLivro* livro) {
+    char termos[MAX_TERMOS_LIVRO][MAX_TERMO];
+    int frequencias[MAX_TERMOS_LIVRO];
+    int total_ocorrencias;
+    int total = termos_do_livro(livro, termos, frequencias, &total_ocorrencias);
+
+    for (int t = 0; t < total; t++) {
+        unsigned int balde = calcular_hash(termos[t]) % indice->capacidade;
+        TermoIndexado* atual = indice->baldes[balde];
+        TermoIndexado* anterior = NULL;
+
+        while (atual != NULL && strcmp(atual->termo, termos[t]) != 0) {
+            anterior = atual;
+            atual = atual->proximo;
+        }
+        if (atual == NULL) {
+            continue;
+        }
+
+        // Remove a ocorrência trocando-a pela última do vetor
+        for (int i = 0; i < atual->total; i++) {
+            if (atual->ocorrencias[i].livro == livro) {
+                atual->ocorrencias[i] = atual->ocorrencias[atual->total - 1];
+                atual->total--;
+                break;
+            }
+        }
+
+        // Termo sem ocorrências é retirado da tabela
+        if (atual->total == 0) {
+            if (anterior == NULL) {
+                indice->baldes[balde] = atual->proximo;
+            } else {
+                anterior->proximo = atual->proximo;
+            }
+            free(atual->ocorrencias);
+            free(atual);
+            indice->total_termos--;
+        }
+    }
+}
+
+/**
+ * Cria um índice textual vazio
+ */
+IndiceTextual* criar_indice_textual() {
+    IndiceTextual* indice = (IndiceTextual*)malloc(sizeof(IndiceTextual));
+    if (indice == NULL) {
+        return NULL;
+    }
+
+    indice->capacidade = 64;
+    indice->baldes = (TermoIndexado**)calloc(indice->capacidade, sizeof(TermoIndexado*));
+    if (indice->baldes == NULL) {
+        free(indice);
+        return NULL;
+    }
+
+    indice->total_termos = 0;
+    indice->total_documentos = 0;
+    indice->soma_termos = 0;
+    return indice;
+}
+
+/**
+ * Indexa os termos do título e do autor de um livro
+ */
+bool indice_textual_adicionar(IndiceTextual* indice, NoLivro* livro) {
+    if (indice == NULL || livro == NULL) {
+        return false;
+    }
+
+    char termos[MAX_TERMOS_LIVRO][MAX_TERMO];
+    int frequencias[MAX_TERMOS_LIVRO];
+    int total_ocorrencias;
+    int total = termos_do_livro(livro, termos, frequencias, &total_ocorrencias);
+
+    for (int t = 0; t < total; t++) {
+        TermoIndexado* termo = procurar_termo(indice, termos[t]);
+
+        if (termo == NULL) {
+            // Termo novo - cria a entrada na tabela
+            termo = (TermoIndexado*)malloc(sizeof(TermoIndexado));
+            if (termo == NULL) {
+                remover_ocorrencias(indice, livro); // Desfaz a indexação parcial
+                return false;
+            }
+            strcpy(termo->termo, termos[t]);
+            termo->ocorrencias = NULL;
+            termo->total = 0;
+            termo->capacidade = 0;
+
+            unsigned int balde = calcular_hash(termo->termo) % indice->capacidade;
+            termo->proximo = indice->baldes[balde];
+            indice->baldes[balde] = termo;
+            indice->total_termos++;
+        }
+
+        // Garante espaço no vetor de ocorrências
+        if (termo->total == termo->capacidade) {
+            int nova_capacidade = termo->capacidade == 0 ? 4 : termo->capacidade * 2;
+            Ocorrencia* novas = (Ocorrencia*)realloc(termo->ocorrencias,
+                                                     nova_capacidade * sizeof(Ocorrencia));
+            if (novas == NULL) {
+                remover_ocorrencias(indice, livro);
+                return false;
+            }
+            termo->ocorrencias = novas;
+            termo->capacidade = nova_capacidade;
+        }
+
+        termo->ocorrencias[termo->total].livro = livro;
+        termo->ocorrencias[termo->total].frequencia = frequencias[t];
+        termo->total++;
+    }
+
+    livro->termos_indexados = total_ocorrencias;
+    indice->total_documentos++;
+    indice->soma_termos += total_ocorrencias;
+
+    // Mantém em média no máximo um termo por balde
+    if (indice->total_termos > indice->capacidade) {
+        redimensionar_indice(indice);
+    }
+
+    return true;
+}
+
+/**
+ * Remove do índice todas as ocorrências de um livro
+ */
+void indice_textual_remover(IndiceTextual* indice, NoLivro* livro) {
+    if (indice == NULL || livro == NULL) {
+        return;
+    }
+
+    remover_ocorrencias(indice, livro);
+    indice->total_documentos--;
+    indice->soma_termos -= livro->termos_indexados;
+}
+
+/**
+ * Procura um termo no índice
+ */
+TermoIndexado* indice_textual_buscar(IndiceTextual* indice, const char* termo) {
+    if (indice == NULL || termo == NULL) {
+        return NULL;
+    }
+    return procurar_termo(indice, termo);
+}
+
+/**
+ * Libera toda a memória do índice textual
+ */
+void liberar_indice_textual(IndiceTextual* indice) {
+    if (indice == NULL) return;
+
+    for (int i = 0; i < indice->capacidade; i++) {
+        TermoIndexado* atual = indice->baldes[i];
+        while (atual != NULL) {
+            TermoIndexado* proximo = atual->proximo;
+            free(atual->ocorrencias);
+            free(atual);
+            atual = proximo;
+        }
+    }
+
+    free(indice->baldes);
+    free(indice);
+}
+
+/**
+ * Acumulador de pontuação por livro (tabela hash com endereçamento aberto)
+ */
+typedef struct {
+    NoLivro* livro;
+    double pontuacao;
+} Acumulador;
+
+/**
+ * Compara dois resultados: maior pontuação primeiro, empate por título
+ */
+static bool mais_relevante(const ResultadoRanqueado* a, const ResultadoRanqueado* b) {
+    if (a->pontuacao != b->pontuacao) {
+        return a->pontuacao > b->pontuacao;
+    }
+    return strcmp(a->livro->titulo_busca, b->livro->titulo_busca) < 0;
+}
+
+/**
+ * Restaura a propriedade do heap de mínimo (o menos relevante fica no topo)
+ */
+static void descer_no_heap(ResultadoRanqueado* heap, int total, int i) {
+    while (true) {
+        int menor = i;
+        int esquerda = 2 * i + 1;
+        int direita = 2 * i + 2;
+
+        if (esquerda < total && mais_relevante(&heap[menor], &heap[esquerda])) menor = esquerda;
+        if (direita < total && mais_relevante(&heap[menor], &heap[direita])) menor = direita;
+        if (menor == i) return;
+
+        ResultadoRanqueado troca = heap[i];
+        heap[i] = heap[menor];
+        heap[menor] = troca;
+        i = menor;
+    }
+}
+
+/**
+ * Busca livros por palavras-chave no título e no autor, ranqueados por BM25
+ */
+int buscar_por_palavras_chave(ListaLivros* lista, const char* consulta,
+                              ResultadoRanqueado* resultados, int k) {
+    if (lista == NULL || consulta == NULL || resultados == NULL || k <= 0) {
+        return 0;
+    }
+
+    IndiceTextual* indice = lista->indice_textual;
+    if (indice == NULL || indice->total_documentos == 0) {
+        return 0;
+    }
+
+    // Separa a consulta em termos (termos repetidos contam uma vez)
+    char termos[MAX_TERMOS_LIVRO][MAX_TERMO];
+    int frequencias[MAX_TERMOS_LIVRO];
+    int total_ocorrencias = 0;
+    int total_termos = extrair_termos(consulta, termos, frequencias, 0, &total_ocorrencias);
+
+    TermoIndexado* encontrados[MAX_TERMOS_LIVRO];
+    int total_encontrados = 0;
+    long long total_postagens = 0;
+    for (int t = 0; t < total_termos; t++) {
+        TermoIndexado* termo = procurar_termo(indice, termos[t]);
+        if (termo != NULL) {
+            encontrados[total_encontrados++] = termo;
+            total_postagens += termo->total;
+        }
+    }
+    if (total_encontrados == 0) {
+        return 0;
+    }
+
+    // Tabela de acumuladores com pelo menos o dobro de posições necessárias
+    int capacidade = 16;
+    while (capacidade < 2 * total_postagens) {
+        capacidade *= 2;
+    }
+    Acumulador* acumuladores = (Acumulador*)calloc(capacidade, sizeof(Acumulador));
+    if (acumuladores == NULL) {
+        printf("Erro: Falha ao alocar memória para a busca!\n");
+        return 0;
+    }
+
+    double n = indice->total_documentos;
+    double media_termos = (double)indice->soma_termos / n;
+
+    // Soma a contribuição BM25 de cada termo em cada livro que o contém
+    for (int t = 0; t < total_encontrados; t++) {
+        TermoIndexado* termo = encontrados[t];
+        double df = termo->total;
+        double idf = log(1.0 + (n - df + 0.5) / (df + 0.5));
+
+        for (int i = 0; i < termo->total; i++) {
+            NoLivro* livro = termo->ocorrencias[i].livro;
+            double tf = termo->ocorrencias[i].frequencia;
+            double normalizacao = BM25_K1 * (1.0 - BM25_B + BM25_B * livro->termos_indexados / media_termos);
+            double parcela = idf * tf * (BM25_K1 + 1.0) / (tf + normalizacao);
+
+            unsigned int posicao = (unsigned int)(((uintptr_t)livro >> 4) * 2654435761u) & (capacidade - 1);
+            while (acumuladores[posicao].livro != NULL && acumuladores[posicao].livro != livro) {
+                posicao = (posicao + 1) & (capacidade - 1);
+            }
+            acumuladores[posicao].livro = livro;
+            acumuladores[posicao].pontuacao += parcela;
+        }
+    }
+
+    // Seleciona os k melhores com um heap de mínimo de tamanho k
+    int total = 0;
+    for (int i = 0; i < capacidade; i++) {
+        if (acumuladores[i].livro == NULL) {
+            continue;
+        }
+
+        ResultadoRanqueado candidato = { acumuladores[i].livro, acumuladores[i].pontuacao };
+        if (total < k) {
+            // Heap ainda incompleto: insere e sobe até a posição correta
+            int j = total++;
+            resultados[j] = candidato;
+            while (j > 0 && mais_relevante(&resultados[(j - 1) / 2], &resultados[j])) {
+                ResultadoRanqueado troca = resultados[j];
+                resultados[j] = resultados[(j - 1) / 2];
+                resultados[(j - 1) / 2] = troca;
+                j = (j - 1) / 2;
+            }
+        } else if (mais_relevante(&candidato, &resultados[0])) {
+            // Substitui o menos relevante dos k atuais
+            resultados[0] = candidato;
+            descer_no_heap(resultados, total, 0);
+        }
+    }
+
+    free(acumuladores);
+
+    // Ordena do mais relevante para o menos relevante (extraindo do heap)
+    for (int fim = total - 1; fim > 0; fim--) {
+        ResultadoRanqueado troca = resultados[0];
+        resultados[0] = resultados[fim];
+        resultados[fim] = troca;
+        descer_no_heap(resultados, fim, 0);
+    }
+
+    return total;
+}
+
+// =============================================================================
+// ÁRVORE RADIX (AUTOCOMPLETAR TÍTULOS)
+// =============================================================================
+
+/**
+ * Compara a popularidade de dois livros: mais empréstimos primeiro,
+ * empate decidido pela ordem alfabética do título
+ */
+static bool mais_popular(const NoLivro* a, const NoLivro* b) {
+    if (a->total_emprestimos != b->total_emprestimos) {
+        return a->total_emprestimos > b->total_emprestimos;
+    }
+    return strcmp(a->titulo_busca, b->titulo_busca) < 0;
+}
+
+/**
+ * Insere um livro em um vetor de sugestões ordenado, limitado a MAX_SUGESTOES
+ */
+static void inserir_sugestao(NoLivro** sugestoes, int* total, NoLivro* livro) {
+    int i = *total;
+    if (i == MAX_SUGESTOES) {
+        if (!mais_popular(livro, sugestoes[MAX_SUGESTOES - 1])) {
+            return;
+        }
+        i = MAX_SUGESTOES - 1;
+    } else {
+        (*total)++;
+    }
+
+    while (i > 0 && mais_popular(livro, sugestoes[i - 1])) {
+        sugestoes[i] = sugestoes[i - 1];
+        i--;
+    }
+    sugestoes[i] = livro;
+}
+
+/**
+ * Oferece um livro às sugestões de um nó (novo ou com popularidade maior)
+ */
+static void oferecer_sugestao(NoTrie* no, NoLivro* livro) {
+    int i = 0;
+    while (i < no->total_sugestoes && no->sugestoes[i] != livro) {
+        i++;
+    }
+
+    if (i == no->total_sugestoes) {
+        inserir_sugestao(no->sugestoes, &no->total_sugestoes, livro);
+        return;
+    }
+
+    // Já é sugestão: apenas sobe até a nova posição
+    while (i > 0 && mais_popular(livro, no->sugestoes[i - 1])) {
+        no->sugestoes[i] = no->sugestoes[i - 1];
+        i--;
+    }
+    no->sugestoes[i] = livro;
+}
+
+/**
+ * Recalcula as sugestões de um nó a partir dos seus livros e dos seus filhos
+ */
+static void recalcular_sugestoes(NoTrie* no) {
+    no->total_sugestoes = 0;
+
+    for (int i = 0; i < no->total_livros; i++) {
+        inserir_sugestao(no->sugestoes, &no->total_sugestoes, no->livros[i]);
+    }
+    for (int f = 0; f < no->total_filhos; f++) {
+        NoTrie* filho = no->filhos[f];
+        for (int i = 0; i < filho->total_sugestoes; i++) {
+            inserir_sugestao(no->sugestoes, &no->total_sugestoes, filho->sugestoes[i]);
+        }
+    }
+}
+
+/**
+ * Cria um nó da árvore com os primeiros 'tamanho' caracteres do rótulo
+ */
+static NoTrie* criar_no_trie(const char* rotulo, int tamanho) {
+    NoTrie* no = (NoTrie*)malloc(sizeof(NoTrie));
+    if (no == NULL) {
+        return NULL;
+    }
+
+    no->rotulo = (char*)malloc(tamanho + 1);
+    if (no->rotulo == NULL) {
+        free(no);
+        return NULL;
+    }
+    memcpy(no->rotulo, rotulo, tamanho);
+    no->rotulo[tamanho] = '\0';
+
+    no->filhos = NULL;
+    no->total_filhos = 0;
+    no->livros = NULL;
+    no->total_livros = 0;
+    no->total_sugestoes = 0;
+    return no;
+}
+
+/**
+ * Procura (busca binária) o filho cujo rótulo começa com o caractere c
+ * Retorna: Índice do filho, ou -1 (posicao recebe onde ele deveria ser inserido)
+ */
+static int procurar_filho(NoTrie* no, char c, int* posicao) {
+    int inicio = 0;
+    int fim = no->total_filhos - 1;
+    unsigned char alvo = (unsigned char)c;
+
+    while (inicio <= fim) {
+        int meio = (inicio + fim) / 2;
+        unsigned char primeiro = (unsigned char)no->filhos[meio]->rotulo[0];
+        if (primeiro == alvo) {
+            return meio;
+        } else if (primeiro < alvo) {
+            inicio = meio + 1;
+        } else {
+            fim = meio - 1;
+        }
+    }
+
+    if (posicao != NULL) {
+        *posicao = inicio;
+    }
+    return -1;
+}
+
+/**
+ * Libera recursivamente um nó e toda a sua subárvore
+ */
+static void liberar_no_trie(NoTrie* no) {
+    if (no == NULL) return;
+
+    for (int i = 0; i < no->total_filhos; i++) {
+        liberar_no_trie(no->filhos[i]);
+    }
+    free(no->filhos);
+    free(no->livros);
+    free(no->rotulo);
+    free(no);
+}
+
+/**
+ * Percorre a árvore seguindo o título completo do livro
+ * Retorna: Profundidade do caminho (0 se o título não estiver na árvore)
+ */
+static int caminho_do_titulo(TrieTitulos* trie, const char* chave, NoTrie** caminho, int* indices) {
+    NoTrie* atual = trie->raiz;
+    int profundidade = 0;
+    caminho[profundidade] = atual;
+    indices[profundidade++] = -1;
+
+    int i = 0;
+    while (chave[i]) {
+        int f = procurar_filho(atual, chave[i], NULL);
+        if (f < 0) {
+            return 0;
+        }
+
+        NoTrie* filho = atual->filhos[f];
+        int tamanho = (int)strlen(filho->rotulo);
+        if (strncmp(filho->rotulo, chave + i, tamanho) != 0) {
+            return 0;
+        }
+
+        atual = filho;
+        caminho[profundidade] = atual;
+        indices[profundidade++] = f;
+        i += tamanho;
+    }
+
+    return profundidade;
+}
+
+/**
+ * Funde um nó sem livros com o seu único filho (mantém a árvore compacta)
+ */
+static void fundir_com_filho(NoTrie* no) {
+    NoTrie* filho = no->filhos[0];
+    size_t tamanho_no = strlen(no->rotulo);
+    size_t tamanho_filho = strlen(filho->rotulo);
+
+    char* rotulo = (char*)malloc(tamanho_no + tamanho_filho + 1);
+    if (rotulo == NULL) {
+        return; // Sem memória: a árvore continua correta, apenas menos compacta
+    }
+    memcpy(rotulo, no->rotulo, tamanho_no);
+    memcpy(rotulo + tamanho_no, filho->rotulo, tamanho_filho + 1);
+
+    free(no->rotulo);
+    free(no->filhos);
+    free(no->livros);
+
+    no->rotulo = rotulo;
+    no->filhos = filho->filhos;
+    no->total_filhos = filho->total_filhos;
+    no->livros = filho->livros;
+    no->total_livros = filho->total_livros;
+    memcpy(no->sugestoes, filho->sugestoes, sizeof(no->sugestoes));
+    no->total_sugestoes = filho->total_sugestoes;
+
+    free(filho->rotulo);
+    free(filho);
+}
+
+/**
+ * Cria uma árvore de títulos vazia
+ */
+TrieTitulos* criar_trie_titulos() {
+    TrieTitulos* trie = (TrieTitulos*)malloc(sizeof(TrieTitulos));
+    if (trie == NULL) {
+        return NULL;
+    }
+
+    trie->raiz = criar_no_trie("", 0);
+    if (trie->raiz == NULL) {
+        free(trie);
+        return NULL;
+    }
+
+    trie->total = 0;
+    return trie;
+}
+
+/**
+ * Insere o título de um livro na árvore
+ */
+bool trie_titulos_adicionar(TrieTitulos* trie, NoLivro* livro) {
+    if (trie == NULL || livro == NULL) {
+        return false;
+    }
+
+    char chave[MAX_TITULO];
+    normalizar_texto(chave, livro->dados.titulo);
+
+    NoTrie* caminho[MAX_TITULO + 1];
+    int profundidade = 0;
+    NoTrie* atual = trie->raiz;
+    caminho[profundidade++] = atual;
+
+    // Folha criada nesta inserção (desfeita se a última alocação falhar)
+    NoTrie* pai_folha = NULL;
+    int posicao_folha = 0;
+
+    int i = 0;
+    while (chave[i]) {
+        int posicao;
+        int f = procurar_filho(atual, chave[i], &posicao);
+
+        if (f < 0) {
+            // Nenhum filho começa com este caractere: cria uma folha com o restante
+            NoTrie* folha = criar_no_trie(chave + i, (int)strlen(chave + i));
+            NoTrie** filhos = (NoTrie**)realloc(atual->filhos, (atual->total_filhos + 1) * sizeof(NoTrie*));
+            if (folha == NULL || filhos == NULL) {
+                liberar_no_trie(folha);
+                if (filhos != NULL) atual->filhos = filhos;
+                return false;
+            }
+            atual->filhos = filhos;
+            memmove(&filhos[posicao + 1], &filhos[posicao],
+                    (atual->total_filhos - posicao) * sizeof(NoTrie*));
+            filhos[posicao] = folha;
+            atual->total_filhos++;
+            pai_folha = atual;
+            posicao_folha = posicao;
+
+            atual = folha;
+            caminho[profundidade++] = atual;
+            break;
+        }
+
+        NoTrie* filho = atual->filhos[f];
+        int comum = 0;
+        while (filho->rotulo[comum] && filho->rotulo[comum] == chave[i + comum]) {
+            comum++;
+        }
+
+        if (filho->rotulo[comum] != '\0') {
+            // O título diverge no meio da aresta: divide-a em um nó intermediário
+            NoTrie* meio = criar_no_trie(filho->rotulo, comum);
+            NoTrie** filhos_meio = (NoTrie**)malloc(sizeof(NoTrie*));
+            char* resto = (char*)malloc(strlen(filho->rotulo + comum) + 1);
+            if (meio == NULL || filhos_meio == NULL || resto == NULL) {
+                liberar_no_trie(meio);
+                free(filhos_meio);
+                free(resto);
+                return false;
+            }
+
+            strcpy(resto, filho->rotulo + comum);
+            free(filho->rotulo);
+            filho->rotulo = resto;
+
+            filhos_meio[0] = filho;
+            meio->filhos = filhos_meio;
+            meio->total_filhos = 1;
+            memcpy(meio->sugestoes, filho->sugestoes, sizeof(meio->sugestoes));
+            meio->total_sugestoes = filho->total_sugestoes;
+
+            atual->filhos[f] = meio;
+            filho = meio;
+        }
+
+        atual = filho;
+        caminho[profundidade++] = atual;
+        i += comum;
+    }
+
+    // Registra o livro no nó onde o título termina
+    NoLivro** livros = (NoLivro**)realloc(atual->livros, (atual->total_livros + 1) * sizeof(NoLivro*));
+    if (livros == NULL) {
+        if (pai_folha != NULL) {
+            // A folha nova ainda não tem livro: sai da árvore
+            pai_folha->total_filhos--;
+            memmove(&pai_folha->filhos[posicao_folha], &pai_folha->filhos[posicao_folha + 1],
+                    (pai_folha->total_filhos - posicao_folha) * sizeof(NoTrie*));
+            liberar_no_trie(atual);
+        }
+        return false;
+    }
+    atual->livros = livros;
+    livros[atual->total_livros++] = livro;
+
+    // Todos os nós do caminho passam a considerar o novo título
+    for (int p = 0; p < profundidade; p++) {
+        oferecer_sugestao(caminho[p], livro);
+    }
+
+    trie->total++;
+    return true;
+}
+
+/**
+ * Localiza um livro pelo título exato, sem percorrer o catálogo
+ */
+NoLivro* trie_titulos_buscar(TrieTitulos* trie, const char* titulo) {
+    if (trie == NULL || titulo == NULL || strlen(titulo) >= MAX_TITULO) {
+        return NULL;
+    }
+
+    char chave[MAX_TITULO];
+    normalizar_texto(chave, titulo);
+
+    NoTrie* caminho[MAX_TITULO + 1];
+    int indices[MAX_TITULO + 1];
+    int profundidade = caminho_do_titulo(trie, chave, caminho, indices);
+    if (profundidade == 0) {
+        return NULL;
+    }
+
+    NoTrie* final = caminho[profundidade - 1];
+    for (int i = 0; i < final->total_livros; i++) {
+        if (iguais_sem_caixa(final->livros[i]->dados.titulo, titulo)) {
+            return final->livros[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Remove o título de um livro da árvore
+ */
+void trie_titulos_remover(TrieTitulos* trie, NoLivro* livro) {
+    if (trie == NULL || livro == NULL) {
+        return;
+    }
+
+    char chave[MAX_TITULO];
+    normalizar_texto(chave, livro->dados.titulo);
+
+    NoTrie* caminho[MAX_TITULO + 1];
+    int indices[MAX_TITULO + 1];
+    int profundidade = caminho_do_titulo(trie, chave, caminho, indices);
+    if (profundidade == 0) {
+        return;
+    }
+
+    // Retira o livro do nó final
+    NoTrie* final = caminho[profundidade - 1];
+    int i = 0;
+    while (i < final->total_livros && final->livros[i] != livro) {
+        i++;
+    }
+    if (i == final->total_livros) {
+        return;
+    }
+    final->livros[i] = final->livros[--final->total_livros];
+    trie->total--;
+
+    // Remove nós que ficaram vazios e funde os que ficaram com um único filho
+    if (final != trie->raiz && final->total_livros == 0) {
+        if (final->total_filhos == 0) {
+            NoTrie* pai = caminho[profundidade - 2];
+            int f = indices[profundidade - 1];
+            memmove(&pai->filhos[f], &pai->filhos[f + 1], (pai->total_filhos - f - 1) * sizeof(NoTrie*));
+            pai->total_filhos--;
+            liberar_no_trie(final);
+            profundidade--;
+
+            if (pai != trie->raiz && pai->total_livros == 0 && pai->total_filhos == 1) {
+                fundir_com_filho(pai);
+            }
+        } else if (final->total_filhos == 1) {
+            fundir_com_filho(final);
+        }
+    }
+
+    // Atualiza as sugestões do caminho, de baixo para cima
+    for (int p = profundidade - 1; p >= 0; p--) {
+        recalcular_sugestoes(caminho[p]);
+    }
+}
+
+/**
+ * Reposiciona um livro nas sugestões após um novo empréstimo
+ */
+void trie_titulos_atualizar(TrieTitulos* trie, NoLivro* livro) {
+    if (trie == NULL || livro == NULL) {
+        return;
+    }
+
+    char chave[MAX_TITULO];
+    normalizar_texto(chave, livro->dados.titulo);
+
+    NoTrie* caminho[MAX_TITULO + 1];
+    int indices[MAX_TITULO + 1];
+    int profundidade = caminho_do_titulo(trie, chave, caminho, indices);
+
+    for (int p = 0; p < profundidade; p++) {
+        oferecer_sugestao(caminho[p], livro);
+    }
+}
+
+/**
+ * Libera toda a memória da árvore de títulos
+ */
+void liberar_trie_titulos(TrieTitulos* trie) {
+    if (trie == NULL) return;
+
+    liberar_no_trie(trie->raiz);
+    free(trie);
+}
+
+/**
+ * Sugere os títulos mais emprestados que começam com o prefixo digitado
+ */
+int sugerir_titulos(ListaLivros* lista, const char* prefixo, NoLivro** sugestoes, int maximo) {
+    if (lista == NULL || lista->trie_titulos == NULL || prefixo == NULL || sugestoes == NULL) {
+        return 0;
+    }
+
+    // Nenhum título cadastrado é maior que MAX_TITULO
+    if (strlen(prefixo) >= MAX_TITULO) {
+        return 0;
+    }
+
+    char chave[MAX_TITULO];
+    normalizar_texto(chave, prefixo);
+
+    // Desce pela árvore consumindo o prefixo
+    NoTrie* atual = lista->trie_titulos->raiz;
+    int i = 0;
+    while (chave[i]) {
+        int f = procurar_filho(atual, chave[i], NULL);
+        if (f < 0) {
+            return 0;
+        }
+
+        NoTrie* filho = atual->filhos[f];
+        int comum = 0;
+        while (filho->rotulo[comum] && chave[i + comum] && filho->rotulo[comum] == chave[i + comum]) {
+            comum++;
+        }
+
+        if (filho->rotulo[comum] != '\0' && chave[i + comum] != '\0') {
+            return 0; // O prefixo diverge no meio da aresta
+        }
+
+        atual = filho;
+        i += comum;
+    }
+
+    int total = atual->total_sugestoes < maximo ? atual->total_sugestoes : maximo;
+    for (int s = 0; s < total; s++) {
+        sugestoes[s] = atual->sugestoes[s];
+    }
+    return total;
+}
@@ -0,0 +1,259 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: busca.h
+ * Descrição: Estruturas e funções de busca avançada no catálogo
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef BUSCA_H
+#define BUSCA_H
+
+#include "biblioteca.h"
+
+// =============================================================================
+// CONSTANTES DE BUSCA
+// =============================================================================
+
+#define MAX_RESULTADOS_BUSCA 10     // Máximo de resultados exibidos pelo menu
+#define DISTANCIA_PADRAO 2          // Distância de edição padrão da busca aproximada
+#define MAX_TERMO 50                // Tamanho máximo de um termo indexado
+#define MAX_TERMOS_LIVRO 100        // Máximo de termos distintos por livro
+#define BM25_K1 1.2                 // Saturação da frequência do termo (BM25)
+#define BM25_B 0.75                 // Normalização pelo tamanho do documento (BM25)
+#define MAX_SUGESTOES 5             // Sugestões guardadas em cada nó da árvore de prefixos
+
+// =============================================================================
+// BUSCA APROXIMADA (DISTÂNCIA DE EDIÇÃO)
+// =============================================================================
+
+/**
+ * Resultado de uma busca aproximada por título
+ */
+typedef struct {
+    NoLivro* livro;     // Livro encontrado
+    int distancia;      // Distância de edição até o termo buscado
+} ResultadoAproximado;
+
+/**
+ * Calcula a distância de edição (Levenshtein) entre duas strings
+ * Usa o algoritmo bit-paralelo de Myers quando o padrão cabe em 64 bits
+ * e programação dinâmica com faixa limitada nos demais casos.
+ * Parâmetros:
+ *   - padrao: Primeira string (já em minúsculas)
+ *   - texto: Segunda string (já em minúsculas)
+ *   - limite: Distância máxima de interesse
+ * Retorna: A distância, ou limite + 1 se ela ultrapassar o limite
+ */
+int distancia_edicao(const char* padrao, const char* texto, int limite);
+
+/**
+ * Busca os k títulos mais próximos do termo informado (case-insensitive)
+ * Parâmetros:
+ *   - lista: Ponteiro para a lista de livros
+ *   - titulo: Termo buscado (pode conter erros de digitação)
+ *   - distancia_maxima: Distância de edição máxima aceita
+ *   - resultados: Vetor que recebe os resultados, do mais próximo ao mais distante
+ *   - k: Capacidade do vetor de resultados
+ * Retorna: Número de resultados encontrados (no máximo k)
+ */
+int buscar_titulo_aproximado(ListaLivros* lista, const char* titulo, int distancia_maxima,
+                             ResultadoAproximado* resultados, int k);
+
+// =============================================================================
+// ÍNDICE INVERTIDO (BUSCA POR PALAVRAS-CHAVE COM BM25)
+// =============================================================================
+
+/**
+ * Ocorrência de um termo em um livro
+ */
+typedef struct {
+    NoLivro* livro;     // Livro em que o termo aparece
+    int frequencia;     // Quantas vezes o termo aparece no título + autor
+} Ocorrencia;
+
+/**
+ * Termo do índice com sua lista de ocorrências (encadeado por balde)
+ */
+typedef struct TermoIndexado {
+    char termo[MAX_TERMO];          // Termo normalizado (minúsculas, sem acentos)
+    Ocorrencia* ocorrencias;        // Vetor dinâmico de ocorrências
+    int total;                      // Número de livros que contêm o termo
+    int capacidade;                 // Capacidade alocada do vetor
+    struct TermoIndexado* proximo;  // Próximo termo no mesmo balde
+} TermoIndexado;
+
+/**
+ * Índice invertido sobre título e autor dos livros
+ */
+typedef struct IndiceTextual {
+    TermoIndexado** baldes;     // Tabela hash de termos
+    int capacidade;             // Número de baldes
+    int total_termos;           // Termos distintos indexados
+    int total_documentos;       // Livros indexados
+    long long soma_termos;      // Soma do número de termos de todos os livros
+} IndiceTextual;
+
+/**
+ * Resultado de uma busca ranqueada
+ */
+typedef struct {
+    NoLivro* livro;     // Livro encontrado
+    double pontuacao;   // Relevância BM25 (maior = mais relevante)
+} ResultadoRanqueado;
+
+/**
+ * Cria um índice textual vazio
+ * Retorna: Ponteiro para o índice criado, ou NULL em caso de erro
+ */
+IndiceTextual* criar_indice_textual();
+
+/**
+ * Indexa os termos do título e do autor de um livro
+ * Parâmetros:
+ *   - indice: Ponteiro para o índice textual
+ *   - livro: Nó do livro a ser indexado
+ * Retorna: true se indexado com sucesso, false caso contrário
+ */
+bool indice_textual_adicionar(IndiceTextual* indice, NoLivro* livro);
+
+/**
+ * Remove do índice todas as ocorrências de um livro
+ * Parâmetros:
+ *   - indice: Ponteiro para o índice textual
+ *   - livro: Nó do livro a ser removido
+ */
+void indice_textual_remover(IndiceTextual* indice, NoLivro* livro);
+
+/**
+ * Procura um termo no índice
+ * Parâmetros:
+ *   - indice: Ponteiro para o índice
+ *   - termo: Termo já normalizado (minúsculas, sem acentos, até MAX_TERMO - 1 caracteres)
+ * Retorna: Termo com suas ocorrências, ou NULL se nenhum livro o contém
+ */
+TermoIndexado* indice_textual_buscar(IndiceTextual* indice, const char* termo);
+
+/**
+ * Libera toda a memória do índice textual
+ * Parâmetros:
+ *   - indice: Ponteiro para o índice a ser liberado
+ */
+void liberar_indice_textual(IndiceTextual* indice);
+
+/**
+ * Busca livros por palavras-chave no título e no autor, ranqueados por BM25
+ * Parâmetros:
+ *   - lista: Ponteiro para a lista de livros
+ *   - consulta: Palavras-chave separadas por espaço (ex.: "historia brasil")
+ *   - resultados: Vetor que recebe os resultados, do mais ao menos relevante
+ *   - k: Capacidade do vetor de resultados
+ * Retorna: Número de resultados encontrados (no máximo k)
+ */
+int buscar_por_palavras_chave(ListaLivros* lista, const char* consulta,
+                              ResultadoRanqueado* resultados, int k);
+
+// =============================================================================
+// ÁRVORE RADIX (AUTOCOMPLETAR TÍTULOS)
+// =============================================================================
+
+/**
+ * Nó da árvore radix (Patricia) de títulos normalizados
+ * Cada aresta guarda um trecho do título; cada nó guarda as sugestões
+ * mais populares de toda a sua subárvore.
+ */
+typedef struct NoTrie {
+    char* rotulo;                       // Trecho do título na aresta que chega ao nó
+    struct NoTrie** filhos;             // Filhos ordenados pelo primeiro caractere
+    int total_filhos;                   // Número de filhos
+    NoLivro** livros;                   // Livros cujo título termina neste nó
+    int total_livros;                   // Número de livros neste nó
+    NoLivro* sugestoes[MAX_SUGESTOES];  // Mais emprestados da subárvore (em ordem)
+    int total_sugestoes;                // Número de sugestões guardadas
+} NoTrie;
+
+/**
+ * Árvore radix de títulos
+ */
+typedef struct TrieTitulos {
+    NoTrie* raiz;       // Nó raiz (rótulo vazio)
+    int total;          // Total de títulos na árvore
+} TrieTitulos;
+
+/**
+ * Cria uma árvore de títulos vazia
+ * Retorna: Ponteiro para a árvore criada, ou NULL em caso de erro
+ */
+TrieTitulos* criar_trie_titulos();
+
+/**
+ * Insere o título de um livro na árvore
+ * Parâmetros:
+ *   - trie: Ponteiro para a árvore de títulos
+ *   - livro: Nó do livro a ser inserido
+ * Retorna: true se inserido com sucesso, false caso contrário
+ */
+bool trie_titulos_adicionar(TrieTitulos* trie, NoLivro* livro);
+
+/**
+ * Remove o título de um livro da árvore
+ * Parâmetros:
+ *   - trie: Ponteiro para a árvore de títulos
+ *   - livro: Nó do livro a ser removido
+ */
+void trie_titulos_remover(TrieTitulos* trie, NoLivro* livro);
+
+/**
+ * Reposiciona um livro nas sugestões após o aumento do seu número de empréstimos
+ * Parâmetros:
+ *   - trie: Ponteiro para a árvore de títulos
+ *   - livro: Nó do livro cuja popularidade aumentou
+ */
+void trie_titulos_atualizar(TrieTitulos* trie, NoLivro* livro);
+
+/**
+ * Localiza um livro pelo título exato (sem diferenciar maiúsculas), sem percorrer o catálogo
+ * Desce a árvore pelo título normalizado; entre os livros do nó final (títulos
+ * que só diferem em acentos), fica com o de título igual.
+ * Parâmetros:
+ *   - trie: Ponteiro para a árvore de títulos
+ *   - titulo: Título procurado (menor que MAX_TITULO)
+ * Retorna: Ponteiro para o livro, ou NULL se não existe
+ */
+NoLivro* trie_titulos_buscar(TrieTitulos* trie, const char* titulo);
+
+/**
+ * Libera toda a memória da árvore de títulos
+ * Parâmetros:
+ *   - trie: Ponteiro para a árvore a ser liberada
+ */
+void liberar_trie_titulos(TrieTitulos* trie);
+
+/**
+ * Sugere os títulos mais emprestados que começam com o prefixo digitado
+ * O custo depende apenas do tamanho do prefixo, não do tamanho do catálogo.
+ * Parâmetros:
+ *   - lista: Ponteiro para a lista de livros
+ *   - prefixo: Início do título (case-insensitive, sem considerar acentos)
+ *   - sugestoes: Vetor que recebe os livros sugeridos
+ *   - maximo: Capacidade do vetor (até MAX_SUGESTOES é aproveitado)
+ * Retorna: Número de sugestões
+ */
+int sugerir_titulos(ListaLivros* lista, const char* prefixo, NoLivro** sugestoes, int maximo);
+
+// =============================================================================
+// FUNÇÕES AUXILIARES DE BUSCA
+// =============================================================================
+
+/**
+ * Normaliza um texto para busca: minúsculas e sem acentos (UTF-8)
+ * Parâmetros:
+ *   - dest: Buffer de destino (pode ter o mesmo tamanho da origem)
+ *   - src: String original
+ */
+void normalizar_texto(char* dest, const char* src);
+
+#endif // BUSCA_H
@@ -0,0 +1,1024 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: consulta.c
+ * Descrição: Implementação da linguagem de filtros e do planejador de consultas
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#include "consulta.h"
+#include "busca.h"
+#include "indices.h"
+#include "leitores.h"
+#include "visoes.h"
+#include "textos.h"
+#include <limits.h>
+
+#define MAX_CONDICOES_PLANO 32      // Condições ligadas por "e" consideradas pelo planejador
+
+// =============================================================================
+// ANALISADOR LÉXICO
+// =============================================================================
+
+#define TOKEN_FIM 0                 // Fim do texto
+#define TOKEN_PALAVRA 1             // Palavra sem aspas (campo, palavra-chave ou valor)
+#define TOKEN_TEXTO 2               // Valor entre aspas
+#define TOKEN_OPERADOR 3            // Operador de comparação
+#define TOKEN_ABRE 4                // (
+#define TOKEN_FECHA 5               // )
+
+/**
+ * Token da consulta
+ */
+typedef struct TokenConsulta {
+    int tipo;                       // TOKEN_*
+    int operador;                   // OP_* (TOKEN_OPERADOR)
+    char texto[MAX_TITULO];         // Conteúdo (TOKEN_PALAVRA e TOKEN_TEXTO)
+    int posicao;                    // Posição no texto (para as mensagens de erro)
+} TokenConsulta;
+
+/**
+ * Estado do analisador: texto, posição e token atual
+ */
+typedef struct AnalisadorConsulta {
+    const char* texto;              // Consulta digitada
+    int posicao;                    // Próximo caractere a ler
+    TokenConsulta atual;            // Token atual
+    bool erro;                      // Já houve erro (a mensagem foi exibida)
+} AnalisadorConsulta;
+
+/**
+ * Exibe um erro de sintaxe (apenas o primeiro)
+ */
+static void erro_consulta(AnalisadorConsulta* analisador, const char* mensagem) {
+    if (!analisador->erro) {
+        printf("Erro: %s (posição %d da consulta)\n", mensagem, analisador->atual.posicao + 1);
+        analisador->erro = true;
+    }
+}
+
+/**
+ * Indica se um caractere encerra uma palavra sem aspas
+ */
+static bool separador_consulta(char c) {
+    return c == '\0' || isspace((unsigned char)c) || strchr("()=!<>~^:\"", c) != NULL;
+}
+
+/**
+ * Lê o próximo token
+ */
+static void avancar(AnalisadorConsulta* analisador) {
+    const char* texto = analisador->texto;
+    TokenConsulta* token = &analisador->atual;
+
+    while (isspace((unsigned char)texto[analisador->posicao])) {
+        analisador->posicao++;
+    }
+
+    token->posicao = analisador->posicao;
+    token->texto[0] = '\0';
+    char c = texto[analisador->posicao];
+
+    if (c == '\0') {
+        token->tipo = TOKEN_FIM;
+        return;
+    }
+    if (c == '(' || c == ')') {
+        token->tipo = (c == '(') ? TOKEN_ABRE : TOKEN_FECHA;
+        analisador->posicao++;
+        return;
+    }
+
+    if (strchr("=!<>~^:", c) != NULL) {
+        char seguinte = texto[analisador->posicao + 1];
+        token->tipo = TOKEN_OPERADOR;
+        analisador->posicao++;
+
+        if (c == '!' && seguinte != '=') {
+            erro_consulta(analisador, "Use != para diferente");
+            token->tipo = TOKEN_FIM;
+            return;
+        }
+        if ((c == '!' || c == '<' || c == '>') && seguinte == '=') {
+            analisador->posicao++;
+        }
+
+        switch (c) {
+            case '=': token->operador = OP_IGUAL; break;
+            case '!': token->operador = OP_DIFERENTE; break;
+            case '<': token->operador = (seguinte == '=') ? OP_MENOR_IGUAL : OP_MENOR; break;
+            case '>': token->operador = (seguinte == '=') ? OP_MAIOR_IGUAL : OP_MAIOR; break;
+            case '~': token->operador = OP_CONTEM; break;
+            case '^': token->operador = OP_COMECA; break;
+            default: token->operador = OP_PALAVRA; break;
+        }
+        return;
+    }
+
+    // Texto entre aspas ou palavra
+    bool entre_aspas = (c == '"');
+    int inicio = analisador->posicao + (entre_aspas ? 1 : 0);
+    int fim = inicio;
+
+    if (entre_aspas) {
+        while (texto[fim] != '\0' && texto[fim] != '"') {
+            fim++;
+        }
+        if (texto[fim] != '"') {
+            erro_consulta(analisador, "Aspas não fechadas");
+            token->tipo = TOKEN_FIM;
+            return;
+        }
+    } else {
+        while (!separador_consulta(texto[fim])) {
+            fim++;
+        }
+    }
+
+    if (fim - inicio >= MAX_TITULO) {
+        erro_consulta(analisador, "Valor muito longo");
+        token->tipo = TOKEN_FIM;
+        return;
+    }
+
+    memcpy(token->texto, texto + inicio, fim - inicio);
+    token->texto[fim - inicio] = '\0';
+    token->tipo = entre_aspas ? TOKEN_TEXTO : TOKEN_PALAVRA;
+    analisador->posicao = fim + (entre_aspas ? 1 : 0);
+}
+
+/**
+ * Indica se o token atual é uma palavra-chave (sem acentos e sem caixa)
+ */
+static bool e_palavra_chave(const TokenConsulta* token, const char* chave) {
+    if (token->tipo != TOKEN_PALAVRA) {
+        return false;
+    }
+
+    char normalizado[MAX_TITULO];
+    normalizar_texto(normalizado, token->texto);
+    return strcmp(normalizado, chave) == 0;
+}
+
+// =============================================================================
+// ANALISADOR SINTÁTICO
+// =============================================================================
+
+/**
+ * Cria um nó da árvore (libera os operandos se faltar memória)
+ */
+static NoConsulta* criar_no(AnalisadorConsulta* analisador, int tipo, NoConsulta* esquerda,
+                            NoConsulta* direita) {
+    NoConsulta* no = (NoConsulta*)calloc(1, sizeof(NoConsulta));
+    if (no == NULL) {
+        erro_consulta(analisador, "Falha ao alocar memória para a consulta");
+        liberar_consulta(esquerda);
+        liberar_consulta(direita);
+        return NULL;
+    }
+
+    no->tipo = tipo;
+    no->esquerda = esquerda;
+    no->direita = direita;
+    return no;
+}
+
+/**
+ * Campo correspondente a um nome (-1 se desconhecido)
+ */
+static int campo_por_nome(const char* nome) {
+    if (strcmp(nome, "titulo") == 0) return CAMPO_TITULO;
+    if (strcmp(nome, "autor") == 0) return CAMPO_AUTOR;
+    if (strcmp(nome, "ano") == 0) return CAMPO_ANO;
+    if (strcmp(nome, "isbn") == 0) return CAMPO_ISBN;
+    if (strcmp(nome, "status") == 0) return CAMPO_STATUS;
+    if (strcmp(nome, "leitor") == 0) return CAMPO_LEITOR;
+    return -1;
+}
+
+/**
+ * Valor de status de uma palavra (1 = disponível, 0 = indisponível, -1 = desconhecida)
+ */
+static int status_por_nome(const char* valor) {
+    char normalizado[MAX_TITULO];
+    normalizar_texto(normalizado, valor);
+
+    if (strcmp(normalizado, "disponivel") == 0) return 1;
+    if (strcmp(normalizado, "indisponivel") == 0 || strcmp(normalizado, "emprestado") == 0) return 0;
+    return -1;
+}
+
+/**
+ * Converte o valor de uma comparação de acordo com o campo e o operador
+ * Retorna: true se o operador vale para o campo e o valor é válido
+ */
+static bool preparar_valor(AnalisadorConsulta* analisador, NoConsulta* no, const char* valor) {
+    int op = no->operador;
+    bool texto_livre = (op == OP_IGUAL || op == OP_DIFERENTE || op == OP_CONTEM || op == OP_COMECA);
+
+    switch (no->campo) {
+        case CAMPO_TITULO:
+        case CAMPO_AUTOR:
+            if (op == OP_PALAVRA) {
+                // A palavra é comparada com os termos do índice invertido
+                char normalizado[MAX_TITULO];
+                normalizar_texto(normalizado, valor);
+                int tamanho = 0;
+                while (normalizado[tamanho] != '\0') {
+                    unsigned char c = (unsigned char)normalizado[tamanho];
+                    if (!isalnum(c) && c < 0x80) {
+                        erro_consulta(analisador, "Use ':' com uma única palavra");
+                        return false;
+                    }
+                    tamanho++;
+                }
+                if (tamanho == 0) {
+                    erro_consulta(analisador, "Palavra vazia");
+                    return false;
+                }
+                normalizado[tamanho < MAX_TERMO - 1 ? tamanho : MAX_TERMO - 1] = '\0';
+                strcpy(no->texto, normalizado);
+                return true;
+            }
+            if (!texto_livre) break;
+            para_minusculo(no->texto, valor);
+            return true;
+
+        case CAMPO_LEITOR:
+            if (!texto_livre) break;
+            para_minusculo(no->texto, valor);
+            return true;
+
+        case CAMPO_ANO: {
+            if (op == OP_CONTEM || op == OP_COMECA || op == OP_PALAVRA) break;
+            char* fim;
+            long ano = strtol(valor, &fim, 10);
+            if (*valor == '\0' || *fim != '\0' || ano < INT_MIN || ano > INT_MAX) {
+                erro_consulta(analisador, "Ano inválido");
+                return false;
+            }
+            no->numero = (int)ano;
+            return true;
+        }
+
+        case CAMPO_ISBN:
+            if (op != OP_IGUAL && op != OP_DIFERENTE) break;
+            no->isbn_chave = normalizar_isbn(valor);
+            if (no->isbn_chave == 0) {
+                erro_consulta(analisador, "ISBN inválido");
+                return false;
+            }
+            return true;
+
+        case CAMPO_STATUS:
+            if (op != OP_IGUAL && op != OP_DIFERENTE) break;
+            no->numero = status_por_nome(valor);
+            if (no->numero < 0) {
+                erro_consulta(analisador, "Status deve ser disponivel ou emprestado");
+                return false;
+            }
+            return true;
+    }
+
+    erro_consulta(analisador, "Operador não se aplica a este campo");
+    return false;
+}
+
+static NoConsulta* analisar_expressao(AnalisadorConsulta* analisador);
+
+/**
+ * fator = "nao" fator | "(" expressao ")" | campo operador valor | disponivel | emprestado
+ */
+static NoConsulta* analisar_fator(AnalisadorConsulta* analisador) {
+    TokenConsulta* token = &analisador->atual;
+
+    if (e_palavra_chave(token, "nao")) {
+        avancar(analisador);
+        NoConsulta* operando = analisar_fator(analisador);
+        if (operando == NULL) {
+            return NULL;
+        }
+        return criar_no(analisador, NO_NAO, operando, NULL);
+    }
+
+    if (token->tipo == TOKEN_ABRE) {
+        avancar(analisador);
+        NoConsulta* interna = analisar_expressao(analisador);
+        if (interna == NULL) {
+            return NULL;
+        }
+        if (token->tipo != TOKEN_FECHA) {
+            erro_consulta(analisador, "Esperado ')'");
+            liberar_consulta(interna);
+            return NULL;
+        }
+        avancar(analisador);
+        return interna;
+    }
+
+    if (token->tipo != TOKEN_PALAVRA) {
+        erro_consulta(analisador, "Esperado um campo, 'nao' ou '('");
+        return NULL;
+    }
+
+    // Atalhos: "disponivel" e "emprestado" equivalem a status = ...
+    int status = status_por_nome(token->texto);
+    if (status >= 0) {
+        NoConsulta* no = criar_no(analisador, NO_COMPARACAO, NULL, NULL);
+        if (no == NULL) {
+            return NULL;
+        }
+        no->campo = CAMPO_STATUS;
+        no->operador = OP_IGUAL;
+        no->numero = status;
+        avancar(analisador);
+        return no;
+    }
+
+    char nome[MAX_TITULO];
+    normalizar_texto(nome, token->texto);
+    int campo = campo_por_nome(nome);
+    if (campo < 0) {
+        erro_consulta(analisador, "Campo desconhecido (use titulo, autor, ano, isbn, status ou leitor)");
+        return NULL;
+    }
+
+    avancar(analisador);
+    if (token->tipo != TOKEN_OPERADOR) {
+        erro_consulta(analisador, "Esperado um operador (=, !=, <, <=, >, >=, ~, ^ ou :)");
+        return NULL;
+    }
+    int operador = token->operador;
+
+    avancar(analisador);
+    if (token->tipo != TOKEN_PALAVRA && token->tipo != TOKEN_TEXTO) {
+        erro_consulta(analisador, "Esperado um valor");
+        return NULL;
+    }
+
+    NoConsulta* no = criar_no(analisador, NO_COMPARACAO, NULL, NULL);
+    if (no == NULL) {
+        return NULL;
+    }
+    no->campo = campo;
+    no->operador = operador;
+    if (!preparar_valor(analisador, no, token->texto)) {
+        liberar_consulta(no);
+        return NULL;
+    }
+
+    avancar(analisador);
+    return no;
+}
+
+/**
+ * termo = fator {"e" fator}
+ */
+static NoConsulta* analisar_termo(AnalisadorConsulta* analisador) {
+    NoConsulta* esquerda = analisar_fator(analisador);
+
+    while (esquerda != NULL && e_palavra_chave(&analisador->atual, "e")) {
+        avancar(analisador);
+        NoConsulta* direita = analisar_fator(analisador);
+        if (direita == NULL) {
+            liberar_consulta(esquerda);
+            return NULL;
+        }
+        esquerda = criar_no(analisador, NO_E, esquerda, direita);
+    }
+
+    return esquerda;
+}
+
+/**
+ * expressao = termo {"ou" termo}
+ */
+static NoConsulta* analisar_expressao(AnalisadorConsulta* analisador) {
+    NoConsulta* esquerda = analisar_termo(analisador);
+
+    while (esquerda != NULL && e_palavra_chave(&analisador->atual, "ou")) {
+        avancar(analisador);
+        NoConsulta* direita = analisar_termo(analisador);
+        if (direita == NULL) {
+            liberar_consulta(esquerda);
+            return NULL;
+        }
+        esquerda = criar_no(analisador, NO_OU, esquerda, direita);
+    }
+
+    return esquerda;
+}
+
+/**
+ * Compila o texto de uma consulta
+ */
+NoConsulta* compilar_consulta(const char* texto) {
+    if (texto == NULL) {
+        return NULL;
+    }
+
+    AnalisadorConsulta analisador;
+    analisador.texto = texto;
+    analisador.posicao = 0;
+    analisador.erro = false;
+    avancar(&analisador);
+
+    if (analisador.atual.tipo == TOKEN_FIM) {
+        erro_consulta(&analisador, "Consulta vazia");
+        return NULL;
+    }
+
+    NoConsulta* consulta = analisar_expressao(&analisador);
+    if (consulta != NULL && analisador.atual.tipo != TOKEN_FIM) {
+        erro_consulta(&analisador, "Esperado 'e', 'ou' ou o fim da consulta");
+        liberar_consulta(consulta);
+        return NULL;
+    }
+
+    return consulta;
+}
+
+// =============================================================================
+// AVALIAÇÃO
+// =============================================================================
+
+/**
+ * Indica se um texto contém uma palavra (já normalizada) como termo inteiro
+ * Os termos são separados como no índice invertido (letras, dígitos e UTF-8).
+ */
+static bool contem_palavra(const char* original, const char* palavra) {
+    char normalizado[MAX_TITULO];
+    normalizar_texto(normalizado, original);
+
+    int i = 0;
+    while (normalizado[i] != '\0') {
+        while (normalizado[i] != '\0' && !isalnum((unsigned char)normalizado[i]) &&
+               (unsigned char)normalizado[i] < 0x80) {
+            i++;
+        }
+
+        int inicio = i;
+        while (normalizado[i] != '\0' && (isalnum((unsigned char)normalizado[i]) ||
+                                          (unsigned char)normalizado[i] >= 0x80)) {
+            i++;
+        }
+
+        // O termo é comparado truncado, como é guardado no índice
+        int tamanho = i - inicio;
+        if (tamanho > MAX_TERMO - 1) {
+            tamanho = MAX_TERMO - 1;
+        }
+        if (tamanho > 0 && (int)strlen(palavra) == tamanho &&
+            strncmp(normalizado + inicio, palavra, tamanho) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Compara um texto em minúsculas com o valor de uma condição
+ */
+static bool comparar_texto(int operador, const char* campo, const char* valor) {
+    switch (operador) {
+        case OP_IGUAL: return strcmp(campo, valor) == 0;
+        case OP_DIFERENTE: return strcmp(campo, valor) != 0;
+        case OP_CONTEM: return strstr(campo, valor) != NULL;
+        case OP_COMECA: return strncmp(campo, valor, strlen(valor)) == 0;
+        default: return false;
+    }
+}
+
+/**
+ * Compara um texto em qualquer caixa com o valor de uma condição
+ * Igualdade e trecho usam as funções de textos.h direto no campo; só o prefixo
+ * ainda precisa da cópia em minúsculas.
+ */
+static bool comparar_sem_caixa(int operador, const char* campo, const char* valor) {
+    char minusculo[MAX_TITULO];
+
+    switch (operador) {
+        case OP_IGUAL: return iguais_sem_caixa(campo, valor);
+        case OP_DIFERENTE: return !iguais_sem_caixa(campo, valor);
+        case OP_CONTEM: return procurar_sem_caixa(campo, valor) != NULL;
+        default:
+            para_minusculo(minusculo, campo);
+            return comparar_texto(operador, minusculo, valor);
+    }
+}
+
+/**
+ * Avalia uma comparação em um livro
+ */
+static bool avaliar_comparacao(const NoConsulta* no, const NoLivro* livro) {
+    switch (no->campo) {
+        case CAMPO_TITULO:
+            if (no->operador == OP_PALAVRA) {
+                return contem_palavra(livro->dados.titulo, no->texto);
+            }
+            return comparar_texto(no->operador, livro->titulo_busca, no->texto);
+
+        case CAMPO_AUTOR:
+            if (no->operador == OP_PALAVRA) {
+                return contem_palavra(livro->dados.autor, no->texto);
+            }
+            return comparar_sem_caixa(no->operador, livro->dados.autor, no->texto);
+
+        case CAMPO_ANO: {
+            int ano = livro->dados.ano_publicacao;
+            switch (no->operador) {
+                case OP_IGUAL: return ano == no->numero;
+                case OP_DIFERENTE: return ano != no->numero;
+                case OP_MENOR: return ano < no->numero;
+                case OP_MENOR_IGUAL: return ano <= no->numero;
+                case OP_MAIOR: return ano > no->numero;
+                case OP_MAIOR_IGUAL: return ano >= no->numero;
+                default: return false;
+            }
+        }
+
+        case CAMPO_ISBN:
+            return (livro->isbn_chave == no->isbn_chave) == (no->operador == OP_IGUAL);
+
+        case CAMPO_STATUS:
+            return (livro->dados.status == (no->numero == 1)) == (no->operador == OP_IGUAL);
+
+        case CAMPO_LEITOR: {
+            // "!=" vale quando nenhum leitor atual é igual ao valor
+            int operador = (no->operador == OP_DIFERENTE) ? OP_IGUAL : no->operador;
+            bool algum = false;
+
+            for (int i = 0; i < livro->dados.quantidade && !algum; i++) {
+                const Exemplar* exemplar = &livro->exemplares[i];
+                if (exemplar->status) continue;
+
+                algum = comparar_sem_caixa(operador, exemplar->nome_leitor_atual, no->texto);
+            }
+            return (no->operador == OP_DIFERENTE) ? !algum : algum;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Avalia uma consulta tratando uma condição (já garantida pelo índice) como verdadeira
+ */
+static bool avaliar_ignorando(const NoConsulta* no, const NoLivro* livro, const NoConsulta* ignorar) {
+    if (no == ignorar) {
+        return true;
+    }
+
+    switch (no->tipo) {
+        case NO_E:
+            return avaliar_ignorando(no->esquerda, livro, ignorar) &&
+                   avaliar_ignorando(no->direita, livro, ignorar);
+        case NO_OU:
+            return avaliar_ignorando(no->esquerda, livro, ignorar) ||
+                   avaliar_ignorando(no->direita, livro, ignorar);
+        case NO_NAO:
+            return !avaliar_ignorando(no->esquerda, livro, ignorar);
+        default:
+            return avaliar_comparacao(no, livro);
+    }
+}
+
+/**
+ * Avalia uma consulta em um livro
+ */
+bool avaliar_consulta(const NoConsulta* consulta, const NoLivro* livro) {
+    if (consulta == NULL || livro == NULL) {
+        return false;
+    }
+    return avaliar_ignorando(consulta, livro, NULL);
+}
+
+// =============================================================================
+// PLANEJADOR
+// =============================================================================
+
+/**
+ * Junta as comparações ligadas por "e" no nível mais alto da consulta
+ */
+static void coletar_condicoes(const NoConsulta* no, const NoConsulta** condicoes, int* total) {
+    if (no->tipo == NO_E) {
+        coletar_condicoes(no->esquerda, condicoes, total);
+        coletar_condicoes(no->direita, condicoes, total);
+    } else if (no->tipo == NO_COMPARACAO && *total < MAX_CONDICOES_PLANO) {
+        condicoes[(*total)++] = no;
+    }
+}
+
+/**
+ * Quantidade de livros antes de um texto em uma visão (título ou autor)
+ */
+static int posicao_texto(VisoesOrdenadas* visoes, int ordem, const char* texto) {
+    CursorVisao cursor;
+    visao_cursor_buscar(&cursor, ordem, texto, 0);
+    return visao_posicao_cursor(visoes, &cursor);
+}
+
+/**
+ * Quantidade de livros publicados antes de um ano
+ */
+static int posicao_ano(VisoesOrdenadas* visoes, long long ano, int total) {
+    if (ano > INT_MAX) {
+        return total;
+    }
+    if (ano < INT_MIN) {
+        return 0;
+    }
+
+    CursorVisao cursor;
+    visao_cursor_buscar(&cursor, ORDEM_ANO, "", (int)ano);
+    return visao_posicao_cursor(visoes, &cursor);
+}
+
+/**
+ * Estima a faixa de uma visão que contém os livros de uma comparação
+ * Retorna: true se a comparação tem uma faixa (caso contrário, não usa a visão)
+ */
+static bool estimar_faixa(ListaLivros* lista, const NoConsulta* no, PlanoConsulta* plano) {
+    VisoesOrdenadas* visoes = lista->visoes;
+    int total = lista->total;
+
+    if (no->campo == CAMPO_ANO) {
+        long long ano = no->numero;
+        plano->acesso = ACESSO_ANO;
+        plano->exato = true;
+
+        switch (no->operador) {
+            case OP_IGUAL:
+                plano->inicio = posicao_ano(visoes, ano, total);
+                plano->fim = posicao_ano(visoes, ano + 1, total);
+                return true;
+            case OP_MENOR:
+                plano->inicio = 0;
+                plano->fim = posicao_ano(visoes, ano, total);
+                return true;
+            case OP_MENOR_IGUAL:
+                plano->inicio = 0;
+                plano->fim = posicao_ano(visoes, ano + 1, total);
+                return true;
+            case OP_MAIOR:
+                plano->inicio = posicao_ano(visoes, ano + 1, total);
+                plano->fim = total;
+                return true;
+            case OP_MAIOR_IGUAL:
+                plano->inicio = posicao_ano(visoes, ano, total);
+                plano->fim = total;
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    if ((no->campo != CAMPO_TITULO && no->campo != CAMPO_AUTOR) ||
+        (no->operador != OP_IGUAL && no->operador != OP_COMECA)) {
+        return false;
+    }
+
+    int ordem = (no->campo == CAMPO_TITULO) ? ORDEM_TITULO : ORDEM_AUTOR;
+    plano->acesso = (no->campo == CAMPO_TITULO) ? ACESSO_TITULO : ACESSO_AUTOR;
+    plano->inicio = posicao_texto(visoes, ordem, no->texto);
+    plano->fim = total;
+
+    // Limite superior: o valor seguido de \x01 (igualdade) ou com o último byte
+    // incrementado (prefixo). A faixa pode sobrar nas bordas, então a condição
+    // é conferida nos candidatos.
+    char limite[MAX_TITULO];
+    int tamanho = (int)strlen(no->texto);
+    strcpy(limite, no->texto);
+
+    if (no->operador == OP_IGUAL) {
+        if (tamanho < MAX_TITULO - 1) {
+            limite[tamanho] = '\x01';
+            limite[tamanho + 1] = '\0';
+            plano->fim = posicao_texto(visoes, ordem, limite);
+        }
+    } else {
+        while (tamanho > 0 && (unsigned char)limite[tamanho - 1] == 0xFF) {
+            tamanho--;
+        }
+        if (tamanho > 0) {
+            limite[tamanho - 1] = (char)((unsigned char)limite[tamanho - 1] + 1);
+            limite[tamanho] = '\0';
+            plano->fim = posicao_texto(visoes, ordem, limite);
+        }
+    }
+
+    plano->exato = false;
+    return true;
+}
+
+/**
+ * Estima quantos candidatos o índice de uma comparação devolveria
+ * Retorna: true se algum índice atende a comparação
+ */
+static bool estimar_condicao(Biblioteca* bib, const NoConsulta* no, PlanoConsulta* plano) {
+    ListaLivros* lista = bib->catalogo;
+
+    plano->condicao = no;
+    plano->inicio = 0;
+    plano->fim = 0;
+
+    if (no->campo == CAMPO_ISBN && no->operador == OP_IGUAL) {
+        plano->acesso = ACESSO_ISBN;
+        plano->estimativa = indice_isbn_buscar(lista->indice_isbn, no->isbn_chave) != NULL ? 1 : 0;
+        plano->exato = true;
+        return true;
+    }
+
+    if (no->campo == CAMPO_LEITOR && no->operador == OP_IGUAL) {
+        Leitor* leitor = buscar_leitor(bib->leitores, no->texto);
+        plano->acesso = ACESSO_LEITOR;
+        plano->estimativa = (leitor != NULL) ? leitor->total_emprestimos : 0;
+        plano->exato = true;
+        return true;
+    }
+
+    if (no->operador == OP_PALAVRA) {
+        TermoIndexado* termo = indice_textual_buscar(lista->indice_textual, no->texto);
+        plano->acesso = ACESSO_PALAVRA;
+        plano->estimativa = (termo != NULL) ? termo->total : 0;
+        plano->exato = false; // O índice mistura título e autor
+        return true;
+    }
+
+    if (estimar_faixa(lista, no, plano)) {
+        plano->estimativa = (plano->fim > plano->inicio) ? plano->fim - plano->inicio : 0;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Escolhe o caminho de acesso mais seletivo para uma consulta
+ */
+void planejar_consulta(Biblioteca* bib, const NoConsulta* consulta, PlanoConsulta* plano) {
+    if (plano == NULL) return;
+
+    plano->acesso = ACESSO_VARREDURA;
+    plano->condicao = NULL;
+    plano->estimativa = (bib != NULL) ? bib->catalogo->total : 0;
+    plano->exato = false;
+    plano->inicio = 0;
+    plano->fim = 0;
+
+    if (bib == NULL || consulta == NULL) return;
+
+    const NoConsulta* condicoes[MAX_CONDICOES_PLANO];
+    int total = 0;
+    coletar_condicoes(consulta, condicoes, &total);
+
+    for (int i = 0; i < total; i++) {
+        PlanoConsulta candidato;
+        if (!estimar_condicao(bib, condicoes[i], &candidato)) {
+            continue;
+        }
+
+        // Menos candidatos vence; no empate, o índice que dispensa a conferência
+        if (plano->condicao == NULL || candidato.estimativa < plano->estimativa ||
+            (candidato.estimativa == plano->estimativa && candidato.exato && !plano->exato)) {
+            *plano = candidato;
+        }
+    }
+
+    // Um índice que devolve mais da metade do catálogo perde para a varredura paralela
+    if (plano->condicao != NULL && plano->estimativa > bib->catalogo->total / 2 &&
+        plano->estimativa > LIVROS_POR_TRECHO) {
+        plano->acesso = ACESSO_VARREDURA;
+        plano->condicao = NULL;
+        plano->estimativa = bib->catalogo->total;
+        plano->exato = false;
+    }
+}
+
+// =============================================================================
+// EXECUÇÃO
+// =============================================================================
+
+/**
+ * Condição da varredura: a consulta inteira
+ */
+static bool predicado_consulta(const NoLivro* livro, const void* contexto) {
+    return avaliar_ignorando((const NoConsulta*)contexto, livro, NULL);
+}
+
+/**
+ * Compara dois livros pelo título em minúsculas (para qsort)
+ */
+static int comparar_por_titulo(const void* a, const void* b) {
+    const NoLivro* x = *(NoLivro* const*)a;
+    const NoLivro* y = *(NoLivro* const*)b;
+    return strcmp(x->titulo_busca, y->titulo_busca);
+}
+
+/**
+ * Copia os candidatos do índice escolhido
+ * Retorna: Quantidade de candidatos
+ */
+static int buscar_candidatos(Biblioteca* bib, const PlanoConsulta* plano, NoLivro** candidatos) {
+    ListaLivros* lista = bib->catalogo;
+    const NoConsulta* no = plano->condicao;
+    int total = 0;
+
+    switch (plano->acesso) {
+        case ACESSO_ISBN: {
+            NoLivro* livro = indice_isbn_buscar(lista->indice_isbn, no->isbn_chave);
+            if (livro != NULL && plano->estimativa > 0) {
+                candidatos[total++] = livro;
+            }
+            break;
+        }
+
+        case ACESSO_LEITOR: {
+            Leitor* leitor = buscar_leitor(bib->leitores, no->texto);
+            Exemplar* exemplar = (leitor != NULL) ? leitor->emprestimos : NULL;
+
+            // Dois exemplares do mesmo título com o leitor geram um só candidato
+            while (exemplar != NULL && total < plano->estimativa) {
+                bool repetido = false;
+                for (int i = 0; i < total && !repetido; i++) {
+                    repetido = (candidatos[i] == exemplar->livro);
+                }
+                if (!repetido) {
+                    candidatos[total++] = exemplar->livro;
+                }
+                exemplar = exemplar->proximo_do_leitor;
+            }
+            break;
+        }
+
+        case ACESSO_TITULO:
+        case ACESSO_AUTOR:
+        case ACESSO_ANO: {
+            int ordem = (plano->acesso == ACESSO_TITULO) ? ORDEM_TITULO
+                      : (plano->acesso == ACESSO_AUTOR) ? ORDEM_AUTOR : ORDEM_ANO;
+            total = visao_pagina(lista->visoes, ordem, plano->inicio, candidatos, plano->estimativa);
+            break;
+        }
+
+        case ACESSO_PALAVRA: {
+            TermoIndexado* termo = indice_textual_buscar(lista->indice_textual, no->texto);
+            for (int i = 0; termo != NULL && i < termo->total && total < plano->estimativa; i++) {
+                candidatos[total++] = termo->ocorrencias[i].livro;
+            }
+            break;
+        }
+    }
+
+    return total;
+}
+
+/**
+ * Executa um plano e devolve os livros em ordem alfabética de título
+ */
+bool executar_consulta(Biblioteca* bib, const NoConsulta* consulta, const PlanoConsulta* plano,
+                       ResultadoVarredura* resultado) {
+    if (resultado == NULL) {
+        return false;
+    }
+    resultado->livros = NULL;
+    resultado->total = 0;
+
+    if (bib == NULL || consulta == NULL || plano == NULL) {
+        return false;
+    }
+
+    // Sem índice: a consulta inteira é avaliada na varredura paralela
+    if (plano->acesso == ACESSO_VARREDURA || plano->condicao == NULL) {
+        return varrer_catalogo(bib->catalogo, predicado_consulta, consulta, 0, resultado);
+    }
+
+    if (plano->estimativa == 0) {
+        return true;
+    }
+
+    NoLivro** candidatos = (NoLivro**)malloc(plano->estimativa * sizeof(NoLivro*));
+    if (candidatos == NULL) {
+        return false;
+    }
+
+    int total = buscar_candidatos(bib, plano, candidatos);
+
+    // As demais condições só são avaliadas nos candidatos
+    const NoConsulta* ignorar = plano->exato ? plano->condicao : NULL;
+    int encontrados = 0;
+    for (int i = 0; i < total; i++) {
+        if (avaliar_ignorando(consulta, candidatos[i], ignorar)) {
+            candidatos[encontrados++] = candidatos[i];
+        }
+    }
+
+    if (encontrados == 0) {
+        free(candidatos);
+        return true;
+    }
+
+    // A visão por título já entrega em ordem; os outros caminhos são ordenados
+    if (plano->acesso != ACESSO_TITULO) {
+        qsort(candidatos, encontrados, sizeof(NoLivro*), comparar_por_titulo);
+    }
+
+    resultado->livros = candidatos;
+    resultado->total = encontrados;
+    return true;
+}
+
+/**
+ * Descreve um plano em uma linha
+ */
+void descrever_plano(const PlanoConsulta* plano, char* buffer, size_t tamanho) {
+    if (plano == NULL || buffer == NULL || tamanho == 0) return;
+
+    switch (plano->acesso) {
+        case ACESSO_ISBN:
+            snprintf(buffer, tamanho, "tabela hash de ISBNs, %d candidato(s)", plano->estimativa);
+            break;
+        case ACESSO_LEITOR:
+            snprintf(buffer, tamanho, "empréstimos do leitor (tabela hash), %d candidato(s)",
+                     plano->estimativa);
+            break;
+        case ACESSO_TITULO:
+        case ACESSO_AUTOR:
+        case ACESSO_ANO:
+            snprintf(buffer, tamanho, "faixa da visão por %s [%d, %d), %d candidato(s)",
+                     plano->acesso == ACESSO_TITULO ? "título"
+                     : plano->acesso == ACESSO_AUTOR ? "autor" : "ano",
+                     plano->inicio, plano->fim, plano->estimativa);
+            break;
+        case ACESSO_PALAVRA:
+            snprintf(buffer, tamanho, "índice de palavras ('%s'), %d candidato(s)",
+                     plano->condicao->texto, plano->estimativa);
+            break;
+        default:
+            snprintf(buffer, tamanho, "varredura paralela do catálogo, %d livro(s)", plano->estimativa);
+            break;
+    }
+}
+
+/**
+ * Compila, planeja, executa e exibe uma consulta
+ */
+int exibir_consulta(Biblioteca* bib, const char* texto) {
+    if (bib == NULL || texto == NULL) {
+        return -1;
+    }
+
+    NoConsulta* consulta = compilar_consulta(texto);
+    if (consulta == NULL) {
+        return -1;
+    }
+
+    PlanoConsulta plano;
+    planejar_consulta(bib, consulta, &plano);
+
+    ResultadoVarredura resultado;
+    if (!executar_consulta(bib, consulta, &plano, &resultado)) {
+        printf("Erro: Falha ao alocar memória para a consulta!\n");
+        liberar_consulta(consulta);
+        return -1;
+    }
+
+    char descricao[128];
+    descrever_plano(&plano, descricao, sizeof(descricao));
+
+    printf("\n=== RESULTADO DA CONSULTA ===\n");
+    printf("Plano: %s\n", descricao);
+
+    for (int i = 0; i < resultado.total; i++) {
+        NoLivro* livro = resultado.livros[i];
+        printf("\n[%d] Título: %s\n", i + 1, livro->dados.titulo);
+        printf("    Autor: %s\n", livro->dados.autor);
+        printf("    Ano: %d\n", livro->dados.ano_publicacao);
+        printf("    ISBN: %s\n", strlen(livro->dados.isbn) > 0 ? livro->dados.isbn : "N/A");
+        printf("    Status: %s\n", livro->dados.status ? "Disponível" : "Indisponível");
+    }
+
+    int encontrados = resultado.total;
+    if (encontrados == 0) {
+        printf("Nenhum livro satisfaz a consulta.\n");
+    } else {
+        printf("\nTotal de livros encontrados: %d\n", encontrados);
+    }
+
+    liberar_resultado_varredura(&resultado);
+    liberar_consulta(consulta);
+    return encontrados;
+}
+
+/**
+ * Libera a árvore de uma consulta
+ */
+void liberar_consulta(NoConsulta* consulta) {
+    if (consulta == NULL) return;
+
+    liberar_consulta(consulta->esquerda);
+    liberar_consulta(consulta->direita);
+    free(consulta);
+}
@@ -0,0 +1,164 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: consulta.h
+ * Descrição: Linguagem de filtros sobre o catálogo e escolha do índice de cada consulta
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef CONSULTA_H
+#define CONSULTA_H
+
+#include "biblioteca.h"
+#include "varredura.h"
+
+// =============================================================================
+// CONSTANTES DA LINGUAGEM DE CONSULTA
+// =============================================================================
+
+// Tipos de nó da expressão
+#define NO_E 0                      // esquerda e direita
+#define NO_OU 1                     // esquerda ou direita
+#define NO_NAO 2                    // nao esquerda
+#define NO_COMPARACAO 3             // campo operador valor
+
+// Campos do livro
+#define CAMPO_TITULO 0
+#define CAMPO_AUTOR 1
+#define CAMPO_ANO 2
+#define CAMPO_ISBN 3
+#define CAMPO_STATUS 4
+#define CAMPO_LEITOR 5              // Leitor que está com algum exemplar
+
+// Operadores de comparação
+#define OP_IGUAL 0                  // =
+#define OP_DIFERENTE 1              // !=
+#define OP_MENOR 2                  // <
+#define OP_MENOR_IGUAL 3            // <=
+#define OP_MAIOR 4                  // >
+#define OP_MAIOR_IGUAL 5            // >=
+#define OP_CONTEM 6                 // ~  (contém o trecho)
+#define OP_COMECA 7                 // ^  (começa com)
+#define OP_PALAVRA 8                // :  (contém a palavra, sem acentos)
+
+// Caminhos de acesso escolhidos pelo planejador
+#define ACESSO_VARREDURA 0          // Varredura paralela de todo o catálogo
+#define ACESSO_ISBN 1               // Tabela hash de ISBNs
+#define ACESSO_LEITOR 2             // Tabela hash de leitores (empréstimos do leitor)
+#define ACESSO_TITULO 3             // Faixa da visão por título
+#define ACESSO_AUTOR 4              // Faixa da visão por autor
+#define ACESSO_ANO 5                // Faixa da visão por ano
+#define ACESSO_PALAVRA 6            // Índice invertido de palavras (título e autor)
+
+#define MAX_CONSULTA 512            // Tamanho máximo do texto de uma consulta
+
+// =============================================================================
+// EXPRESSÃO E PLANO
+// =============================================================================
+
+/**
+ * Nó da árvore de uma consulta
+ * Os valores são convertidos uma única vez na compilação (minúsculas, palavra
+ * normalizada, ano ou chave do ISBN), então avaliar um livro não aloca memória.
+ */
+typedef struct NoConsulta {
+    int tipo;                       // NO_E, NO_OU, NO_NAO ou NO_COMPARACAO
+    int campo;                      // CAMPO_* (comparação)
+    int operador;                   // OP_* (comparação)
+    char texto[MAX_TITULO];         // Valor em minúsculas (OP_PALAVRA: normalizado)
+    int numero;                     // Ano, ou 1 = disponível / 0 = indisponível
+    uint64_t isbn_chave;            // ISBN normalizado (CAMPO_ISBN)
+    struct NoConsulta* esquerda;    // Primeiro operando (e, ou, nao)
+    struct NoConsulta* direita;     // Segundo operando (e, ou)
+} NoConsulta;
+
+/**
+ * Plano de execução de uma consulta
+ * Entre as condições ligadas por "e" no nível mais alto, o planejador estima
+ * quantos candidatos cada índice devolveria e escolhe o menor. As demais
+ * condições só são avaliadas nesses candidatos.
+ */
+typedef struct PlanoConsulta {
+    int acesso;                     // ACESSO_*
+    const NoConsulta* condicao;     // Condição atendida pelo índice (NULL = varredura)
+    int estimativa;                 // Candidatos que o índice devolve
+    bool exato;                     // Candidatos já satisfazem a condição (ela não é reavaliada)
+    int inicio;                     // Primeira posição da faixa (ACESSO_TITULO/AUTOR/ANO)
+    int fim;                        // Depois da última posição da faixa
+} PlanoConsulta;
+
+// =============================================================================
+// FUNÇÕES DA LINGUAGEM DE CONSULTA
+// =============================================================================
+
+/**
+ * Compila o texto de uma consulta
+ * Gramática: expressao = termo {"ou" termo}; termo = fator {"e" fator};
+ * fator = "nao" fator | "(" expressao ")" | campo operador valor | disponivel | emprestado.
+ * Campos: titulo, autor, ano, isbn, status, leitor. Valores com espaços vão entre aspas.
+ * Exemplo: disponivel e autor ~ machado e ano < 1900
+ * Parâmetros:
+ *   - texto: Consulta digitada
+ * Retorna: Árvore da consulta, ou NULL se houver erro (a mensagem é exibida)
+ */
+NoConsulta* compilar_consulta(const char* texto);
+
+/**
+ * Avalia uma consulta em um livro (só lê o livro: pode rodar em várias threads)
+ * Parâmetros:
+ *   - consulta: Árvore da consulta
+ *   - livro: Livro avaliado
+ * Retorna: true se o livro satisfaz a consulta
+ */
+bool avaliar_consulta(const NoConsulta* consulta, const NoLivro* livro);
+
+/**
+ * Escolhe o caminho de acesso mais seletivo para uma consulta
+ * Parâmetros:
+ *   - bib: Ponteiro para a biblioteca
+ *   - consulta: Árvore da consulta
+ *   - plano: Recebe o plano escolhido
+ */
+void planejar_consulta(Biblioteca* bib, const NoConsulta* consulta, PlanoConsulta* plano);
+
+/**
+ * Executa um plano e devolve os livros em ordem alfabética de título
+ * Parâmetros:
+ *   - bib: Ponteiro para a biblioteca
+ *   - consulta: Árvore da consulta
+ *   - plano: Plano de planejar_consulta() (o catálogo não pode ter mudado)
+ *   - resultado: Recebe os livros (liberar com liberar_resultado_varredura())
+ * Retorna: true se executada, false se faltou memória
+ */
+bool executar_consulta(Biblioteca* bib, const NoConsulta* consulta, const PlanoConsulta* plano,
+                       ResultadoVarredura* resultado);
+
+/**
+ * Descreve um plano em uma linha (ex.: "faixa da visão por ano, 120 candidatos")
+ * Parâmetros:
+ *   - plano: Plano a descrever
+ *   - buffer: Texto de saída
+ *   - tamanho: Tamanho do buffer
+ */
+void descrever_plano(const PlanoConsulta* plano, char* buffer, size_t tamanho);
+
+/**
+ * Compila, planeja, executa e exibe uma consulta
+ * Parâmetros:
+ *   - bib: Ponteiro para a biblioteca
+ *   - texto: Consulta digitada
+ * Retorna: Número de livros encontrados, ou -1 se a consulta é inválida
+ */
+int exibir_consulta(Biblioteca* bib, const char* texto);
+
+/**
+ * Libera a árvore de uma consulta
+ * Parâmetros:
+ *   - consulta: Árvore a ser liberada
+ */
+void liberar_consulta(NoConsulta* consulta);
+
+#endif // CONSULTA_H
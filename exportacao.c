@@ -0,0 +1,1019 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: exportacao.c
+ * Descrição: Implementação da exportação e da importação em CSV e JSON Lines
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L // pthreads e open() com -std=c99
+
+#include "exportacao.h"
+#include "busca.h"
+#include "historico.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define TOTAL_ARQUIVOS 4        // Catálogo, empréstimos, fila e histórico
+
+/**
+ * Exportação de uma estrutura (executada por uma thread no modo paralelo)
+ */
+typedef struct TarefaExportacao {
+    Biblioteca* bib;                      // Biblioteca exportada
+    int estrutura;                        // 0 catálogo, 1 empréstimos, 2 fila, 3 histórico
+    char caminho[MAX_CAMINHO_EXPORTACAO]; // Arquivo de destino
+    int formato;                          // FORMATO_CSV ou FORMATO_JSON_LINHAS
+    bool sucesso;                         // Arquivo escrito por inteiro
+    pthread_t thread;                     // Thread criada
+    bool iniciada;                        // pthread_create() funcionou
+} TarefaExportacao;
+
+/**
+ * Leitura registro a registro de um arquivo exportado
+ * Só um registro fica em memória por vez, com campos de tamanho fixo.
+ */
+typedef struct LeitorImportacao {
+    FILE* arquivo;                        // Arquivo sendo lido
+    const char* caminho;                  // Caminho (mensagens de erro)
+    int formato;                          // FORMATO_CSV ou FORMATO_JSON_LINHAS
+    int linha;                            // Linha onde começa o registro atual
+    int proxima_linha;                    // Linha onde começa o próximo registro
+    int total_colunas;                    // CSV: colunas do cabeçalho
+    char colunas[MAX_COLUNAS_IMPORTACAO][32]; // CSV: nomes das colunas do cabeçalho
+    int total_campos;                     // Campos do registro atual
+    char chaves[MAX_COLUNAS_IMPORTACAO][32];  // JSON Lines: chaves do registro atual
+    char valores[MAX_COLUNAS_IMPORTACAO][MAX_VALOR_IMPORTACAO]; // Campos do registro atual
+} LeitorImportacao;
+
+// =============================================================================
+// EXPORTAÇÃO
+// =============================================================================
+
+/**
+ * Abre o arquivo de destino e a saída de um relatório sobre ele
+ * Retorna: Saída criada, ou NULL se o arquivo não pôde ser criado
+ */
+static SaidaRelatorio* abrir_exportacao(const char* caminho, int formato, const char* colunas) {
+    if (formato != FORMATO_CSV && formato != FORMATO_JSON_LINHAS) {
+        printf("Erro: Formato de exportação inválido!\n");
+        return NULL;
+    }
+
+    int descritor = open(caminho, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descritor < 0) {
+        printf("Erro: Não foi possível criar '%s' (%s)!\n", caminho, strerror(errno));
+        return NULL;
+    }
+
+    SaidaRelatorio* saida = criar_saida(descritor, formato);
+    if (saida == NULL) {
+        printf("Erro: Falha ao alocar memória para a exportação!\n");
+        close(descritor);
+        return NULL;
+    }
+
+    saida_iniciar_relatorio(saida, "", colunas);
+    return saida;
+}
+
+/**
+ * Termina o arquivo, fecha o descritor e libera a saída
+ * Retorna: true se todas as escritas funcionaram
+ */
+static bool fechar_exportacao(SaidaRelatorio* saida, const char* caminho) {
+    saida_terminar_relatorio(saida);
+    bool sucesso = saida_descarregar(saida);
+    int descritor = saida->descritor;
+    liberar_saida(saida);
+
+    if (close(descritor) != 0) {
+        sucesso = false;
+    }
+    if (!sucesso) {
+        printf("Erro: Falha ao gravar '%s'!\n", caminho);
+    }
+    return sucesso;
+}
+
+/**
+ * Exporta o catálogo (um registro por título)
+ */
+bool exportar_catalogo(ListaLivros* lista, const char* caminho, int formato) {
+    if (lista == NULL) return false;
+
+    SaidaRelatorio* saida = abrir_exportacao(caminho, formato, COLUNAS_CATALOGO);
+    if (saida == NULL) return false;
+
+    for (NoLivro* atual = lista->cabeca; atual != NULL; atual = atual->proximo) {
+        saida_iniciar_registro(saida);
+        saida_campo_texto(saida, "Título", "titulo", atual->dados.titulo);
+        saida_campo_texto(saida, "Autor", "autor", atual->dados.autor);
+        saida_campo_inteiro(saida, "Ano", "ano", atual->dados.ano_publicacao);
+        saida_campo_texto(saida, "ISBN", "isbn", atual->dados.isbn);
+        saida_campo_inteiro(saida, "Exemplares", "exemplares", atual->dados.quantidade);
+        saida_terminar_registro(saida);
+    }
+
+    return fechar_exportacao(saida, caminho);
+}
+
+/**
+ * Exporta os exemplares emprestados e os separados para a fila (um registro por exemplar)
+ */
+bool exportar_emprestimos(ListaLivros* lista, const char* caminho, int formato) {
+    if (lista == NULL) return false;
+
+    SaidaRelatorio* saida = abrir_exportacao(caminho, formato, COLUNAS_EMPRESTIMOS);
+    if (saida == NULL) return false;
+
+    for (NoLivro* atual = lista->cabeca; atual != NULL; atual = atual->proximo) {
+        for (int i = 0; i < atual->dados.quantidade; i++) {
+            Exemplar* exemplar = &atual->exemplares[i];
+            if (exemplar->status && strlen(exemplar->nome_reserva) == 0) continue; // Livre
+
+            // Um exemplar separado não tem leitor nem datas de empréstimo, e vice-versa
+            saida_iniciar_registro(saida);
+            saida_campo_texto(saida, "Título", "titulo", atual->dados.titulo);
+            saida_campo_inteiro(saida, "Exemplar", "exemplar", exemplar->numero);
+            saida_campo_texto(saida, "Leitor", "leitor", exemplar->nome_leitor_atual);
+            saida_campo_inteiro(saida, "Data do empréstimo", "data_emprestimo",
+                                (long long)exemplar->data_emprestimo);
+            saida_campo_inteiro(saida, "Devolver até", "devolver_ate",
+                                exemplar->status ? 0 : (long long)exemplar->data_devolucao_prevista);
+            saida_campo_texto(saida, "Separado para", "reserva", exemplar->nome_reserva);
+            saida_campo_inteiro(saida, "Fim da reserva", "fim_reserva",
+                                exemplar->status ? (long long)exemplar->fim_reserva : 0);
+            saida_terminar_registro(saida);
+        }
+    }
+
+    return fechar_exportacao(saida, caminho);
+}
+
+/**
+ * Exporta a fila de espera em ordem de chegada
+ */
+bool exportar_filas(FilaEspera* fila, const char* caminho, int formato) {
+    if (fila == NULL) return false;
+
+    SaidaRelatorio* saida = abrir_exportacao(caminho, formato, COLUNAS_FILAS);
+    if (saida == NULL) return false;
+
+    for (NoFila* atual = fila->frente; atual != NULL; atual = atual->proximo) {
+        saida_iniciar_registro(saida);
+        saida_campo_texto(saida, "Título", "titulo", atual->dados.titulo_livro);
+        saida_campo_texto(saida, "Leitor", "leitor", atual->dados.nome_leitor);
+        saida_campo_inteiro(saida, "Prioridade", "prioridade", atual->dados.prioridade);
+        saida_campo_inteiro(saida, "Data da solicitação", "data_solicitacao",
+                            (long long)atual->dados.data_solicitacao);
+        saida_terminar_registro(saida);
+    }
+
+    return fechar_exportacao(saida, caminho);
+}
+
+/**
+ * Exporta o histórico, da operação mais antiga para a mais recente
+ */
+bool exportar_historico(PilhaHistorico* pilha, const char* caminho, int formato) {
+    if (pilha == NULL) return false;
+
+    SaidaRelatorio* saida = abrir_exportacao(caminho, formato, COLUNAS_HISTORICO);
+    if (saida == NULL) return false;
+
+    Operacao operacao;
+    for (int i = 0; i < pilha->total; i++) {
+        if (!historico_obter(pilha, i, &operacao)) {
+            saida->erro = true;
+            break;
+        }
+
+        saida_iniciar_registro(saida);
+        saida_campo_texto(saida, "Operação", "operacao", operacao.tipo_operacao);
+        saida_campo_texto(saida, "Livro", "livro", operacao.titulo_livro);
+        saida_campo_texto(saida, "Leitor", "leitor", operacao.nome_leitor);
+        saida_campo_inteiro(saida, "Data", "data", (long long)operacao.data_operacao);
+        saida_terminar_registro(saida);
+    }
+
+    return fechar_exportacao(saida, caminho);
+}
+
+/**
+ * Monta o caminho <prefixo>_<estrutura>.<extensão>
+ * Retorna: true se o caminho coube no buffer
+ */
+static bool montar_caminho(char* destino, const char* prefixo, const char* estrutura, int formato) {
+    int tamanho = snprintf(destino, MAX_CAMINHO_EXPORTACAO, "%s_%s.%s", prefixo, estrutura,
+                           formato == FORMATO_CSV ? "csv" : "jsonl");
+    if (tamanho < 0 || tamanho >= MAX_CAMINHO_EXPORTACAO) {
+        printf("Erro: Caminho muito longo!\n");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Exporta a estrutura de uma tarefa (corpo das threads)
+ */
+static void* executar_exportacao(void* argumento) {
+    TarefaExportacao* tarefa = (TarefaExportacao*)argumento;
+    Biblioteca* bib = tarefa->bib;
+
+    switch (tarefa->estrutura) {
+        case 0:
+            tarefa->sucesso = exportar_catalogo(bib->catalogo, tarefa->caminho, tarefa->formato);
+            break;
+        case 1:
+            tarefa->sucesso = exportar_emprestimos(bib->catalogo, tarefa->caminho, tarefa->formato);
+            break;
+        case 2:
+            tarefa->sucesso = exportar_filas(bib->fila_espera, tarefa->caminho, tarefa->formato);
+            break;
+        default:
+            tarefa->sucesso = exportar_historico(bib->historico, tarefa->caminho, tarefa->formato);
+            break;
+    }
+    return NULL;
+}
+
+/**
+ * Exporta as quatro estruturas para <prefixo>_<estrutura>.csv ou .jsonl
+ */
+bool exportar_biblioteca(Biblioteca* bib, const char* prefixo, int formato, bool paralelo) {
+    static const char* nomes[TOTAL_ARQUIVOS] = {"catalogo", "emprestimos", "filas", "historico"};
+
+    if (bib == NULL || prefixo == NULL) return false;
+
+    TarefaExportacao tarefas[TOTAL_ARQUIVOS];
+    for (int i = 0; i < TOTAL_ARQUIVOS; i++) {
+        tarefas[i].bib = bib;
+        tarefas[i].estrutura = i;
+        tarefas[i].formato = formato;
+        tarefas[i].sucesso = false;
+        tarefas[i].iniciada = false;
+        if (!montar_caminho(tarefas[i].caminho, prefixo, nomes[i], formato)) {
+            return false;
+        }
+    }
+
+    // Cada estrutura é lida por uma única thread; se uma thread não puder ser
+    // criada, a exportação daquela estrutura é feita aqui mesmo
+    if (paralelo) {
+        for (int i = 0; i < TOTAL_ARQUIVOS; i++) {
+            tarefas[i].iniciada =
+                pthread_create(&tarefas[i].thread, NULL, executar_exportacao, &tarefas[i]) == 0;
+        }
+    }
+
+    bool sucesso = true;
+    for (int i = 0; i < TOTAL_ARQUIVOS; i++) {
+        if (tarefas[i].iniciada) {
+            pthread_join(tarefas[i].thread, NULL);
+        } else {
+            executar_exportacao(&tarefas[i]);
+        }
+        sucesso = sucesso && tarefas[i].sucesso;
+    }
+    return sucesso;
+}
+
+// =============================================================================
+// LEITURA DOS ARQUIVOS
+// =============================================================================
+
+/**
+ * Mostra um erro de formato com o arquivo e a linha do registro
+ */
+static void erro_leitura(LeitorImportacao* leitor, const char* mensagem) {
+    printf("Erro: %s ('%s', linha %d)!\n", mensagem, leitor->caminho, leitor->linha);
+}
+
+/**
+ * Acrescenta um byte a um campo (false se o campo não cabe)
+ */
+static bool acrescentar(char* destino, size_t* usado, size_t tamanho, int c) {
+    if (*usado + 1 >= tamanho) {
+        return false;
+    }
+    destino[(*usado)++] = (char)c;
+    return true;
+}
+
+/**
+ * Lê um registro CSV (campos entre aspas podem ter vírgulas, aspas e quebras de linha)
+ * Retorna: 1 se leu um registro, 0 no fim do arquivo, -1 se o registro tem erro
+ */
+static int ler_registro_csv(LeitorImportacao* leitor) {
+    FILE* arquivo = leitor->arquivo;
+    int c = getc(arquivo);
+    if (c == EOF) {
+        return 0;
+    }
+
+    leitor->linha = leitor->proxima_linha;
+    leitor->total_campos = 0;
+
+    while (true) {
+        if (leitor->total_campos == MAX_COLUNAS_IMPORTACAO) {
+            erro_leitura(leitor, "Colunas demais no registro");
+            return -1;
+        }
+
+        char* destino = leitor->valores[leitor->total_campos++];
+        size_t usado = 0;
+
+        if (c == '"') {
+            while (true) {
+                c = getc(arquivo);
+                if (c == EOF) {
+                    erro_leitura(leitor, "Aspas sem fechamento");
+                    return -1;
+                }
+                if (c == '"') {
+                    c = getc(arquivo);
+                    if (c != '"') break; // Fim do campo; "" é uma aspa
+                }
+                if (c == '\n') {
+                    leitor->proxima_linha++;
+                }
+                if (!acrescentar(destino, &usado, MAX_VALOR_IMPORTACAO, c)) {
+                    erro_leitura(leitor, "Campo longo demais");
+                    return -1;
+                }
+            }
+        } else {
+            while (c != ',' && c != '\n' && c != '\r' && c != EOF) {
+                if (!acrescentar(destino, &usado, MAX_VALOR_IMPORTACAO, c)) {
+                    erro_leitura(leitor, "Campo longo demais");
+                    return -1;
+                }
+                c = getc(arquivo);
+            }
+        }
+        destino[usado] = '\0';
+
+        if (c == '\r') {
+            c = getc(arquivo);
+            if (c != '\n' && c != EOF) {
+                ungetc(c, arquivo);
+                c = '\n';
+            }
+        }
+
+        if (c == ',') {
+            c = getc(arquivo);
+            continue;
+        }
+        if (c == '\n' || c == EOF) {
+            leitor->proxima_linha++;
+            return 1;
+        }
+
+        erro_leitura(leitor, "Texto depois das aspas de um campo");
+        return -1;
+    }
+}
+
+/**
+ * Pula espaços e tabulações (não as quebras de linha)
+ * Retorna: Primeiro caractere depois deles
+ */
+static int pular_espacos(FILE* arquivo) {
+    int c = getc(arquivo);
+    while (c == ' ' || c == '\t' || c == '\r') {
+        c = getc(arquivo);
+    }
+    return c;
+}
+
+/**
+ * Lê quatro dígitos hexadecimais de um escape \uXXXX
+ * Retorna: Valor lido, ou -1 se algum caractere não é hexadecimal
+ */
+static long ler_hexa(FILE* arquivo) {
+    long valor = 0;
+    for (int i = 0; i < 4; i++) {
+        int c = getc(arquivo);
+        int digito;
+        if (c >= '0' && c <= '9') digito = c - '0';
+        else if (c >= 'a' && c <= 'f') digito = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') digito = c - 'A' + 10;
+        else return -1;
+        valor = valor * 16 + digito;
+    }
+    return valor;
+}
+
+/**
+ * Acrescenta um caractere Unicode a um campo, em UTF-8
+ */
+static bool acrescentar_utf8(char* destino, size_t* usado, size_t tamanho, long codigo) {
+    if (codigo < 0x80) {
+        return acrescentar(destino, usado, tamanho, (int)codigo);
+    }
+    if (codigo < 0x800) {
+        return acrescentar(destino, usado, tamanho, 0xC0 | (int)(codigo >> 6)) &&
+               acrescentar(destino, usado, tamanho, 0x80 | (int)(codigo & 0x3F));
+    }
+    if (codigo < 0x10000) {
+        return acrescentar(destino, usado, tamanho, 0xE0 | (int)(codigo >> 12)) &&
+               acrescentar(destino, usado, tamanho, 0x80 | (int)((codigo >> 6) & 0x3F)) &&
+               acrescentar(destino, usado, tamanho, 0x80 | (int)(codigo & 0x3F));
+    }
+    return acrescentar(destino, usado, tamanho, 0xF0 | (int)(codigo >> 18)) &&
+           acrescentar(destino, usado, tamanho, 0x80 | (int)((codigo >> 12) & 0x3F)) &&
+           acrescentar(destino, usado, tamanho, 0x80 | (int)((codigo >> 6) & 0x3F)) &&
+           acrescentar(destino, usado, tamanho, 0x80 | (int)(codigo & 0x3F));
+}
+
+/**
+ * Lê um texto JSON (a aspa de abertura já foi lida), desfazendo os escapes
+ * Retorna: true se o texto terminou e coube no destino
+ */
+static bool ler_texto_json(LeitorImportacao* leitor, char* destino, size_t tamanho) {
+    FILE* arquivo = leitor->arquivo;
+    size_t usado = 0;
+    bool cabe = true;
+
+    while (cabe) {
+        int c = getc(arquivo);
+        if (c == EOF || c == '\n') {
+            erro_leitura(leitor, "Texto sem aspas de fechamento");
+            return false;
+        }
+        if (c == '"') {
+            destino[usado] = '\0';
+            return true;
+        }
+        if (c != '\\') {
+            cabe = acrescentar(destino, &usado, tamanho, c);
+            continue;
+        }
+
+        long codigo;
+        c = getc(arquivo);
+        switch (c) {
+            case '"': case '\\': case '/': cabe = acrescentar(destino, &usado, tamanho, c); break;
+            case 'b': cabe = acrescentar(destino, &usado, tamanho, '\b'); break;
+            case 'f': cabe = acrescentar(destino, &usado, tamanho, '\f'); break;
+            case 'n': cabe = acrescentar(destino, &usado, tamanho, '\n'); break;
+            case 'r': cabe = acrescentar(destino, &usado, tamanho, '\r'); break;
+            case 't': cabe = acrescentar(destino, &usado, tamanho, '\t'); break;
+            case 'u':
+                codigo = ler_hexa(arquivo);
+                // Par substituto (caracteres fora do plano básico)
+                if (codigo >= 0xD800 && codigo <= 0xDBFF) {
+                    long baixo = -1;
+                    if (getc(arquivo) == '\\' && getc(arquivo) == 'u') {
+                        baixo = ler_hexa(arquivo);
+                    }
+                    if (baixo < 0xDC00 || baixo > 0xDFFF) {
+                        codigo = -1;
+                    } else {
+                        codigo = 0x10000 + ((codigo - 0xD800) << 10) + (baixo - 0xDC00);
+                    }
+                }
+                if (codigo < 0 || (codigo >= 0xDC00 && codigo <= 0xDFFF)) {
+                    erro_leitura(leitor, "Escape \\u inválido");
+                    return false;
+                }
+                cabe = acrescentar_utf8(destino, &usado, tamanho, codigo);
+                break;
+            default:
+                erro_leitura(leitor, "Escape inválido em um texto");
+                return false;
+        }
+    }
+
+    erro_leitura(leitor, "Campo longo demais");
+    return false;
+}
+
+/**
+ * Lê um registro JSON Lines (um objeto por linha; linhas em branco são puladas)
+ * Os valores são textos, números, true, false ou null; todos ficam como texto.
+ * Retorna: 1 se leu um registro, 0 no fim do arquivo, -1 se o registro tem erro
+ */
+static int ler_registro_json(LeitorImportacao* leitor) {
+    FILE* arquivo = leitor->arquivo;
+    int c = pular_espacos(arquivo);
+    while (c == '\n') {
+        leitor->proxima_linha++;
+        c = pular_espacos(arquivo);
+    }
+    if (c == EOF) {
+        return 0;
+    }
+
+    leitor->linha = leitor->proxima_linha++;
+    leitor->total_campos = 0;
+
+    if (c != '{') {
+        erro_leitura(leitor, "Registro não começa com '{'");
+        return -1;
+    }
+
+    c = pular_espacos(arquivo);
+    if (c != '}') {
+        while (true) {
+            if (leitor->total_campos == MAX_COLUNAS_IMPORTACAO) {
+                erro_leitura(leitor, "Campos demais no registro");
+                return -1;
+            }
+            int campo = leitor->total_campos++;
+
+            if (c != '"') {
+                erro_leitura(leitor, "Chave sem aspas");
+                return -1;
+            }
+            if (!ler_texto_json(leitor, leitor->chaves[campo], sizeof(leitor->chaves[campo]))) {
+                return -1;
+            }
+            if (pular_espacos(arquivo) != ':') {
+                erro_leitura(leitor, "Faltou ':' depois da chave");
+                return -1;
+            }
+
+            c = pular_espacos(arquivo);
+            if (c == '"') {
+                if (!ler_texto_json(leitor, leitor->valores[campo], MAX_VALOR_IMPORTACAO)) {
+                    return -1;
+                }
+                c = pular_espacos(arquivo);
+            } else {
+                // Número, true, false ou null
+                size_t usado = 0;
+                while (c == '-' || c == '+' || c == '.' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+                       c == 'E') {
+                    if (!acrescentar(leitor->valores[campo], &usado, MAX_VALOR_IMPORTACAO, c)) {
+                        erro_leitura(leitor, "Campo longo demais");
+                        return -1;
+                    }
+                    c = getc(arquivo);
+                }
+                leitor->valores[campo][usado] = '\0';
+                if (usado == 0) {
+                    erro_leitura(leitor, "Valor inválido");
+                    return -1;
+                }
+                if (c == ' ' || c == '\t' || c == '\r') {
+                    c = pular_espacos(arquivo);
+                }
+            }
+
+            if (c == '}') break;
+            if (c != ',') {
+                erro_leitura(leitor, "Faltou ',' ou '}' depois de um valor");
+                return -1;
+            }
+            c = pular_espacos(arquivo);
+        }
+    }
+
+    c = pular_espacos(arquivo);
+    if (c != '\n' && c != EOF) {
+        erro_leitura(leitor, "Texto depois do fim do objeto");
+        return -1;
+    }
+    return 1;
+}
+
+/**
+ * Lê o próximo registro do arquivo
+ * Retorna: 1 se leu um registro, 0 no fim do arquivo, -1 se o registro tem erro
+ */
+static int ler_registro(LeitorImportacao* leitor) {
+    if (leitor->formato == FORMATO_JSON_LINHAS) {
+        return ler_registro_json(leitor);
+    }
+
+    // No CSV, uma linha vazia vira um registro de um campo vazio: é pulada
+    int resultado;
+    do {
+        resultado = ler_registro_csv(leitor);
+    } while (resultado == 1 && leitor->total_campos == 1 && leitor->valores[0][0] == '\0');
+    return resultado;
+}
+
+/**
+ * Abre um arquivo exportado (no CSV, já lê o cabeçalho)
+ * Retorna: true se o arquivo foi aberto
+ */
+static bool abrir_importacao(LeitorImportacao* leitor, const char* caminho, int formato) {
+    if (formato != FORMATO_CSV && formato != FORMATO_JSON_LINHAS) {
+        printf("Erro: Formato de importação inválido!\n");
+        return false;
+    }
+
+    leitor->arquivo = fopen(caminho, "r");
+    if (leitor->arquivo == NULL) {
+        printf("Erro: Não foi possível abrir '%s' (%s)!\n", caminho, strerror(errno));
+        return false;
+    }
+
+    leitor->caminho = caminho;
+    leitor->formato = formato;
+    leitor->linha = 1;
+    leitor->proxima_linha = 1;
+    leitor->total_colunas = 0;
+    leitor->total_campos = 0;
+
+    if (formato == FORMATO_CSV) {
+        int resultado = ler_registro(leitor);
+        if (resultado < 0) {
+            fclose(leitor->arquivo);
+            return false;
+        }
+
+        // Arquivo vazio: nenhum registro
+        leitor->total_colunas = resultado == 0 ? 0 : leitor->total_campos;
+        for (int i = 0; i < leitor->total_colunas; i++) {
+            strncpy(leitor->colunas[i], leitor->valores[i], sizeof(leitor->colunas[i]) - 1);
+            leitor->colunas[i][sizeof(leitor->colunas[i]) - 1] = '\0';
+        }
+    }
+    return true;
+}
+
+/**
+ * Valor de uma coluna no registro atual (mostra o erro se a coluna falta)
+ * Retorna: Texto do campo, ou NULL se o registro não tem a coluna
+ */
+static const char* campo(LeitorImportacao* leitor, const char* nome) {
+    if (leitor->formato == FORMATO_CSV) {
+        for (int i = 0; i < leitor->total_colunas; i++) {
+            if (strcmp(leitor->colunas[i], nome) == 0) {
+                if (i < leitor->total_campos) {
+                    return leitor->valores[i];
+                }
+                break;
+            }
+        }
+    } else {
+        for (int i = 0; i < leitor->total_campos; i++) {
+            if (strcmp(leitor->chaves[i], nome) == 0) {
+                return leitor->valores[i];
+            }
+        }
+    }
+
+    printf("Erro: Falta a coluna '%s' ('%s', linha %d)!\n", nome, leitor->caminho, leitor->linha);
+    return NULL;
+}
+
+/**
+ * Copia uma coluna de texto para um campo de tamanho fixo
+ * Retorna: true se a coluna existe e cabe no campo
+ */
+static bool campo_texto(LeitorImportacao* leitor, const char* nome, char* destino, size_t tamanho) {
+    const char* valor = campo(leitor, nome);
+    if (valor == NULL) {
+        return false;
+    }
+    if (strlen(valor) >= tamanho) {
+        printf("Erro: Coluna '%s' longa demais ('%s', linha %d)!\n", nome, leitor->caminho, leitor->linha);
+        return false;
+    }
+    strcpy(destino, valor);
+    return true;
+}
+
+/**
+ * Lê uma coluna inteira
+ * Retorna: true se a coluna existe e é um número inteiro
+ */
+static bool campo_inteiro(LeitorImportacao* leitor, const char* nome, long long* destino) {
+    const char* valor = campo(leitor, nome);
+    if (valor == NULL) {
+        return false;
+    }
+
+    char* fim;
+    errno = 0;
+    *destino = strtoll(valor, &fim, 10);
+    if (fim == valor || *fim != '\0' || errno != 0) {
+        printf("Erro: Coluna '%s' não é um número ('%s', linha %d)!\n", nome, leitor->caminho, leitor->linha);
+        return false;
+    }
+    return true;
+}
+
+// =============================================================================
+// IMPORTAÇÃO
+// =============================================================================
+
+/**
+ * Cadastra os títulos de um catálogo exportado
+ */
+int importar_catalogo(ListaLivros* lista, const char* caminho, int formato) {
+    LeitorImportacao* leitor = (LeitorImportacao*)malloc(sizeof(LeitorImportacao));
+    if (lista == NULL || leitor == NULL) {
+        free(leitor);
+        return -1;
+    }
+    if (!abrir_importacao(leitor, caminho, formato)) {
+        free(leitor);
+        return -1;
+    }
+
+    int importados = 0;
+    int resultado;
+    Livro livro;
+    long long ano, exemplares;
+
+    while ((resultado = ler_registro(leitor)) == 1) {
+        memset(&livro, 0, sizeof(Livro));
+        if (!campo_texto(leitor, "titulo", livro.titulo, MAX_TITULO) ||
+            !campo_texto(leitor, "autor", livro.autor, MAX_AUTOR) ||
+            !campo_inteiro(leitor, "ano", &ano) ||
+            !campo_texto(leitor, "isbn", livro.isbn, MAX_ISBN) ||
+            !campo_inteiro(leitor, "exemplares", &exemplares)) {
+            resultado = -1;
+            break;
+        }
+        if (exemplares < 1 || exemplares > 1000000 || ano < -100000 || ano > 100000) {
+            erro_leitura(leitor, "Ano ou quantidade de exemplares fora do intervalo");
+            resultado = -1;
+            break;
+        }
+
+        livro.ano_publicacao = (int)ano;
+        livro.quantidade = (int)exemplares;
+        livro.status = true;
+        if (!adicionar_livro(lista, livro)) {
+            erro_leitura(leitor, "Título não cadastrado");
+            resultado = -1;
+            break;
+        }
+        importados++;
+    }
+
+    fclose(leitor->arquivo);
+    free(leitor);
+    return resultado < 0 ? -1 : importados;
+}
+
+/**
+ * Aplica os empréstimos e reservas lidos de um título (todos os exemplares começam livres)
+ */
+static bool aplicar_emprestimos(Biblioteca* bib, LeitorImportacao* leitor, NoLivro* livro,
+                                const Exemplar* situacao) {
+    if (livro->total_livres != livro->dados.quantidade || livro->total_separados > 0) {
+        erro_leitura(leitor, "Empréstimos do título repetidos ou fora de ordem");
+        return false;
+    }
+    if (!restaurar_situacao_livro(bib, livro, situacao)) {
+        erro_leitura(leitor, "Falha ao restaurar os empréstimos do título");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Devolve aos leitores os exemplares de um arquivo de empréstimos exportado
+ * (e volta a separar os exemplares reservados para a fila)
+ */
+int importar_emprestimos(Biblioteca* bib, const char* caminho, int formato) {
+    LeitorImportacao* leitor = (LeitorImportacao*)malloc(sizeof(LeitorImportacao));
+    if (bib == NULL || leitor == NULL) {
+        free(leitor);
+        return -1;
+    }
+    if (!abrir_importacao(leitor, caminho, formato)) {
+        free(leitor);
+        return -1;
+    }
+
+    int importados = 0;
+    int resultado;
+    char titulo[MAX_TITULO];
+    char nome_leitor[MAX_NOME_LEITOR];
+    char nome_reserva[MAX_NOME_LEITOR];
+    long long numero, data_emprestimo, devolver_ate, fim_reserva;
+
+    // Título em montagem e a situação de cada um dos seus exemplares
+    NoLivro* livro = NULL;
+    Exemplar* situacao = NULL;
+
+    while ((resultado = ler_registro(leitor)) == 1) {
+        if (!campo_texto(leitor, "titulo", titulo, MAX_TITULO) ||
+            !campo_inteiro(leitor, "exemplar", &numero) ||
+            !campo_texto(leitor, "leitor", nome_leitor, MAX_NOME_LEITOR) ||
+            !campo_inteiro(leitor, "data_emprestimo", &data_emprestimo) ||
+            !campo_inteiro(leitor, "devolver_ate", &devolver_ate) ||
+            !campo_texto(leitor, "reserva", nome_reserva, MAX_NOME_LEITOR) ||
+            !campo_inteiro(leitor, "fim_reserva", &fim_reserva)) {
+            resultado = -1;
+            break;
+        }
+
+        NoLivro* encontrado = trie_titulos_buscar(bib->catalogo->trie_titulos, titulo);
+        if (encontrado == NULL) {
+            erro_leitura(leitor, "Título fora do catálogo");
+            resultado = -1;
+            break;
+        }
+
+        // Outro título: aplica o anterior e começa com todos os exemplares livres
+        if (encontrado != livro) {
+            if (livro != NULL && !aplicar_emprestimos(bib, leitor, livro, situacao)) {
+                livro = NULL;
+                resultado = -1;
+                break;
+            }
+            free(situacao);
+            situacao = (Exemplar*)calloc(encontrado->dados.quantidade, sizeof(Exemplar));
+            if (situacao == NULL) {
+                erro_leitura(leitor, "Falha ao alocar memória");
+                livro = NULL;
+                resultado = -1;
+                break;
+            }
+            for (int i = 0; i < encontrado->dados.quantidade; i++) {
+                situacao[i].status = true;
+            }
+            livro = encontrado;
+        }
+
+        // Cada exemplar aparece uma vez: emprestado (com leitor) ou separado (com reserva)
+        if (numero < 1 || numero > livro->dados.quantidade || !situacao[numero - 1].status ||
+            strlen(situacao[numero - 1].nome_reserva) > 0 ||
+            (strlen(nome_leitor) == 0) == (strlen(nome_reserva) == 0)) {
+            erro_leitura(leitor, "Exemplar inexistente, repetido ou sem leitor/reserva");
+            livro = NULL;
+            resultado = -1;
+            break;
+        }
+        Exemplar* exemplar = &situacao[numero - 1];
+        if (strlen(nome_leitor) > 0) {
+            exemplar->status = false;
+            strcpy(exemplar->nome_leitor_atual, nome_leitor);
+            exemplar->data_emprestimo = (time_t)data_emprestimo;
+            exemplar->data_devolucao_prevista = (time_t)devolver_ate;
+        } else {
+            strcpy(exemplar->nome_reserva, nome_reserva);
+            exemplar->fim_reserva = (time_t)fim_reserva;
+        }
+        importados++;
+    }
+
+    // O último título lido ainda não foi aplicado
+    if (resultado == 0 && livro != NULL && !aplicar_emprestimos(bib, leitor, livro, situacao)) {
+        resultado = -1;
+    }
+
+    free(situacao);
+    fclose(leitor->arquivo);
+    free(leitor);
+    return resultado < 0 ? -1 : importados;
+}
+
+/**
+ * Coloca na fila as solicitações de uma fila exportada, com a data original
+ */
+int importar_filas(FilaEspera* fila, const char* caminho, int formato) {
+    LeitorImportacao* leitor = (LeitorImportacao*)malloc(sizeof(LeitorImportacao));
+    if (fila == NULL || leitor == NULL) {
+        free(leitor);
+        return -1;
+    }
+    if (!abrir_importacao(leitor, caminho, formato)) {
+        free(leitor);
+        return -1;
+    }
+
+    int importadas = 0;
+    int resultado;
+    Solicitacao solicitacao;
+    long long prioridade, data;
+
+    while ((resultado = ler_registro(leitor)) == 1) {
+        if (!campo_texto(leitor, "titulo", solicitacao.titulo_livro, MAX_TITULO) ||
+            !campo_texto(leitor, "leitor", solicitacao.nome_leitor, MAX_NOME_LEITOR) ||
+            !campo_inteiro(leitor, "prioridade", &prioridade) ||
+            !campo_inteiro(leitor, "data_solicitacao", &data)) {
+            resultado = -1;
+            break;
+        }
+        if (prioridade != PRIORIDADE_PREFERENCIAL && prioridade != PRIORIDADE_GERAL) {
+            erro_leitura(leitor, "Prioridade inválida");
+            resultado = -1;
+            break;
+        }
+
+        // Um par (leitor, título) repetido não entra de novo na fila
+        int antes = fila->total;
+        if (!enfileirar_com_prioridade(fila, solicitacao.nome_leitor, solicitacao.titulo_livro,
+                                       (int)prioridade)) {
+            erro_leitura(leitor, "Solicitação não enfileirada");
+            resultado = -1;
+            break;
+        }
+        if (fila->total > antes) {
+            fila->tras->dados.data_solicitacao = (time_t)data;
+            importadas++;
+        }
+    }
+
+    fclose(leitor->arquivo);
+    free(leitor);
+    return resultado < 0 ? -1 : importadas;
+}
+
+/**
+ * Acrescenta ao histórico as operações de um histórico exportado, com o horário original
+ */
+int importar_historico(PilhaHistorico* pilha, const char* caminho, int formato) {
+    LeitorImportacao* leitor = (LeitorImportacao*)malloc(sizeof(LeitorImportacao));
+    Operacao* lote = (Operacao*)malloc(LOTE_IMPORTACAO * sizeof(Operacao));
+    if (pilha == NULL || leitor == NULL || lote == NULL) {
+        free(leitor);
+        free(lote);
+        return -1;
+    }
+    if (!abrir_importacao(leitor, caminho, formato)) {
+        free(leitor);
+        free(lote);
+        return -1;
+    }
+
+    int importadas = 0;
+    int no_lote = 0;
+    int resultado;
+    long long data;
+
+    while ((resultado = ler_registro(leitor)) == 1) {
+        Operacao* operacao = &lote[no_lote];
+        if (!campo_texto(leitor, "operacao", operacao->tipo_operacao, sizeof(operacao->tipo_operacao)) ||
+            !campo_texto(leitor, "livro", operacao->titulo_livro, MAX_TITULO) ||
+            !campo_texto(leitor, "leitor", operacao->nome_leitor, MAX_NOME_LEITOR) ||
+            !campo_inteiro(leitor, "data", &data)) {
+            resultado = -1;
+            break;
+        }
+        if (codigo_tipo_operacao(operacao->tipo_operacao) < 0) {
+            erro_leitura(leitor, "Tipo de operação desconhecido");
+            resultado = -1;
+            break;
+        }
+        operacao->data_operacao = (time_t)data;
+
+        if (++no_lote == LOTE_IMPORTACAO) {
+            if (!empilhar_com_horarios(pilha, lote, no_lote)) {
+                erro_leitura(leitor, "Operações não registradas");
+                resultado = -1;
+                break;
+            }
+            importadas += no_lote;
+            no_lote = 0;
+        }
+    }
+
+    if (resultado == 0 && no_lote > 0) {
+        if (empilhar_com_horarios(pilha, lote, no_lote)) {
+            importadas += no_lote;
+        } else {
+            erro_leitura(leitor, "Operações não registradas");
+            resultado = -1;
+        }
+    }
+
+    fclose(leitor->arquivo);
+    free(leitor);
+    free(lote);
+    return resultado < 0 ? -1 : importadas;
+}
+
+/**
+ * Reconstrói catálogo, empréstimos, fila e histórico a partir de <prefixo>_<estrutura>.csv ou .jsonl
+ */
+bool importar_biblioteca(Biblioteca* bib, const char* prefixo, int formato) {
+    char caminho[MAX_CAMINHO_EXPORTACAO];
+
+    if (bib == NULL || prefixo == NULL) return false;
+
+    if (!montar_caminho(caminho, prefixo, "catalogo", formato) ||
+        importar_catalogo(bib->catalogo, caminho, formato) < 0) {
+        return false;
+    }
+    if (!montar_caminho(caminho, prefixo, "emprestimos", formato) ||
+        importar_emprestimos(bib, caminho, formato) < 0) {
+        return false;
+    }
+    if (!montar_caminho(caminho, prefixo, "filas", formato) ||
+        importar_filas(bib->fila_espera, caminho, formato) < 0) {
+        return false;
+    }
+    if (!montar_caminho(caminho, prefixo, "historico", formato) ||
+        importar_historico(bib->historico, caminho, formato) < 0) {
+        return false;
+    }
+    return true;
+}
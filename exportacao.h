@@ -0,0 +1,177 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: exportacao.h
+ * Descrição: Exportação e importação do catálogo, empréstimos, fila e histórico
+ *            em CSV e JSON Lines
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef EXPORTACAO_H
+#define EXPORTACAO_H
+
+#include "biblioteca.h"
+#include "saida.h"
+
+// =============================================================================
+// LAYOUT DOS ARQUIVOS
+// =============================================================================
+
+/*
+ * Cada estrutura vai para um arquivo próprio, com um registro por linha:
+ *   - CSV (FORMATO_CSV): primeira linha com os nomes das colunas; campos com
+ *     vírgula, aspas ou quebra de linha vão entre aspas (aspas viram "").
+ *   - JSON Lines (FORMATO_JSON_LINHAS): um objeto por linha, com as colunas
+ *     como chaves.
+ * Datas são segundos desde 01/01/1970 (UTC), para a importação voltar ao mesmo
+ * instante em qualquer fuso. Na importação, as colunas valem pelo nome (a
+ * ordem não importa) e colunas desconhecidas são ignoradas.
+ *
+ *   <prefixo>_catalogo     titulo, autor, ano, isbn, exemplares
+ *   <prefixo>_emprestimos  titulo, exemplar, leitor, data_emprestimo, devolver_ate,
+ *                          reserva, fim_reserva (exemplar emprestado: leitor e datas;
+ *                          separado para a fila: reserva e fim_reserva; o resto vazio ou 0)
+ *   <prefixo>_filas        titulo, leitor, prioridade, data_solicitacao
+ *                          (ordem de chegada; prioridade 0 = preferencial, 1 = geral)
+ *   <prefixo>_historico    operacao, livro, leitor, data (da mais antiga à mais recente)
+ *
+ * A extensão é .csv ou .jsonl. A importação reconstrói catálogo, empréstimos
+ * (cada exemplar volta para o seu leitor, com as datas originais), reservas
+ * (o exemplar volta a ficar separado até o mesmo prazo), fila e histórico.
+ */
+
+#define COLUNAS_CATALOGO "titulo,autor,ano,isbn,exemplares"
+#define COLUNAS_EMPRESTIMOS "titulo,exemplar,leitor,data_emprestimo,devolver_ate,reserva,fim_reserva"
+#define COLUNAS_FILAS "titulo,leitor,prioridade,data_solicitacao"
+#define COLUNAS_HISTORICO "operacao,livro,leitor,data"
+
+#define MAX_CAMINHO_EXPORTACAO 512  // Tamanho máximo do caminho de cada arquivo
+#define MAX_COLUNAS_IMPORTACAO 16   // Colunas lidas por registro
+#define MAX_VALOR_IMPORTACAO 256    // Tamanho máximo de um campo lido
+#define LOTE_IMPORTACAO 1024        // Operações do histórico gravadas de uma vez
+
+// =============================================================================
+// FUNÇÕES DE EXPORTAÇÃO
+// =============================================================================
+
+/**
+ * Exporta o catálogo (um registro por título)
+ * Os registros vão direto das estruturas para o arquivo através do buffer da
+ * saída: a memória usada não depende do tamanho do catálogo.
+ * Parâmetros:
+ *   - lista: Ponteiro para o catálogo
+ *   - caminho: Arquivo de destino (criado ou substituído)
+ *   - formato: FORMATO_CSV ou FORMATO_JSON_LINHAS
+ * Retorna: true se o arquivo foi escrito por inteiro
+ */
+bool exportar_catalogo(ListaLivros* lista, const char* caminho, int formato);
+
+/**
+ * Exporta os exemplares emprestados e os separados para a fila (um registro por exemplar)
+ * Parâmetros:
+ *   - lista: Ponteiro para o catálogo
+ *   - caminho: Arquivo de destino
+ *   - formato: FORMATO_CSV ou FORMATO_JSON_LINHAS
+ * Retorna: true se o arquivo foi escrito por inteiro
+ */
+bool exportar_emprestimos(ListaLivros* lista, const char* caminho, int formato);
+
+/**
+ * Exporta a fila de espera em ordem de chegada
+ * Parâmetros:
+ *   - fila: Ponteiro para a fila de espera
+ *   - caminho: Arquivo de destino
+ *   - formato: FORMATO_CSV ou FORMATO_JSON_LINHAS
+ * Retorna: true se o arquivo foi escrito por inteiro
+ */
+bool exportar_filas(FilaEspera* fila, const char* caminho, int formato);
+
+/**
+ * Exporta o histórico, da operação mais antiga para a mais recente
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - caminho: Arquivo de destino
+ *   - formato: FORMATO_CSV ou FORMATO_JSON_LINHAS
+ * Retorna: true se o arquivo foi escrito por inteiro
+ */
+bool exportar_historico(PilhaHistorico* pilha, const char* caminho, int formato);
+
+/**
+ * Exporta as quatro estruturas para <prefixo>_<estrutura>.csv ou .jsonl
+ * Com paralelo, cada arquivo é escrito por uma thread própria; as estruturas
+ * só são lidas, então nenhuma outra operação pode alterá-las durante a exportação.
+ * Parâmetros:
+ *   - bib: Ponteiro para a biblioteca
+ *   - prefixo: Início do caminho dos arquivos (ex.: "backup/noite")
+ *   - formato: FORMATO_CSV ou FORMATO_JSON_LINHAS
+ *   - paralelo: true para uma thread por estrutura
+ * Retorna: true se os quatro arquivos foram escritos
+ */
+bool exportar_biblioteca(Biblioteca* bib, const char* prefixo, int formato, bool paralelo);
+
+// =============================================================================
+// FUNÇÕES DE IMPORTAÇÃO
+// =============================================================================
+
+/**
+ * Cadastra os títulos de um catálogo exportado
+ * O arquivo é lido registro a registro, com memória constante.
+ * Parâmetros:
+ *   - lista: Ponteiro para o catálogo
+ *   - caminho: Arquivo exportado por exportar_catalogo()
+ *   - formato: FORMATO_CSV ou FORMATO_JSON_LINHAS
+ * Retorna: Quantidade de títulos cadastrados, ou -1 se o arquivo tem erro
+ *          (os títulos anteriores à linha com erro continuam cadastrados)
+ */
+int importar_catalogo(ListaLivros* lista, const char* caminho, int formato);
+
+/**
+ * Devolve aos leitores os exemplares de um arquivo de empréstimos exportado
+ * Os registros de um mesmo título vêm juntos (como exportar_emprestimos() grava);
+ * cada grupo é aplicado de uma vez por restaurar_situacao_livro(), com os
+ * exemplares que não aparecem livres; os separados voltam para a roda de
+ * reservas. O título precisa estar no catálogo sem nenhum empréstimo ou reserva.
+ * Parâmetros:
+ *   - bib: Ponteiro para a biblioteca (catálogo já importado)
+ *   - caminho: Arquivo exportado por exportar_emprestimos()
+ *   - formato: FORMATO_CSV ou FORMATO_JSON_LINHAS
+ * Retorna: Quantidade de exemplares restaurados, ou -1 se o arquivo tem erro
+ *          (os títulos anteriores ao erro ficam com os empréstimos restaurados)
+ */
+int importar_emprestimos(Biblioteca* bib, const char* caminho, int formato);
+
+/**
+ * Coloca na fila as solicitações de uma fila exportada, com a data original
+ * Parâmetros:
+ *   - fila: Ponteiro para a fila de espera
+ *   - caminho: Arquivo exportado por exportar_filas()
+ *   - formato: FORMATO_CSV ou FORMATO_JSON_LINHAS
+ * Retorna: Quantidade de solicitações enfileiradas, ou -1 se o arquivo tem erro
+ */
+int importar_filas(FilaEspera* fila, const char* caminho, int formato);
+
+/**
+ * Acrescenta ao histórico as operações de um histórico exportado, com o horário original
+ * As datas precisam estar em ordem e não antes da última operação já registrada.
+ * Parâmetros:
+ *   - pilha: Ponteiro para a pilha de histórico
+ *   - caminho: Arquivo exportado por exportar_historico()
+ *   - formato: FORMATO_CSV ou FORMATO_JSON_LINHAS
+ * Retorna: Quantidade de operações importadas, ou -1 se o arquivo tem erro
+ */
+int importar_historico(PilhaHistorico* pilha, const char* caminho, int formato);
+
+/**
+ * Reconstrói catálogo, empréstimos, fila e histórico a partir de <prefixo>_<estrutura>.csv ou .jsonl
+ * Parâmetros:
+ *   - bib: Ponteiro para a biblioteca (normalmente recém-inicializada)
+ *   - prefixo: Início do caminho usado em exportar_biblioteca()
+ *   - formato: FORMATO_CSV ou FORMATO_JSON_LINHAS
+ * Retorna: true se os quatro arquivos foram importados sem erro
+ */
+bool importar_biblioteca(Biblioteca* bib, const char* prefixo, int formato);
+
+#endif // EXPORTACAO_H
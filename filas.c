@@ -0,0 +1,533 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: filas.c
+ * Descrição: Implementação das filas de espera por título
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#include "filas.h"
+#include "textos.h"
+
+// =============================================================================
+// FUNÇÕES AUXILIARES DO HEAP
+// =============================================================================
+
+/**
+ * Verifica se a solicitação a deve ser atendida antes da solicitação b
+ */
+static bool vem_antes(FilasPorTitulo* filas, NoFila* a, NoFila* b) {
+    if (filas->modo_prioridade && a->dados.prioridade != b->dados.prioridade) {
+        return a->dados.prioridade < b->dados.prioridade;
+    }
+    return a->sequencia < b->sequencia;
+}
+
+/**
+ * Coloca uma solicitação em uma posição do heap, atualizando a posição guardada no nó
+ */
+static void colocar_no_heap(FilaTitulo* fila_titulo, int i, NoFila* solicitacao) {
+    fila_titulo->heap[i] = solicitacao;
+    solicitacao->posicao_heap = i;
+}
+
+/**
+ * Sobe o elemento da posição i até restaurar a ordem do heap
+ */
+static void subir(FilasPorTitulo* filas, FilaTitulo* fila_titulo, int i) {
+    NoFila* solicitacao = fila_titulo->heap[i];
+
+    while (i > 0) {
+        int pai = (i - 1) / 2;
+        if (!vem_antes(filas, solicitacao, fila_titulo->heap[pai])) {
+            break;
+        }
+        colocar_no_heap(fila_titulo, i, fila_titulo->heap[pai]);
+        i = pai;
+    }
+    colocar_no_heap(fila_titulo, i, solicitacao);
+}
+
+/**
+ * Desce o elemento da posição i até restaurar a ordem do heap
+ */
+static void descer(FilasPorTitulo* filas, FilaTitulo* fila_titulo, int i) {
+    NoFila* solicitacao = fila_titulo->heap[i];
+
+    while (true) {
+        int filho = 2 * i + 1;
+        if (filho >= fila_titulo->total) {
+            break;
+        }
+        if (filho + 1 < fila_titulo->total &&
+            vem_antes(filas, fila_titulo->heap[filho + 1], fila_titulo->heap[filho])) {
+            filho++;
+        }
+        if (!vem_antes(filas, fila_titulo->heap[filho], solicitacao)) {
+            break;
+        }
+        colocar_no_heap(fila_titulo, i, fila_titulo->heap[filho]);
+        i = filho;
+    }
+    colocar_no_heap(fila_titulo, i, solicitacao);
+}
+
+/**
+ * Conta as solicitações da subárvore de i que vêm antes da solicitação alvo
+ * Como o heap está ordenado, uma subárvore cuja raiz não vem antes é descartada.
+ */
+static int contar_a_frente(FilasPorTitulo* filas, FilaTitulo* fila_titulo, int i, NoFila* alvo) {
+    if (i >= fila_titulo->total || !vem_antes(filas, fila_titulo->heap[i], alvo)) {
+        return 0;
+    }
+    return 1 + contar_a_frente(filas, fila_titulo, 2 * i + 1, alvo)
+             + contar_a_frente(filas, fila_titulo, 2 * i + 2, alvo);
+}
+
+// =============================================================================
+// FUNÇÕES DA TABELA DE FILAS POR TÍTULO
+// =============================================================================
+
+/**
+ * Cria a tabela de filas por título
+ */
+FilasPorTitulo* criar_filas_por_titulo() {
+    FilasPorTitulo* filas = (FilasPorTitulo*)malloc(sizeof(FilasPorTitulo));
+    if (filas == NULL) {
+        return NULL;
+    }
+
+    filas->capacidade = CAPACIDADE_INICIAL_FILAS;
+    filas->baldes = (FilaTitulo**)calloc(filas->capacidade, sizeof(FilaTitulo*));
+    if (filas->baldes == NULL) {
+        free(filas);
+        return NULL;
+    }
+
+    filas->capacidade_pares = CAPACIDADE_INICIAL_PARES;
+    filas->pares = (NoFila**)calloc(filas->capacidade_pares, sizeof(NoFila*));
+    if (filas->pares == NULL) {
+        free(filas->baldes);
+        free(filas);
+        return NULL;
+    }
+
+    if (!ranking_iniciar(&filas->demanda)) {
+        free(filas->pares);
+        free(filas->baldes);
+        free(filas);
+        return NULL;
+    }
+
+    filas->total_titulos = 0;
+    filas->modo_prioridade = false;
+    filas->proxima_sequencia = 0;
+    filas->total_pares = 0;
+    return filas;
+}
+
+/**
+ * Procura a fila de um título, em qualquer caixa (sem copiá-lo para minúsculas)
+ */
+static FilaTitulo* procurar_fila(FilasPorTitulo* filas, const char* titulo) {
+    FilaTitulo* atual = filas->baldes[hash_sem_caixa(titulo) % filas->capacidade];
+    while (atual != NULL) {
+        if (iguais_sem_caixa(atual->titulo_busca, titulo)) {
+            return atual;
+        }
+        atual = atual->proximo_balde;
+    }
+    return NULL;
+}
+
+/**
+ * Busca a fila de um título
+ */
+FilaTitulo* filas_buscar(FilasPorTitulo* filas, const char* titulo) {
+    if (filas == NULL || titulo == NULL || strlen(titulo) >= MAX_TITULO) {
+        return NULL;
+    }
+
+    return procurar_fila(filas, titulo);
+}
+
+/**
+ * Dobra o número de baldes da tabela de títulos
+ */
+static void redimensionar_filas(FilasPorTitulo* filas) {
+    int nova_capacidade = filas->capacidade * 2;
+    FilaTitulo** novos = (FilaTitulo**)calloc(nova_capacidade, sizeof(FilaTitulo*));
+    if (novos == NULL) {
+        return; // Continua funcionando, com baldes mais cheios
+    }
+
+    for (int i = 0; i < filas->capacidade; i++) {
+        FilaTitulo* atual = filas->baldes[i];
+        while (atual != NULL) {
+            FilaTitulo* proximo = atual->proximo_balde;
+            unsigned int balde = calcular_hash(atual->titulo_busca) % nova_capacidade;
+            atual->proximo_balde = novos[balde];
+            novos[balde] = atual;
+            atual = proximo;
+        }
+    }
+
+    free(filas->baldes);
+    filas->baldes = novos;
+    filas->capacidade = nova_capacidade;
+}
+
+/**
+ * Cria a fila de um título e a insere na tabela
+ */
+static FilaTitulo* criar_fila_titulo(FilasPorTitulo* filas, const char* titulo_busca) {
+    FilaTitulo* fila_titulo = (FilaTitulo*)malloc(sizeof(FilaTitulo));
+    if (fila_titulo == NULL) {
+        return NULL;
+    }
+
+    fila_titulo->capacidade = CAPACIDADE_INICIAL_HEAP_FILA;
+    fila_titulo->heap = (NoFila**)malloc(fila_titulo->capacidade * sizeof(NoFila*));
+    if (fila_titulo->heap == NULL) {
+        free(fila_titulo);
+        return NULL;
+    }
+
+    strcpy(fila_titulo->titulo_busca, titulo_busca);
+    fila_titulo->total = 0;
+    ranking_iniciar_item(&fila_titulo->demanda, fila_titulo);
+
+    unsigned int balde = calcular_hash(titulo_busca) % filas->capacidade;
+    fila_titulo->proximo_balde = filas->baldes[balde];
+    filas->baldes[balde] = fila_titulo;
+    filas->total_titulos++;
+
+    // Mantém em média no máximo um título por balde
+    if (filas->total_titulos > filas->capacidade) {
+        redimensionar_filas(filas);
+    }
+
+    return fila_titulo;
+}
+
+/**
+ * Retira da tabela e libera a fila (vazia) de um título
+ */
+static void descartar_fila_titulo(FilasPorTitulo* filas, FilaTitulo* fila_titulo) {
+    unsigned int balde = calcular_hash(fila_titulo->titulo_busca) % filas->capacidade;
+    FilaTitulo** ligacao = &filas->baldes[balde];
+
+    while (*ligacao != NULL) {
+        if (*ligacao == fila_titulo) {
+            *ligacao = fila_titulo->proximo_balde;
+            break;
+        }
+        ligacao = &(*ligacao)->proximo_balde;
+    }
+
+    free(fila_titulo->heap);
+    free(fila_titulo);
+    filas->total_titulos--;
+}
+
+// =============================================================================
+// CONJUNTO DE PARES (LEITOR, TÍTULO)
+// =============================================================================
+
+/**
+ * Hash do par (leitor, título) sem diferenciar maiúsculas
+ * Equivale ao hash de "leitor\x1ftítulo" em minúsculas, sem montar a chave.
+ */
+static unsigned int hash_par(const char* nome_leitor, const char* titulo) {
+    unsigned int hash = hash_sem_caixa(nome_leitor);
+    hash = (hash ^ 0x1fu) * 16777619u;
+    return continuar_hash_sem_caixa(hash, titulo);
+}
+
+/**
+ * Procura no conjunto o par (leitor, título), em qualquer caixa
+ */
+static NoFila* procurar_par(FilasPorTitulo* filas, const char* nome_leitor,
+                            const char* titulo, unsigned int hash) {
+    NoFila* atual = filas->pares[hash % filas->capacidade_pares];
+
+    while (atual != NULL) {
+        // O hash completo descarta quase todas as colisões antes de comparar textos
+        if (atual->hash_par == hash && iguais_sem_caixa(atual->fila_titulo->titulo_busca, titulo) &&
+            iguais_sem_caixa(atual->dados.nome_leitor, nome_leitor)) {
+            return atual;
+        }
+        atual = atual->proximo_par;
+    }
+    return NULL;
+}
+
+/**
+ * Dobra o número de baldes do conjunto de pares
+ */
+static void redimensionar_pares(FilasPorTitulo* filas) {
+    int nova_capacidade = filas->capacidade_pares * 2;
+    NoFila** novos = (NoFila**)calloc(nova_capacidade, sizeof(NoFila*));
+    if (novos == NULL) {
+        return; // Continua funcionando, com baldes mais cheios
+    }
+
+    for (int i = 0; i < filas->capacidade_pares; i++) {
+        NoFila* atual = filas->pares[i];
+        while (atual != NULL) {
+            NoFila* proximo = atual->proximo_par;
+            unsigned int balde = atual->hash_par % nova_capacidade;
+            atual->proximo_par = novos[balde];
+            novos[balde] = atual;
+            atual = proximo;
+        }
+    }
+
+    free(filas->pares);
+    filas->pares = novos;
+    filas->capacidade_pares = nova_capacidade;
+}
+
+/**
+ * Retira uma solicitação do conjunto de pares
+ */
+static void retirar_par(FilasPorTitulo* filas, NoFila* solicitacao) {
+    NoFila** ligacao = &filas->pares[solicitacao->hash_par % filas->capacidade_pares];
+
+    while (*ligacao != NULL) {
+        if (*ligacao == solicitacao) {
+            *ligacao = solicitacao->proximo_par;
+            filas->total_pares--;
+            break;
+        }
+        ligacao = &(*ligacao)->proximo_par;
+    }
+    solicitacao->proximo_par = NULL;
+}
+
+/**
+ * Busca a solicitação de um leitor para um título
+ */
+NoFila* filas_buscar_solicitacao(FilasPorTitulo* filas, const char* nome_leitor, const char* titulo) {
+    if (filas == NULL || nome_leitor == NULL || titulo == NULL ||
+        strlen(nome_leitor) >= MAX_NOME_LEITOR || strlen(titulo) >= MAX_TITULO) {
+        return NULL;
+    }
+
+    return procurar_par(filas, nome_leitor, titulo, hash_par(nome_leitor, titulo));
+}
+
+// =============================================================================
+// INSERÇÃO E REMOÇÃO DE SOLICITAÇÕES
+// =============================================================================
+
+/**
+ * Coloca uma solicitação na fila do seu título
+ */
+bool filas_adicionar(FilasPorTitulo* filas, NoFila* solicitacao) {
+    if (filas == NULL || solicitacao == NULL) {
+        return false;
+    }
+
+    char titulo_busca[MAX_TITULO];
+    para_minusculo(titulo_busca, solicitacao->dados.titulo_livro);
+
+    FilaTitulo* fila_titulo = procurar_fila(filas, titulo_busca);
+    if (fila_titulo == NULL) {
+        fila_titulo = criar_fila_titulo(filas, titulo_busca);
+        if (fila_titulo == NULL) {
+            printf("Erro: Falha ao alocar memória para a fila do título!\n");
+            return false;
+        }
+    }
+
+    if (fila_titulo->total == fila_titulo->capacidade) {
+        int nova_capacidade = fila_titulo->capacidade * 2;
+        NoFila** novo = (NoFila**)realloc(fila_titulo->heap, nova_capacidade * sizeof(NoFila*));
+        if (novo == NULL) {
+            printf("Erro: Falha ao alocar memória para a fila do título!\n");
+            if (fila_titulo->total == 0) {
+                descartar_fila_titulo(filas, fila_titulo);
+            }
+            return false;
+        }
+        fila_titulo->heap = novo;
+        fila_titulo->capacidade = nova_capacidade;
+    }
+
+    if (!ranking_reservar(&filas->demanda, fila_titulo->total + 1)) {
+        printf("Erro: Falha ao alocar memória para o ranking de filas!\n");
+        if (fila_titulo->total == 0) {
+            descartar_fila_titulo(filas, fila_titulo);
+        }
+        return false;
+    }
+
+    solicitacao->sequencia = filas->proxima_sequencia++;
+    solicitacao->fila_titulo = fila_titulo;
+    colocar_no_heap(fila_titulo, fila_titulo->total, solicitacao);
+    fila_titulo->total++;
+    subir(filas, fila_titulo, fila_titulo->total - 1);
+    ranking_incrementar(&filas->demanda, &fila_titulo->demanda);
+
+    // Registra o par (leitor, título) no conjunto
+    solicitacao->hash_par = hash_par(solicitacao->dados.nome_leitor, titulo_busca);
+    unsigned int balde = solicitacao->hash_par % filas->capacidade_pares;
+    solicitacao->proximo_par = filas->pares[balde];
+    filas->pares[balde] = solicitacao;
+    filas->total_pares++;
+
+    if (filas->total_pares > filas->capacidade_pares) {
+        redimensionar_pares(filas);
+    }
+
+    return true;
+}
+
+/**
+ * Retira uma solicitação da fila do seu título
+ */
+void filas_remover(FilasPorTitulo* filas, NoFila* solicitacao) {
+    if (filas == NULL || solicitacao == NULL || solicitacao->fila_titulo == NULL) return;
+
+    retirar_par(filas, solicitacao);
+
+    FilaTitulo* fila_titulo = solicitacao->fila_titulo;
+    int i = solicitacao->posicao_heap;
+    fila_titulo->total--;
+    ranking_decrementar(&filas->demanda, &fila_titulo->demanda);
+
+    if (i < fila_titulo->total) {
+        // O último elemento ocupa o lugar e é reposicionado
+        colocar_no_heap(fila_titulo, i, fila_titulo->heap[fila_titulo->total]);
+        subir(filas, fila_titulo, i);
+        descer(filas, fila_titulo, i);
+    }
+
+    solicitacao->fila_titulo = NULL;
+    solicitacao->posicao_heap = -1;
+
+    // Título sem ninguém aguardando sai da tabela
+    if (fila_titulo->total == 0) {
+        descartar_fila_titulo(filas, fila_titulo);
+    }
+}
+
+/**
+ * Reposiciona uma solicitação cuja classe de prioridade mudou
+ */
+void filas_reposicionar(FilasPorTitulo* filas, NoFila* solicitacao) {
+    if (filas == NULL || solicitacao == NULL || solicitacao->fila_titulo == NULL) return;
+
+    int i = solicitacao->posicao_heap;
+    subir(filas, solicitacao->fila_titulo, i);
+    descer(filas, solicitacao->fila_titulo, solicitacao->posicao_heap);
+}
+
+/**
+ * Consulta a próxima solicitação a ser atendida para um título
+ */
+NoFila* filas_proxima(FilasPorTitulo* filas, const char* titulo) {
+    FilaTitulo* fila_titulo = filas_buscar(filas, titulo);
+    if (fila_titulo == NULL) {
+        return NULL;
+    }
+    return fila_titulo->heap[0];
+}
+
+/**
+ * Calcula a posição de uma solicitação na fila do seu título
+ */
+int filas_posicao(FilasPorTitulo* filas, NoFila* solicitacao) {
+    if (filas == NULL || solicitacao == NULL || solicitacao->fila_titulo == NULL) {
+        return 0;
+    }
+    return 1 + contar_a_frente(filas, solicitacao->fila_titulo, 0, solicitacao);
+}
+
+/**
+ * Comparador para qsort: ordem de chegada
+ */
+static int comparar_chegada(const void* a, const void* b) {
+    long long sa = (*(NoFila* const*)a)->sequencia;
+    long long sb = (*(NoFila* const*)b)->sequencia;
+    return (sa > sb) - (sa < sb);
+}
+
+/**
+ * Comparador para qsort: classe de prioridade e depois ordem de chegada
+ */
+static int comparar_prioridade(const void* a, const void* b) {
+    NoFila* na = *(NoFila* const*)a;
+    NoFila* nb = *(NoFila* const*)b;
+    if (na->dados.prioridade != nb->dados.prioridade) {
+        return na->dados.prioridade < nb->dados.prioridade ? -1 : 1;
+    }
+    return comparar_chegada(a, b);
+}
+
+/**
+ * Copia as solicitações de um título na ordem de atendimento
+ */
+void filas_ordenar(FilasPorTitulo* filas, FilaTitulo* fila_titulo, NoFila** saida) {
+    if (filas == NULL || fila_titulo == NULL || saida == NULL) return;
+
+    memcpy(saida, fila_titulo->heap, fila_titulo->total * sizeof(NoFila*));
+    qsort(saida, fila_titulo->total, sizeof(NoFila*),
+          filas->modo_prioridade ? comparar_prioridade : comparar_chegada);
+}
+
+/**
+ * Liga ou desliga o modo de prioridade, reorganizando todas as filas
+ */
+void filas_definir_modo(FilasPorTitulo* filas, bool modo_prioridade) {
+    if (filas == NULL || filas->modo_prioridade == modo_prioridade) return;
+
+    filas->modo_prioridade = modo_prioridade;
+
+    // A ordem mudou: reconstrói cada heap de baixo para cima em O(n)
+    for (int b = 0; b < filas->capacidade; b++) {
+        FilaTitulo* fila_titulo = filas->baldes[b];
+        while (fila_titulo != NULL) {
+            for (int i = fila_titulo->total / 2 - 1; i >= 0; i--) {
+                descer(filas, fila_titulo, i);
+            }
+            fila_titulo = fila_titulo->proximo_balde;
+        }
+    }
+}
+
+/**
+ * Copia os títulos com mais leitores aguardando
+ */
+int filas_mais_disputadas(FilasPorTitulo* filas, FilaTitulo** saida, int max) {
+    if (filas == NULL || saida == NULL || max <= 0) {
+        return 0;
+    }
+    return ranking_maiores(&filas->demanda, (void**)saida, max);
+}
+
+/**
+ * Libera toda a memória da tabela de filas
+ */
+void liberar_filas_por_titulo(FilasPorTitulo* filas) {
+    if (filas == NULL) return;
+
+    for (int b = 0; b < filas->capacidade; b++) {
+        FilaTitulo* atual = filas->baldes[b];
+        while (atual != NULL) {
+            FilaTitulo* proximo = atual->proximo_balde;
+            free(atual->heap);
+            free(atual);
+            atual = proximo;
+        }
+    }
+
+    ranking_liberar(&filas->demanda);
+    free(filas->baldes);
+    free(filas->pares);
+    free(filas);
+}
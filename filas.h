@@ -0,0 +1,167 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: filas.h
+ * Descrição: Filas de espera separadas por título (heap por prioridade e ordem de chegada)
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef FILAS_H
+#define FILAS_H
+
+#include "biblioteca.h"
+#include "analises.h"
+
+// =============================================================================
+// CONSTANTES DAS FILAS POR TÍTULO
+// =============================================================================
+
+#define CAPACIDADE_INICIAL_FILAS 64     // Baldes iniciais da tabela de títulos
+#define CAPACIDADE_INICIAL_HEAP_FILA 4  // Posições iniciais do heap de cada título
+#define CAPACIDADE_INICIAL_PARES 64     // Baldes iniciais do conjunto (leitor, título)
+
+// =============================================================================
+// FILA DE UM TÍTULO (HEAP BINÁRIO)
+// =============================================================================
+
+/**
+ * Solicitações de um mesmo título, em um heap mínimo pela chave
+ * (classe de prioridade, ordem de chegada). No modo FIFO a classe é ignorada
+ * e a chave é só a ordem de chegada. Cada nó guarda sua posição no heap.
+ */
+typedef struct FilaTitulo {
+    char titulo_busca[MAX_TITULO];      // Título em minúsculas (chave da tabela)
+    NoFila** heap;                      // Heap mínimo de solicitações
+    int total;                          // Solicitações no heap
+    int capacidade;                     // Capacidade do vetor do heap
+    struct FilaTitulo* proximo_balde;   // Próximo título no mesmo balde
+    ItemRanking demanda;                // Posição no ranking de títulos por total
+} FilaTitulo;
+
+/**
+ * Tabela hash de títulos com uma fila (heap) para cada um
+ * Guarda também o conjunto de pares (leitor, título) já na fila: cada solicitação
+ * fica encadeada no balde do seu par (NoFila.proximo_par), então detectar uma
+ * solicitação repetida ou achar a de um leitor custa O(1).
+ */
+typedef struct FilasPorTitulo {
+    FilaTitulo** baldes;        // Tabela indexada pelo título em minúsculas
+    int capacidade;             // Número de baldes
+    int total_titulos;          // Títulos com alguém aguardando
+    bool modo_prioridade;       // true = ordena por classe e depois por chegada
+    long long proxima_sequencia; // Ordem de chegada da próxima solicitação
+    NoFila** pares;             // Conjunto de pares (leitor, título) em minúsculas
+    int capacidade_pares;       // Número de baldes do conjunto
+    int total_pares;            // Solicitações no conjunto
+    RankingContagem demanda;    // Títulos por quantidade de leitores aguardando
+} FilasPorTitulo;
+
+/**
+ * Cria a tabela de filas por título (começa no modo FIFO)
+ * Retorna: Ponteiro para a tabela criada, ou NULL em caso de erro
+ */
+FilasPorTitulo* criar_filas_por_titulo();
+
+/**
+ * Busca a fila de um título
+ * Parâmetros:
+ *   - filas: Ponteiro para a tabela
+ *   - titulo: Título do livro (qualquer capitalização)
+ * Retorna: Ponteiro para a fila do título, ou NULL se ninguém aguarda por ele
+ */
+FilaTitulo* filas_buscar(FilasPorTitulo* filas, const char* titulo);
+
+/**
+ * Busca a solicitação de um leitor para um título (sem percorrer a fila)
+ * Parâmetros:
+ *   - filas: Ponteiro para a tabela
+ *   - nome_leitor: Nome do leitor (qualquer capitalização)
+ *   - titulo: Título do livro (qualquer capitalização)
+ * Retorna: Nó da solicitação, ou NULL se o leitor não aguarda este título
+ */
+NoFila* filas_buscar_solicitacao(FilasPorTitulo* filas, const char* nome_leitor, const char* titulo);
+
+/**
+ * Coloca uma solicitação na fila do seu título (dá a ela a próxima ordem de chegada)
+ * O chamador garante que o par (leitor, título) ainda não está na fila.
+ * Parâmetros:
+ *   - filas: Ponteiro para a tabela
+ *   - solicitacao: Nó da fila de espera (dados.prioridade já preenchido)
+ * Retorna: true se inserida, false se faltou memória
+ */
+bool filas_adicionar(FilasPorTitulo* filas, NoFila* solicitacao);
+
+/**
+ * Retira uma solicitação da fila do seu título
+ * Parâmetros:
+ *   - filas: Ponteiro para a tabela
+ *   - solicitacao: Nó da fila de espera
+ */
+void filas_remover(FilasPorTitulo* filas, NoFila* solicitacao);
+
+/**
+ * Reposiciona uma solicitação cuja classe de prioridade mudou
+ * Parâmetros:
+ *   - filas: Ponteiro para a tabela
+ *   - solicitacao: Nó da fila de espera (dados.prioridade já atualizado)
+ */
+void filas_reposicionar(FilasPorTitulo* filas, NoFila* solicitacao);
+
+/**
+ * Consulta a próxima solicitação a ser atendida para um título
+ * Parâmetros:
+ *   - filas: Ponteiro para a tabela
+ *   - titulo: Título do livro
+ * Retorna: Nó da melhor solicitação, ou NULL se ninguém aguarda
+ */
+NoFila* filas_proxima(FilasPorTitulo* filas, const char* titulo);
+
+/**
+ * Calcula a posição de uma solicitação na fila do seu título
+ * Só visita as solicitações que estão à frente dela.
+ * Parâmetros:
+ *   - filas: Ponteiro para a tabela
+ *   - solicitacao: Nó da fila de espera
+ * Retorna: Posição (1 = próxima a ser atendida)
+ */
+int filas_posicao(FilasPorTitulo* filas, NoFila* solicitacao);
+
+/**
+ * Copia as solicitações de um título na ordem de atendimento
+ * Parâmetros:
+ *   - filas: Ponteiro para a tabela
+ *   - fila_titulo: Fila do título
+ *   - saida: Vetor com espaço para fila_titulo->total solicitações
+ */
+void filas_ordenar(FilasPorTitulo* filas, FilaTitulo* fila_titulo, NoFila** saida);
+
+/**
+ * Copia os títulos com mais leitores aguardando, do mais para o menos disputado
+ * Custa O(max): o ranking é atualizado a cada solicitação que entra ou sai.
+ * Parâmetros:
+ *   - filas: Ponteiro para a tabela
+ *   - saida: Vetor que receberá as filas dos títulos
+ *   - max: Tamanho do vetor
+ * Retorna: Quantidade de títulos copiados
+ */
+int filas_mais_disputadas(FilasPorTitulo* filas, FilaTitulo** saida, int max);
+
+/**
+ * Liga ou desliga o modo de prioridade, reorganizando todas as filas
+ * Parâmetros:
+ *   - filas: Ponteiro para a tabela
+ *   - modo_prioridade: true = classe de prioridade primeiro, false = FIFO
+ */
+void filas_definir_modo(FilasPorTitulo* filas, bool modo_prioridade);
+
+/**
+ * Libera toda a memória da tabela (os nós da fila não são liberados)
+ * Parâmetros:
+ *   - filas: Ponteiro para a tabela a ser liberada
+ */
+void liberar_filas_por_titulo(FilasPorTitulo* filas);
+
+#endif // FILAS_H
@@ -0,0 +1,772 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: historico.c
+ * Descrição: Implementação do armazenamento compacto do histórico de operações
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#include "historico.h"
+#include "textos.h"
+
+// Nome de cada código de operação (mesma ordem das constantes OPERACAO_*)
+static const char* NOMES_OPERACOES[TOTAL_TIPOS_OPERACAO] = { "EMPRESTIMO", "DEVOLUCAO" };
+
+// =============================================================================
+// DICIONÁRIO DE NOMES
+// =============================================================================
+
+/**
+ * Prepara um dicionário vazio
+ */
+static bool iniciar_dicionario(DicionarioNomes* dicionario) {
+    dicionario->nomes = (char**)malloc(CAPACIDADE_INICIAL_NOMES * sizeof(char*));
+    dicionario->tabela = (int*)calloc(CAPACIDADE_INICIAL_NOMES * 2, sizeof(int));
+    dicionario->total = 0;
+    dicionario->capacidade = CAPACIDADE_INICIAL_NOMES;
+    dicionario->tamanho_tabela = CAPACIDADE_INICIAL_NOMES * 2;
+
+    if (dicionario->nomes == NULL || dicionario->tabela == NULL) {
+        free(dicionario->nomes);
+        free(dicionario->tabela);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Procura o id de um texto
+ * Retorna: Id do texto, ou -1 se ele ainda não está no dicionário
+ */
+static int buscar_id(const DicionarioNomes* dicionario, const char* nome) {
+    unsigned int mascara = (unsigned int)dicionario->tamanho_tabela - 1;
+    unsigned int posicao = calcular_hash(nome) & mascara;
+
+    while (dicionario->tabela[posicao] != 0) {
+        int id = dicionario->tabela[posicao] - 1;
+        if (strcmp(dicionario->nomes[id], nome) == 0) {
+            return id;
+        }
+        posicao = (posicao + 1) & mascara;
+    }
+
+    return -1;
+}
+
+/**
+ * Coloca um id na tabela hash (a tabela tem posições livres)
+ */
+static void inserir_na_tabela(int* tabela, int tamanho, const char* nome, int id) {
+    unsigned int mascara = (unsigned int)tamanho - 1;
+    unsigned int posicao = calcular_hash(nome) & mascara;
+
+    while (tabela[posicao] != 0) {
+        posicao = (posicao + 1) & mascara;
+    }
+    tabela[posicao] = id + 1;
+}
+
+/**
+ * Dobra o vetor de nomes e a tabela hash (a tabela fica no máximo meio cheia)
+ */
+static bool crescer_dicionario(DicionarioNomes* dicionario) {
+    int nova_capacidade = dicionario->capacidade * 2;
+
+    char** nomes = (char**)realloc(dicionario->nomes, nova_capacidade * sizeof(char*));
+    if (nomes == NULL) {
+        return false;
+    }
+    dicionario->nomes = nomes;
+
+    int novo_tamanho = nova_capacidade * 2;
+    int* tabela = (int*)calloc(novo_tamanho, sizeof(int));
+    if (tabela == NULL) {
+        return false;
+    }
+
+    for (int id = 0; id < dicionario->total; id++) {
+        inserir_na_tabela(tabela, novo_tamanho, dicionario->nomes[id], id);
+    }
+
+    free(dicionario->tabela);
+    dicionario->tabela = tabela;
+    dicionario->tamanho_tabela = novo_tamanho;
+    dicionario->capacidade = nova_capacidade;
+    return true;
+}
+
+/**
+ * Retorna o id de um texto, cadastrando-o se for novo
+ * Retorna: Id do texto, ou -1 se faltou memória
+ */
+static int obter_id(DicionarioNomes* dicionario, const char* nome) {
+    int id = buscar_id(dicionario, nome);
+    if (id >= 0) {
+        return id;
+    }
+
+    if (dicionario->total == dicionario->capacidade && !crescer_dicionario(dicionario)) {
+        return -1;
+    }
+
+    char* copia = (char*)malloc(strlen(nome) + 1);
+    if (copia == NULL) {
+        return -1;
+    }
+    strcpy(copia, nome);
+
+    id = dicionario->total++;
+    dicionario->nomes[id] = copia;
+    inserir_na_tabela(dicionario->tabela, dicionario->tamanho_tabela, copia, id);
+    return id;
+}
+
+/**
+ * Libera os textos e as tabelas de um dicionário
+ */
+static void liberar_dicionario(DicionarioNomes* dicionario) {
+    for (int id = 0; id < dicionario->total; id++) {
+        free(dicionario->nomes[id]);
+    }
+    free(dicionario->nomes);
+    free(dicionario->tabela);
+}
+
+// =============================================================================
+// REGISTROS COMPACTOS
+// =============================================================================
+
+/**
+ * Cria um armazenamento de registros vazio
+ */
+RegistrosHistorico* criar_registros_historico() {
+    RegistrosHistorico* registros = (RegistrosHistorico*)malloc(sizeof(RegistrosHistorico));
+    if (registros == NULL) {
+        return NULL;
+    }
+
+    registros->blocos = (BlocoHistorico**)malloc(CAPACIDADE_INICIAL_BLOCOS * sizeof(BlocoHistorico*));
+    registros->total_blocos = 0;
+    registros->capacidade_blocos = CAPACIDADE_INICIAL_BLOCOS;
+    registros->primeiro_bloco = 0;
+    registros->total = 0;
+    registros->ultima_data = 0;
+    registros->segmentos = NULL;
+    registros->total_segmentos = 0;
+    registros->capacidade_segmentos = 0;
+    registros->prefixo[0] = '\0';
+    registros->arquivando = false;
+    registros->blocos_em_memoria = 0;
+    registros->cache = NULL;
+    registros->segmento_em_cache = -1;
+
+    if (registros->blocos == NULL) {
+        free(registros);
+        return NULL;
+    }
+    if (!iniciar_dicionario(&registros->titulos)) {
+        free(registros->blocos);
+        free(registros);
+        return NULL;
+    }
+    if (!iniciar_dicionario(&registros->leitores)) {
+        liberar_dicionario(&registros->titulos);
+        free(registros->blocos);
+        free(registros);
+        return NULL;
+    }
+
+    return registros;
+}
+
+/**
+ * Converte o nome de um tipo de operação para o seu código
+ */
+int codigo_tipo_operacao(const char* tipo_operacao) {
+    for (int tipo = 0; tipo < TOTAL_TIPOS_OPERACAO; tipo++) {
+        if (strcmp(NOMES_OPERACOES[tipo], tipo_operacao) == 0) {
+            return tipo;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Aloca os blocos em memória que faltam para caber mais registros
+ */
+static bool reservar_blocos(RegistrosHistorico* registros, int extra) {
+    int necessarios = (registros->total + extra + REGISTROS_POR_BLOCO - 1) / REGISTROS_POR_BLOCO
+                      - registros->primeiro_bloco;
+
+    if (necessarios > registros->capacidade_blocos) {
+        int nova_capacidade = registros->capacidade_blocos * 2;
+        while (nova_capacidade < necessarios) {
+            nova_capacidade *= 2;
+        }
+
+        BlocoHistorico** blocos = (BlocoHistorico**)realloc(registros->blocos,
+                                                           nova_capacidade * sizeof(BlocoHistorico*));
+        if (blocos == NULL) {
+            return false;
+        }
+        registros->blocos = blocos;
+        registros->capacidade_blocos = nova_capacidade;
+    }
+
+    // Blocos já alocados e ainda vazios ficam para as próximas gravações
+    while (registros->total_blocos < necessarios) {
+        BlocoHistorico* bloco = (BlocoHistorico*)malloc(sizeof(BlocoHistorico));
+        if (bloco == NULL) {
+            return false;
+        }
+        registros->blocos[registros->total_blocos++] = bloco;
+    }
+
+    return true;
+}
+
+static void arquivar_blocos_antigos(RegistrosHistorico* registros);
+
+/**
+ * Grava um bloco de operações no fim do histórico
+ */
+bool registros_adicionar(RegistrosHistorico* registros, const Operacao* operacoes, int total,
+                         time_t data) {
+    if (registros == NULL || operacoes == NULL || total <= 0) {
+        return total == 0;
+    }
+
+    // Primeira passada: valida os tipos e cadastra os nomes novos nos dicionários
+    for (int i = 0; i < total; i++) {
+        if (codigo_tipo_operacao(operacoes[i].tipo_operacao) < 0 ||
+            obter_id(&registros->titulos, operacoes[i].titulo_livro) < 0 ||
+            obter_id(&registros->leitores, operacoes[i].nome_leitor) < 0) {
+            return false;
+        }
+    }
+
+    if (!reservar_blocos(registros, total)) {
+        return false;
+    }
+
+    // Mantém os horários em ordem mesmo se o chamador mandar um anterior
+    if (registros->total > 0 && data < registros->ultima_data) {
+        data = registros->ultima_data;
+    }
+
+    // Segunda passada: nada mais pode falhar
+    for (int i = 0; i < total; i++) {
+        int posicao = registros->total;
+        BlocoHistorico* bloco = registros->blocos[posicao / REGISTROS_POR_BLOCO - registros->primeiro_bloco];
+        RegistroHistorico* registro = &bloco->registros[posicao % REGISTROS_POR_BLOCO];
+
+        if (posicao % REGISTROS_POR_BLOCO == 0) {
+            bloco->base = data;
+        }
+
+        registro->livro = (uint32_t)buscar_id(&registros->titulos, operacoes[i].titulo_livro);
+        registro->leitor = (uint32_t)buscar_id(&registros->leitores, operacoes[i].nome_leitor);
+        registro->delta = (uint32_t)(data - bloco->base);
+        registro->tipo = (uint8_t)codigo_tipo_operacao(operacoes[i].tipo_operacao);
+
+        registros->ultima_data = data;
+        registros->total++;
+    }
+
+    if (registros->arquivando) {
+        arquivar_blocos_antigos(registros);
+    }
+
+    return true;
+}
+
+/**
+ * Horário do primeiro registro de um bloco (em memória ou arquivado), sem ler arquivos
+ */
+static time_t base_do_bloco(const RegistrosHistorico* registros, int indice) {
+    if (indice >= registros->primeiro_bloco) {
+        return registros->blocos[indice - registros->primeiro_bloco]->base;
+    }
+    return registros->segmentos[indice / BLOCOS_POR_SEGMENTO].bases[indice % BLOCOS_POR_SEGMENTO];
+}
+
+static bool carregar_segmento(RegistrosHistorico* registros, int segmento);
+
+/**
+ * Bloco com um índice global: em memória ou lido do arquivo do seu segmento
+ * Retorna: Ponteiro para o bloco, ou NULL se o arquivo não pôde ser lido
+ */
+static const BlocoHistorico* obter_bloco(RegistrosHistorico* registros, int indice) {
+    if (indice >= registros->primeiro_bloco) {
+        return registros->blocos[indice - registros->primeiro_bloco];
+    }
+
+    int segmento = indice / BLOCOS_POR_SEGMENTO;
+    if (registros->segmento_em_cache != segmento && !carregar_segmento(registros, segmento)) {
+        return NULL;
+    }
+    return &registros->cache[indice % BLOCOS_POR_SEGMENTO];
+}
+
+/**
+ * Acessa o registro codificado de uma posição
+ */
+const RegistroHistorico* registros_obter(RegistrosHistorico* registros, int posicao) {
+    const BlocoHistorico* bloco = obter_bloco(registros, posicao / REGISTROS_POR_BLOCO);
+    if (bloco == NULL) {
+        return NULL;
+    }
+    return &bloco->registros[posicao % REGISTROS_POR_BLOCO];
+}
+
+/**
+ * Decodifica a operação de uma posição
+ */
+bool registros_ler(RegistrosHistorico* registros, int posicao, Operacao* saida) {
+    const BlocoHistorico* bloco = obter_bloco(registros, posicao / REGISTROS_POR_BLOCO);
+    if (bloco == NULL) {
+        return false;
+    }
+
+    const RegistroHistorico* registro = &bloco->registros[posicao % REGISTROS_POR_BLOCO];
+    strcpy(saida->tipo_operacao, NOMES_OPERACOES[registro->tipo]);
+    strcpy(saida->titulo_livro, registros->titulos.nomes[registro->livro]);
+    strcpy(saida->nome_leitor, registros->leitores.nomes[registro->leitor]);
+    saida->data_operacao = bloco->base + (time_t)registro->delta;
+    return true;
+}
+
+/**
+ * Primeira posição com horário maior ou igual a um instante
+ */
+int registros_primeira_desde(RegistrosHistorico* registros, time_t instante) {
+    if (registros == NULL || registros->total == 0) {
+        return 0;
+    }
+
+    // Busca binária nas bases (as dos blocos arquivados estão no índice dos segmentos)
+    int usados = (registros->total + REGISTROS_POR_BLOCO - 1) / REGISTROS_POR_BLOCO;
+    int inicio = 0;
+    int fim = usados;
+
+    while (inicio < fim) {
+        int meio = inicio + (fim - inicio) / 2;
+        if (base_do_bloco(registros, meio) < instante) {
+            inicio = meio + 1;
+        } else {
+            fim = meio;
+        }
+    }
+
+    if (inicio == 0) {
+        return 0;
+    }
+
+    // A resposta está no bloco anterior ou é o início do bloco encontrado
+    int indice = inicio - 1;
+    int primeira = indice * REGISTROS_POR_BLOCO;
+    int depois = primeira + REGISTROS_POR_BLOCO;
+    if (depois > registros->total) {
+        depois = registros->total;
+    }
+
+    // Se o instante é depois do fim do segmento, nem é preciso ler o arquivo
+    if (indice < registros->primeiro_bloco &&
+        registros->segmentos[indice / BLOCOS_POR_SEGMENTO].data_final < instante) {
+        return depois;
+    }
+
+    const BlocoHistorico* bloco = obter_bloco(registros, indice);
+    if (bloco == NULL) {
+        return depois;
+    }
+
+    uint32_t delta = (uint32_t)(instante - bloco->base);
+    int baixo = 0;
+    int alto = depois - primeira;
+
+    while (baixo < alto) {
+        int meio = baixo + (alto - baixo) / 2;
+        if (bloco->registros[meio].delta < delta) {
+            baixo = meio + 1;
+        } else {
+            alto = meio;
+        }
+    }
+
+    return primeira + baixo;
+}
+
+/**
+ * Marca os ids de títulos iguais a um título, ignorando maiúsculas/minúsculas
+ */
+bool* registros_marcar_titulo(const RegistrosHistorico* registros, const char* titulo) {
+    if (registros == NULL || titulo == NULL || registros->titulos.total == 0) {
+        return NULL;
+    }
+
+    bool* marcas = (bool*)calloc(registros->titulos.total, sizeof(bool));
+    if (marcas == NULL) {
+        return NULL;
+    }
+
+    // Cada título distinto é comparado uma vez, não uma vez por registro
+    bool algum = false;
+    for (int id = 0; id < registros->titulos.total; id++) {
+        if (iguais_sem_caixa(registros->titulos.nomes[id], titulo)) {
+            marcas[id] = true;
+            algum = true;
+        }
+    }
+
+    if (!algum) {
+        free(marcas);
+        return NULL;
+    }
+    return marcas;
+}
+
+/**
+ * Verifica se algum dos títulos marcados aparece em um segmento (busca no índice)
+ */
+static bool segmento_tem_titulo(const SegmentoHistorico* segmento, const bool* marcas, int total_marcas) {
+    for (int id = 0; id < total_marcas; id++) {
+        if (!marcas[id]) continue;
+
+        int inicio = 0;
+        int fim = segmento->total_livros;
+        while (inicio < fim) {
+            int meio = inicio + (fim - inicio) / 2;
+            if (segmento->livros[meio] < (uint32_t)id) {
+                inicio = meio + 1;
+            } else {
+                fim = meio;
+            }
+        }
+        if (inicio < segmento->total_livros && segmento->livros[inicio] == (uint32_t)id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Posição mais recente, até uma posição dada, de uma operação com título marcado
+ */
+int registros_anterior_com_titulo(RegistrosHistorico* registros, const bool* marcas, int posicao) {
+    if (registros == NULL || marcas == NULL) {
+        return -1;
+    }
+
+    while (posicao >= 0) {
+        int indice = posicao / REGISTROS_POR_BLOCO;
+
+        // Segmento arquivado sem nenhum dos títulos: pula o arquivo inteiro
+        if (indice < registros->primeiro_bloco) {
+            int segmento = indice / BLOCOS_POR_SEGMENTO;
+            if (!segmento_tem_titulo(&registros->segmentos[segmento], marcas, registros->titulos.total)) {
+                posicao = segmento * BLOCOS_POR_SEGMENTO * REGISTROS_POR_BLOCO - 1;
+                continue;
+            }
+        }
+
+        const BlocoHistorico* bloco = obter_bloco(registros, indice);
+        if (bloco == NULL) {
+            return -1;
+        }
+
+        int primeira = indice * REGISTROS_POR_BLOCO;
+        for (; posicao >= primeira; posicao--) {
+            if (marcas[bloco->registros[posicao - primeira].livro]) {
+                return posicao;
+            }
+        }
+    }
+
+    return -1;
+}
+
+// =============================================================================
+// ARQUIVAMENTO EM DISCO
+// =============================================================================
+
+/**
+ * Grava um inteiro em formato varint (7 bits por byte, bit alto = continua)
+ */
+static void escrever_varint(FILE* arquivo, uint32_t valor) {
+    while (valor >= 0x80) {
+        putc((int)((valor & 0x7F) | 0x80), arquivo);
+        valor >>= 7;
+    }
+    putc((int)valor, arquivo);
+}
+
+/**
+ * Lê um inteiro em formato varint
+ */
+static bool ler_varint(FILE* arquivo, uint32_t* valor) {
+    uint32_t resultado = 0;
+
+    for (int deslocamento = 0; deslocamento < 35; deslocamento += 7) {
+        int byte = getc(arquivo);
+        if (byte == EOF) {
+            return false;
+        }
+        resultado |= (uint32_t)(byte & 0x7F) << deslocamento;
+        if ((byte & 0x80) == 0) {
+            *valor = resultado;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Compara dois ids (para qsort)
+ */
+static int comparar_ids(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Monta o índice de títulos de um segmento: ids distintos em ordem crescente
+ */
+static bool indexar_titulos(SegmentoHistorico* segmento, BlocoHistorico** blocos) {
+    int total = BLOCOS_POR_SEGMENTO * REGISTROS_POR_BLOCO;
+    uint32_t* ids = (uint32_t*)malloc(total * sizeof(uint32_t));
+    if (ids == NULL) {
+        return false;
+    }
+
+    for (int i = 0; i < total; i++) {
+        ids[i] = blocos[i / REGISTROS_POR_BLOCO]->registros[i % REGISTROS_POR_BLOCO].livro;
+    }
+    qsort(ids, total, sizeof(uint32_t), comparar_ids);
+
+    int distintos = 0;
+    for (int i = 0; i < total; i++) {
+        if (distintos == 0 || ids[distintos - 1] != ids[i]) {
+            ids[distintos++] = ids[i];
+        }
+    }
+
+    uint32_t* livros = (uint32_t*)realloc(ids, distintos * sizeof(uint32_t));
+    segmento->livros = (livros != NULL) ? livros : ids;
+    segmento->total_livros = distintos;
+    return true;
+}
+
+/**
+ * Grava um segmento: cabeçalho com o índice e os registros compactados
+ * Cada registro vira tipo (1 byte) + varints da diferença de horário para o
+ * registro anterior do bloco e dos ids do título e do leitor.
+ */
+static bool gravar_segmento(const SegmentoHistorico* segmento, BlocoHistorico** blocos) {
+    FILE* arquivo = fopen(segmento->caminho, "wb");
+    if (arquivo == NULL) {
+        return false;
+    }
+
+    uint32_t total_livros = (uint32_t)segmento->total_livros;
+    fwrite(MARCA_SEGMENTO, 1, 4, arquivo);
+    fwrite(&segmento->data_inicial, sizeof(time_t), 1, arquivo);
+    fwrite(&segmento->data_final, sizeof(time_t), 1, arquivo);
+    fwrite(segmento->bases, sizeof(time_t), BLOCOS_POR_SEGMENTO, arquivo);
+    fwrite(&total_livros, sizeof(uint32_t), 1, arquivo);
+    fwrite(segmento->livros, sizeof(uint32_t), total_livros, arquivo);
+
+    for (int b = 0; b < BLOCOS_POR_SEGMENTO; b++) {
+        uint32_t anterior = 0;
+        for (int r = 0; r < REGISTROS_POR_BLOCO; r++) {
+            const RegistroHistorico* registro = &blocos[b]->registros[r];
+            putc(registro->tipo, arquivo);
+            escrever_varint(arquivo, registro->delta - anterior);
+            escrever_varint(arquivo, registro->livro);
+            escrever_varint(arquivo, registro->leitor);
+            anterior = registro->delta;
+        }
+    }
+
+    bool ok = !ferror(arquivo);
+    if (fclose(arquivo) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        remove(segmento->caminho);
+    }
+    return ok;
+}
+
+/**
+ * Lê um segmento arquivado para o cache (lendo o arquivo em sequência)
+ */
+static bool carregar_segmento(RegistrosHistorico* registros, int segmento) {
+    if (registros->cache == NULL) {
+        registros->cache = (BlocoHistorico*)malloc(BLOCOS_POR_SEGMENTO * sizeof(BlocoHistorico));
+        if (registros->cache == NULL) {
+            printf("Erro: Falha ao alocar memória para o histórico arquivado!\n");
+            return false;
+        }
+    }
+
+    const SegmentoHistorico* indice = &registros->segmentos[segmento];
+    FILE* arquivo = fopen(indice->caminho, "rb");
+    if (arquivo == NULL) {
+        printf("Erro: Não foi possível abrir o arquivo de histórico %s!\n", indice->caminho);
+        return false;
+    }
+
+    // Pula o cabeçalho: o índice já está em memória
+    char marca[4];
+    long cabecalho = (long)(2 * sizeof(time_t) + BLOCOS_POR_SEGMENTO * sizeof(time_t) +
+                            sizeof(uint32_t) + indice->total_livros * sizeof(uint32_t));
+    bool ok = fread(marca, 1, 4, arquivo) == 4 && memcmp(marca, MARCA_SEGMENTO, 4) == 0 &&
+              fseek(arquivo, cabecalho, SEEK_CUR) == 0;
+
+    registros->segmento_em_cache = -1;
+    for (int b = 0; ok && b < BLOCOS_POR_SEGMENTO; b++) {
+        BlocoHistorico* bloco = &registros->cache[b];
+        uint32_t delta = 0;
+        bloco->base = indice->bases[b];
+
+        for (int r = 0; ok && r < REGISTROS_POR_BLOCO; r++) {
+            RegistroHistorico* registro = &bloco->registros[r];
+            uint32_t diferenca = 0;
+            int tipo = getc(arquivo);
+
+            ok = tipo != EOF && tipo < TOTAL_TIPOS_OPERACAO &&
+                 ler_varint(arquivo, &diferenca) &&
+                 ler_varint(arquivo, &registro->livro) &&
+                 ler_varint(arquivo, &registro->leitor) &&
+                 registro->livro < (uint32_t)registros->titulos.total &&
+                 registro->leitor < (uint32_t)registros->leitores.total;
+            if (!ok) {
+                break; // O segmento inteiro é descartado abaixo
+            }
+
+            delta += diferenca;
+            registro->delta = delta;
+            registro->tipo = (uint8_t)tipo;
+        }
+    }
+
+    fclose(arquivo);
+    if (!ok) {
+        printf("Erro: Arquivo de histórico %s corrompido!\n", indice->caminho);
+        return false;
+    }
+
+    registros->segmento_em_cache = segmento;
+    return true;
+}
+
+/**
+ * Sela os blocos mais antigos em memória em um novo segmento arquivado
+ */
+static bool selar_segmento(RegistrosHistorico* registros) {
+    if (registros->total_segmentos == registros->capacidade_segmentos) {
+        int nova_capacidade = registros->capacidade_segmentos > 0 ? registros->capacidade_segmentos * 2 : 8;
+        SegmentoHistorico* segmentos = (SegmentoHistorico*)realloc(registros->segmentos,
+                                                                   nova_capacidade * sizeof(SegmentoHistorico));
+        if (segmentos == NULL) {
+            return false;
+        }
+        registros->segmentos = segmentos;
+        registros->capacidade_segmentos = nova_capacidade;
+    }
+
+    BlocoHistorico** blocos = registros->blocos;
+    SegmentoHistorico* segmento = &registros->segmentos[registros->total_segmentos];
+
+    snprintf(segmento->caminho, sizeof(segmento->caminho), "%s_%06d.seg",
+             registros->prefixo, registros->total_segmentos);
+    for (int b = 0; b < BLOCOS_POR_SEGMENTO; b++) {
+        segmento->bases[b] = blocos[b]->base;
+    }
+    segmento->data_inicial = blocos[0]->base;
+    segmento->data_final = blocos[BLOCOS_POR_SEGMENTO - 1]->base +
+                           (time_t)blocos[BLOCOS_POR_SEGMENTO - 1]->registros[REGISTROS_POR_BLOCO - 1].delta;
+
+    if (!indexar_titulos(segmento, blocos)) {
+        return false;
+    }
+    if (!gravar_segmento(segmento, blocos)) {
+        free(segmento->livros);
+        return false;
+    }
+
+    // Os blocos gravados saem da memória; os demais sobem no vetor
+    for (int b = 0; b < BLOCOS_POR_SEGMENTO; b++) {
+        free(blocos[b]);
+    }
+    memmove(blocos, blocos + BLOCOS_POR_SEGMENTO,
+            (registros->total_blocos - BLOCOS_POR_SEGMENTO) * sizeof(BlocoHistorico*));
+    registros->total_blocos -= BLOCOS_POR_SEGMENTO;
+    registros->primeiro_bloco += BLOCOS_POR_SEGMENTO;
+    registros->total_segmentos++;
+    return true;
+}
+
+/**
+ * Sela segmentos enquanto houver mais blocos completos em memória que o limite
+ */
+static void arquivar_blocos_antigos(RegistrosHistorico* registros) {
+    int completos = registros->total / REGISTROS_POR_BLOCO - registros->primeiro_bloco;
+
+    while (completos >= registros->blocos_em_memoria + BLOCOS_POR_SEGMENTO) {
+        if (!selar_segmento(registros)) {
+            printf("Erro: Não foi possível gravar o histórico em %s_*.seg; arquivamento desativado!\n",
+                   registros->prefixo);
+            registros->arquivando = false;
+            return;
+        }
+        completos -= BLOCOS_POR_SEGMENTO;
+    }
+}
+
+/**
+ * Ativa o arquivamento dos registros antigos em arquivos
+ */
+bool registros_ativar_arquivamento(RegistrosHistorico* registros, const char* prefixo,
+                                   int registros_em_memoria) {
+    if (registros == NULL || prefixo == NULL || strlen(prefixo) == 0 ||
+        strlen(prefixo) >= sizeof(registros->prefixo) || registros_em_memoria < 0) {
+        return false;
+    }
+
+    strcpy(registros->prefixo, prefixo);
+    registros->blocos_em_memoria = (registros_em_memoria + REGISTROS_POR_BLOCO - 1) / REGISTROS_POR_BLOCO;
+    registros->arquivando = true;
+
+    arquivar_blocos_antigos(registros);
+    return registros->arquivando;
+}
+
+/**
+ * Libera toda a memória dos registros e dos dicionários
+ */
+void liberar_registros_historico(RegistrosHistorico* registros) {
+    if (registros == NULL) return;
+
+    for (int i = 0; i < registros->total_blocos; i++) {
+        free(registros->blocos[i]);
+    }
+    free(registros->blocos);
+
+    // Os arquivos só fazem sentido com os dicionários em memória: são apagados
+    for (int i = 0; i < registros->total_segmentos; i++) {
+        remove(registros->segmentos[i].caminho);
+        free(registros->segmentos[i].livros);
+    }
+    free(registros->segmentos);
+    free(registros->cache);
+
+    liberar_dicionario(&registros->titulos);
+    liberar_dicionario(&registros->leitores);
+    free(registros);
+}
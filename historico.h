@@ -0,0 +1,213 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: historico.h
+ * Descrição: Armazenamento compacto dos registros do histórico de operações
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef HISTORICO_H
+#define HISTORICO_H
+
+#include "biblioteca.h"
+
+// =============================================================================
+// CONSTANTES DO HISTÓRICO
+// =============================================================================
+
+#define OPERACAO_EMPRESTIMO 0           // Código de "EMPRESTIMO"
+#define OPERACAO_DEVOLUCAO 1            // Código de "DEVOLUCAO"
+#define TOTAL_TIPOS_OPERACAO 2          // Tipos de operação conhecidos
+#define REGISTROS_POR_BLOCO 256         // Registros em cada bloco do histórico
+#define CAPACIDADE_INICIAL_NOMES 64     // Posições iniciais de um dicionário de nomes
+#define CAPACIDADE_INICIAL_BLOCOS 4     // Posições iniciais do vetor de blocos
+#define BLOCOS_POR_SEGMENTO 16          // Blocos gravados em cada arquivo de histórico
+#define MAX_CAMINHO_SEGMENTO 260        // Tamanho máximo do caminho de um arquivo
+#define MARCA_SEGMENTO "HSEG"           // Primeiros 4 bytes de um arquivo de histórico
+
+// =============================================================================
+// DICIONÁRIO DE NOMES
+// =============================================================================
+
+/**
+ * Dicionário que dá um id a cada texto distinto (títulos ou nomes de leitores)
+ * Cada texto é guardado uma única vez; os registros guardam só o id de 32 bits.
+ * Os ids nunca mudam, então registros antigos continuam legíveis mesmo depois
+ * que o livro sai do catálogo.
+ */
+typedef struct DicionarioNomes {
+    char** nomes;               // Texto de cada id
+    int total;                  // Ids em uso
+    int capacidade;             // Capacidade do vetor de nomes
+    int* tabela;                // Hash com sondagem linear: id + 1 (0 = vazio)
+    int tamanho_tabela;         // Posições da tabela (potência de 2)
+} DicionarioNomes;
+
+// =============================================================================
+// REGISTROS COMPACTOS
+// =============================================================================
+
+/**
+ * Uma operação codificada em 16 bytes
+ * O horário é a diferença em segundos para o início do bloco (cabe 136 anos).
+ */
+typedef struct RegistroHistorico {
+    uint32_t livro;             // Id do título no dicionário de títulos
+    uint32_t leitor;            // Id do nome no dicionário de leitores
+    uint32_t delta;             // Segundos desde a base do bloco
+    uint8_t tipo;               // OPERACAO_EMPRESTIMO ou OPERACAO_DEVOLUCAO
+} RegistroHistorico;
+
+/**
+ * Bloco de registros consecutivos com o horário absoluto do primeiro
+ * As bases dos blocos formam um índice esparso: a busca por horário faz uma
+ * busca binária nas bases e outra dentro do bloco.
+ */
+typedef struct BlocoHistorico {
+    time_t base;                // Horário do primeiro registro do bloco
+    RegistroHistorico registros[REGISTROS_POR_BLOCO];
+} BlocoHistorico;
+
+/**
+ * Índice de um segmento arquivado (BLOCOS_POR_SEGMENTO blocos completos)
+ * O arquivo é imutável: cabeçalho com este índice e depois os registros
+ * compactados (tipo em 1 byte e varints da diferença de horário e dos ids).
+ * O índice fica em memória, então buscas por horário e por título só abrem
+ * os arquivos que podem conter a resposta.
+ */
+typedef struct SegmentoHistorico {
+    char caminho[MAX_CAMINHO_SEGMENTO];     // Arquivo do segmento
+    time_t data_inicial;                    // Horário do primeiro registro
+    time_t data_final;                      // Horário do último registro
+    time_t bases[BLOCOS_POR_SEGMENTO];      // Base de cada bloco (busca binária sem ler o arquivo)
+    uint32_t* livros;                       // Ids de títulos presentes, em ordem crescente
+    int total_livros;                       // Quantidade de ids em livros
+} SegmentoHistorico;
+
+/**
+ * Todos os registros do histórico, do mais antigo (posição 0) ao mais recente
+ * Com o arquivamento ativo, os blocos mais antigos são selados em segmentos
+ * gravados em disco e só os mais recentes ficam em memória. Um segmento lido
+ * fica em cache, então percorrer o histórico em ordem lê cada arquivo uma vez.
+ */
+typedef struct RegistrosHistorico {
+    BlocoHistorico** blocos;    // Blocos em memória, em ordem (os do fim podem estar vazios)
+    int total_blocos;           // Blocos alocados em memória
+    int capacidade_blocos;      // Capacidade do vetor de blocos
+    int primeiro_bloco;         // Índice global do primeiro bloco em memória
+    int total;                  // Registros gravados (em memória e em disco)
+    time_t ultima_data;         // Horário do registro mais recente
+    DicionarioNomes titulos;    // Ids dos títulos
+    DicionarioNomes leitores;   // Ids dos nomes de leitores
+    SegmentoHistorico* segmentos;   // Índices dos segmentos arquivados, em ordem
+    int total_segmentos;            // Segmentos arquivados
+    int capacidade_segmentos;       // Capacidade do vetor de segmentos
+    char prefixo[MAX_CAMINHO_SEGMENTO - 16]; // Prefixo dos arquivos (prefixo_000000.seg, ...)
+    bool arquivando;                // Arquivamento ativo
+    int blocos_em_memoria;          // Blocos completos mantidos em memória
+    BlocoHistorico* cache;          // Blocos do último segmento lido
+    int segmento_em_cache;          // Segmento no cache (-1 = nenhum)
+} RegistrosHistorico;
+
+/**
+ * Cria um armazenamento de registros vazio
+ * Retorna: Ponteiro para o armazenamento criado, ou NULL em caso de erro
+ */
+RegistrosHistorico* criar_registros_historico();
+
+/**
+ * Converte o nome de um tipo de operação para o seu código
+ * Parâmetros:
+ *   - tipo_operacao: "EMPRESTIMO" ou "DEVOLUCAO"
+ * Retorna: OPERACAO_EMPRESTIMO, OPERACAO_DEVOLUCAO ou -1 se o tipo é desconhecido
+ */
+int codigo_tipo_operacao(const char* tipo_operacao);
+
+/**
+ * Grava um bloco de operações no fim do histórico, todas com o mesmo horário
+ * Ou todas são gravadas ou nenhuma (os ids são obtidos e os blocos alocados antes).
+ * Parâmetros:
+ *   - registros: Ponteiro para o armazenamento
+ *   - operacoes: Vetor de operações (data_operacao é ignorada)
+ *   - total: Quantidade de operações
+ *   - data: Horário das operações (um horário anterior ao último vira o último)
+ * Retorna: true se gravadas, false se faltou memória ou um tipo é desconhecido
+ */
+bool registros_adicionar(RegistrosHistorico* registros, const Operacao* operacoes, int total,
+                         time_t data);
+
+/**
+ * Acessa o registro codificado de uma posição (lendo o segmento se estiver em disco)
+ * Parâmetros:
+ *   - registros: Ponteiro para o armazenamento
+ *   - posicao: Posição (0 = mais antigo)
+ * Retorna: Ponteiro para o registro (válido até a próxima leitura do histórico),
+ *          ou NULL se o arquivo do segmento não pôde ser lido
+ */
+const RegistroHistorico* registros_obter(RegistrosHistorico* registros, int posicao);
+
+/**
+ * Decodifica a operação de uma posição (lendo o segmento se estiver em disco)
+ * Parâmetros:
+ *   - registros: Ponteiro para o armazenamento
+ *   - posicao: Posição (0 = mais antigo)
+ *   - saida: Operação decodificada (tipo, título, leitor e horário)
+ * Retorna: true se decodificada, false se o arquivo do segmento não pôde ser lido
+ */
+bool registros_ler(RegistrosHistorico* registros, int posicao, Operacao* saida);
+
+/**
+ * Primeira posição com horário maior ou igual a um instante (busca binária)
+ * As bases dos blocos arquivados estão no índice: lê no máximo um arquivo.
+ * Parâmetros:
+ *   - registros: Ponteiro para o armazenamento
+ *   - instante: Horário procurado
+ * Retorna: Posição encontrada (igual ao total se todos são anteriores)
+ */
+int registros_primeira_desde(RegistrosHistorico* registros, time_t instante);
+
+/**
+ * Marca os ids de títulos iguais a um título, ignorando maiúsculas/minúsculas
+ * Parâmetros:
+ *   - registros: Ponteiro para o armazenamento
+ *   - titulo: Título procurado
+ * Retorna: Vetor com uma marca por id de título (liberar com free), ou NULL se
+ *          nenhum título é igual
+ */
+bool* registros_marcar_titulo(const RegistrosHistorico* registros, const char* titulo);
+
+/**
+ * Procura, voltando a partir de uma posição, a operação mais recente de um título
+ * Segmentos arquivados cujo índice não tem nenhum dos títulos não são lidos.
+ * Parâmetros:
+ *   - registros: Ponteiro para o armazenamento
+ *   - marcas: Vetor de registros_marcar_titulo()
+ *   - posicao: Última posição a considerar
+ * Retorna: Posição encontrada, ou -1 se não há outra (ou um arquivo não pôde ser lido)
+ */
+int registros_anterior_com_titulo(RegistrosHistorico* registros, const bool* marcas, int posicao);
+
+/**
+ * Ativa o arquivamento: os blocos antigos passam a ser gravados em disco
+ * Os registros continuam acessíveis pelas mesmas funções; os arquivos dependem
+ * dos dicionários em memória e são apagados por liberar_registros_historico().
+ * Parâmetros:
+ *   - registros: Ponteiro para o armazenamento
+ *   - prefixo: Caminho e início do nome dos arquivos (ex.: "dados/historico")
+ *   - registros_em_memoria: Operações mais recentes que ficam sempre em memória
+ * Retorna: true se ativado, false se os parâmetros são inválidos ou a gravação falhou
+ */
+bool registros_ativar_arquivamento(RegistrosHistorico* registros, const char* prefixo,
+                                   int registros_em_memoria);
+
+/**
+ * Libera toda a memória dos registros e dos dicionários e apaga os arquivos
+ * Parâmetros:
+ *   - registros: Ponteiro para o armazenamento a ser liberado
+ */
+void liberar_registros_historico(RegistrosHistorico* registros);
+
+#endif // HISTORICO_H
@@ -0,0 +1,450 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: indices.c
+ * Descrição: Implementação dos índices auxiliares do catálogo
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#include "indices.h"
+#include <math.h>
+
+// =============================================================================
+// FILTRO DE BLOOM (RESPOSTA RÁPIDA PARA TÍTULOS INEXISTENTES)
+// =============================================================================
+
+/**
+ * Hash de 64 bits (FNV-1a) usado para escolher o bloco e as posições
+ */
+static uint64_t hash_bloom(const char* texto) {
+    uint64_t hash = 14695981039346656037ull;
+    while (*texto) {
+        hash ^= (unsigned char)*texto++;
+        hash *= 1099511628211ull;
+    }
+    // Mistura final para espalhar os bits baixos
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/**
+ * Calcula o bloco e as posições (6 bits cada) de um título no filtro
+ */
+static uint8_t* posicoes_bloom(FiltroBloom* filtro, const char* titulo_busca, int* posicoes) {
+    uint64_t hash = hash_bloom(titulo_busca);
+    int bloco = (int)((hash >> 36) % (uint64_t)filtro->total_blocos);
+
+    for (int i = 0; i < FUNCOES_HASH_BLOOM; i++) {
+        posicoes[i] = (int)((hash >> (6 * i)) & (CONTADORES_POR_BLOCO - 1));
+    }
+
+    return filtro->contadores + (size_t)bloco * CONTADORES_POR_BLOCO;
+}
+
+/**
+ * Cria um filtro de Bloom vazio
+ */
+FiltroBloom* criar_filtro_bloom() {
+    FiltroBloom* filtro = (FiltroBloom*)malloc(sizeof(FiltroBloom));
+    if (filtro == NULL) {
+        return NULL;
+    }
+
+    filtro->total_blocos = BLOCOS_INICIAIS;
+    filtro->contadores = (uint8_t*)calloc((size_t)filtro->total_blocos * CONTADORES_POR_BLOCO,
+                                          sizeof(uint8_t));
+    if (filtro->contadores == NULL) {
+        free(filtro);
+        return NULL;
+    }
+
+    filtro->total_titulos = 0;
+    filtro->consultas = 0;
+    filtro->negativos = 0;
+    filtro->falsos_positivos = 0;
+    return filtro;
+}
+
+/**
+ * Registra um título no filtro
+ */
+void filtro_bloom_adicionar(FiltroBloom* filtro, const char* titulo_busca) {
+    if (filtro == NULL || titulo_busca == NULL) return;
+
+    int posicoes[FUNCOES_HASH_BLOOM];
+    uint8_t* bloco = posicoes_bloom(filtro, titulo_busca, posicoes);
+
+    for (int i = 0; i < FUNCOES_HASH_BLOOM; i++) {
+        // Contador saturado fica travado (nunca volta a zero por engano)
+        if (bloco[posicoes[i]] < UINT8_MAX) {
+            bloco[posicoes[i]]++;
+        }
+    }
+
+    filtro->total_titulos++;
+}
+
+/**
+ * Retira um título do filtro
+ */
+void filtro_bloom_remover(FiltroBloom* filtro, const char* titulo_busca) {
+    if (filtro == NULL || titulo_busca == NULL) return;
+
+    int posicoes[FUNCOES_HASH_BLOOM];
+    uint8_t* bloco = posicoes_bloom(filtro, titulo_busca, posicoes);
+
+    for (int i = 0; i < FUNCOES_HASH_BLOOM; i++) {
+        if (bloco[posicoes[i]] > 0 && bloco[posicoes[i]] < UINT8_MAX) {
+            bloco[posicoes[i]]--;
+        }
+    }
+
+    filtro->total_titulos--;
+}
+
+/**
+ * Verifica se um título pode estar no catálogo
+ */
+bool filtro_bloom_talvez_contem(FiltroBloom* filtro, const char* titulo_busca) {
+    if (filtro == NULL || titulo_busca == NULL) {
+        return true; // Sem filtro, nada pode ser descartado
+    }
+
+    filtro->consultas++;
+
+    int posicoes[FUNCOES_HASH_BLOOM];
+    uint8_t* bloco = posicoes_bloom(filtro, titulo_busca, posicoes);
+
+    for (int i = 0; i < FUNCOES_HASH_BLOOM; i++) {
+        if (bloco[posicoes[i]] == 0) {
+            filtro->negativos++;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Reconstrói o filtro com o dobro de blocos quando ele fica cheio demais
+ */
+bool filtro_bloom_ajustar(FiltroBloom* filtro, ListaLivros* lista) {
+    if (filtro == NULL || lista == NULL) {
+        return false;
+    }
+
+    long long capacidade = (long long)filtro->total_blocos * CONTADORES_POR_BLOCO / CONTADORES_POR_TITULO;
+    if (filtro->total_titulos <= capacidade) {
+        return true;
+    }
+
+    int novos_blocos = filtro->total_blocos * 2;
+    uint8_t* novos = (uint8_t*)calloc((size_t)novos_blocos * CONTADORES_POR_BLOCO, sizeof(uint8_t));
+    if (novos == NULL) {
+        return false; // Continua funcionando, apenas com mais falsos positivos
+    }
+
+    free(filtro->contadores);
+    filtro->contadores = novos;
+    filtro->total_blocos = novos_blocos;
+    filtro->total_titulos = 0;
+
+    // Reinsere todos os títulos do catálogo
+    NoLivro* atual = lista->cabeca;
+    while (atual != NULL) {
+        filtro_bloom_adicionar(filtro, atual->titulo_busca);
+        atual = atual->proximo;
+    }
+
+    return true;
+}
+
+/**
+ * Estima a taxa de falsos positivos a partir da ocupação dos contadores
+ */
+double filtro_bloom_taxa_estimada(FiltroBloom* filtro) {
+    if (filtro == NULL || filtro->total_titulos == 0) {
+        return 0.0;
+    }
+
+    // Um título ausente passa se todas as suas posições no bloco sorteado
+    // estiverem ocupadas: média de (ocupação do bloco)^k sobre os blocos
+    double soma = 0.0;
+    for (int b = 0; b < filtro->total_blocos; b++) {
+        uint8_t* bloco = filtro->contadores + (size_t)b * CONTADORES_POR_BLOCO;
+        int ocupados = 0;
+        for (int i = 0; i < CONTADORES_POR_BLOCO; i++) {
+            if (bloco[i] != 0) {
+                ocupados++;
+            }
+        }
+        soma += pow((double)ocupados / CONTADORES_POR_BLOCO, FUNCOES_HASH_BLOOM);
+    }
+
+    return soma / filtro->total_blocos;
+}
+
+/**
+ * Calcula a taxa de falsos positivos observada nas consultas
+ */
+double filtro_bloom_taxa_observada(FiltroBloom* filtro) {
+    if (filtro == NULL) {
+        return 0.0;
+    }
+
+    long long ausentes = filtro->negativos + filtro->falsos_positivos;
+    if (ausentes == 0) {
+        return 0.0;
+    }
+
+    return (double)filtro->falsos_positivos / (double)ausentes;
+}
+
+/**
+ * Libera toda a memória do filtro
+ */
+void liberar_filtro_bloom(FiltroBloom* filtro) {
+    if (filtro == NULL) return;
+
+    free(filtro->contadores);
+    free(filtro);
+}
+
+// =============================================================================
+// ÍNDICE DE ISBN (CHAVES INTEIRAS DE 64 BITS)
+// =============================================================================
+
+/**
+ * Valida um ISBN-10 ou ISBN-13 e o converte em um inteiro de 64 bits
+ */
+uint64_t normalizar_isbn(const char* isbn) {
+    if (isbn == NULL) {
+        return 0;
+    }
+
+    // Extrai os dígitos (e o 'X' final do ISBN-10), ignorando hífens e espaços
+    int digitos[13];
+    int total = 0;
+    for (int i = 0; isbn[i]; i++) {
+        char c = isbn[i];
+        if (c == '-' || c == ' ') {
+            continue;
+        }
+        if (total == 13) {
+            return 0; // Longo demais
+        }
+        if (isdigit((unsigned char)c)) {
+            digitos[total++] = c - '0';
+        } else if ((c == 'X' || c == 'x') && total == 9) {
+            digitos[total++] = 10; // 'X' vale 10 e só pode ser o dígito verificador do ISBN-10
+        } else {
+            return 0;
+        }
+    }
+
+    if (total == 10) {
+        // ISBN-10: soma ponderada (10, 9, ..., 1) deve ser múltipla de 11
+        int soma = 0;
+        for (int i = 0; i < 10; i++) {
+            soma += digitos[i] * (10 - i);
+        }
+        if (soma % 11 != 0) {
+            return 0;
+        }
+
+        // Converte para ISBN-13: prefixo 978 + 9 primeiros dígitos + novo verificador
+        int convertido[13] = { 9, 7, 8 };
+        for (int i = 0; i < 9; i++) {
+            convertido[3 + i] = digitos[i];
+        }
+        soma = 0;
+        for (int i = 0; i < 12; i++) {
+            soma += convertido[i] * (i % 2 == 0 ? 1 : 3);
+        }
+        convertido[12] = (10 - soma % 10) % 10;
+
+        memcpy(digitos, convertido, sizeof(convertido));
+        total = 13;
+    } else if (total == 13) {
+        // ISBN-13: soma ponderada (1, 3, 1, 3, ...) deve ser múltipla de 10
+        int soma = 0;
+        for (int i = 0; i < 13; i++) {
+            if (digitos[i] > 9) {
+                return 0;
+            }
+            soma += digitos[i] * (i % 2 == 0 ? 1 : 3);
+        }
+        if (soma % 10 != 0) {
+            return 0;
+        }
+    } else {
+        return 0;
+    }
+
+    uint64_t chave = 0;
+    for (int i = 0; i < 13; i++) {
+        chave = chave * 10 + (uint64_t)digitos[i];
+    }
+    return chave;
+}
+
+/**
+ * Posição inicial de uma chave na tabela (mistura os bits do número)
+ */
+static int posicao_isbn(IndiceISBN* indice, uint64_t chave) {
+    chave ^= chave >> 33;
+    chave *= 0xff51afd7ed558ccdull;
+    chave ^= chave >> 33;
+    return (int)(chave & (uint64_t)(indice->capacidade - 1));
+}
+
+/**
+ * Dobra a capacidade da tabela, reinserindo todas as entradas
+ */
+static bool redimensionar_indice_isbn(IndiceISBN* indice) {
+    int capacidade_antiga = indice->capacidade;
+    EntradaISBN* antigas = indice->entradas;
+
+    EntradaISBN* novas = (EntradaISBN*)calloc(capacidade_antiga * 2, sizeof(EntradaISBN));
+    if (novas == NULL) {
+        return false;
+    }
+
+    indice->entradas = novas;
+    indice->capacidade = capacidade_antiga * 2;
+
+    for (int i = 0; i < capacidade_antiga; i++) {
+        if (antigas[i].chave != 0) {
+            int p = posicao_isbn(indice, antigas[i].chave);
+            while (novas[p].chave != 0) {
+                p = (p + 1) & (indice->capacidade - 1);
+            }
+            novas[p] = antigas[i];
+        }
+    }
+
+    free(antigas);
+    return true;
+}
+
+/**
+ * Cria um índice de ISBN vazio
+ */
+IndiceISBN* criar_indice_isbn() {
+    IndiceISBN* indice = (IndiceISBN*)malloc(sizeof(IndiceISBN));
+    if (indice == NULL) {
+        return NULL;
+    }
+
+    indice->capacidade = CAPACIDADE_INICIAL_ISBN;
+    indice->entradas = (EntradaISBN*)calloc(indice->capacidade, sizeof(EntradaISBN));
+    if (indice->entradas == NULL) {
+        free(indice);
+        return NULL;
+    }
+
+    indice->total = 0;
+    return indice;
+}
+
+/**
+ * Associa uma chave de ISBN a um livro
+ */
+bool indice_isbn_adicionar(IndiceISBN* indice, uint64_t chave, NoLivro* livro) {
+    if (indice == NULL || chave == 0 || livro == NULL) {
+        return false;
+    }
+
+    // Mantém a ocupação abaixo de 70% para sondagens curtas
+    if ((indice->total + 1) * 10 > indice->capacidade * 7) {
+        if (!redimensionar_indice_isbn(indice)) {
+            return false;
+        }
+    }
+
+    int p = posicao_isbn(indice, chave);
+    while (indice->entradas[p].chave != 0) {
+        if (indice->entradas[p].chave == chave) {
+            return false; // ISBN duplicado
+        }
+        p = (p + 1) & (indice->capacidade - 1);
+    }
+
+    indice->entradas[p].chave = chave;
+    indice->entradas[p].livro = livro;
+    indice->total++;
+    return true;
+}
+
+/**
+ * Busca o livro associado a uma chave de ISBN
+ */
+NoLivro* indice_isbn_buscar(IndiceISBN* indice, uint64_t chave) {
+    if (indice == NULL || chave == 0) {
+        return NULL;
+    }
+
+    int p = posicao_isbn(indice, chave);
+    while (indice->entradas[p].chave != 0) {
+        if (indice->entradas[p].chave == chave) {
+            return indice->entradas[p].livro;
+        }
+        p = (p + 1) & (indice->capacidade - 1);
+    }
+
+    return NULL;
+}
+
+/**
+ * Remove uma chave de ISBN do índice
+ * Usa remoção por deslocamento: as entradas seguintes do mesmo agrupamento
+ * voltam uma posição, sem deixar marcas de "removido" na tabela.
+ */
+void indice_isbn_remover(IndiceISBN* indice, uint64_t chave) {
+    if (indice == NULL || chave == 0) {
+        return;
+    }
+
+    int mascara = indice->capacidade - 1;
+    int p = posicao_isbn(indice, chave);
+    while (indice->entradas[p].chave != chave) {
+        if (indice->entradas[p].chave == 0) {
+            return; // Não encontrado
+        }
+        p = (p + 1) & mascara;
+    }
+
+    int vazio = p;
+    int atual = (p + 1) & mascara;
+    while (indice->entradas[atual].chave != 0) {
+        int ideal = posicao_isbn(indice, indice->entradas[atual].chave);
+
+        // A entrada pode ocupar o buraco se a posição ideal dela não estiver
+        // entre o buraco (exclusive) e a posição atual (inclusive), circularmente
+        bool pode_mover = ((atual - ideal) & mascara) >= ((atual - vazio) & mascara);
+        if (pode_mover) {
+            indice->entradas[vazio] = indice->entradas[atual];
+            vazio = atual;
+        }
+        atual = (atual + 1) & mascara;
+    }
+
+    indice->entradas[vazio].chave = 0;
+    indice->entradas[vazio].livro = NULL;
+    indice->total--;
+}
+
+/**
+ * Libera toda a memória do índice de ISBN
+ */
+void liberar_indice_isbn(IndiceISBN* indice) {
+    if (indice == NULL) return;
+
+    free(indice->entradas);
+    free(indice);
+}
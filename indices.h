@@ -0,0 +1,180 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: indices.h
+ * Descrição: Índices auxiliares do catálogo para acelerar as consultas
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef INDICES_H
+#define INDICES_H
+
+#include "biblioteca.h"
+#include <stdint.h>
+
+// =============================================================================
+// CONSTANTES DOS ÍNDICES
+// =============================================================================
+
+#define CONTADORES_POR_BLOCO 64     // Contadores por bloco (um bloco = 64 bytes)
+#define FUNCOES_HASH_BLOOM 6        // Posições marcadas por título dentro do bloco
+#define CONTADORES_POR_TITULO 10    // Contadores reservados por título no dimensionamento
+#define BLOCOS_INICIAIS 16          // Número inicial de blocos do filtro
+#define CAPACIDADE_INICIAL_ISBN 64  // Posições iniciais da tabela de ISBNs (potência de 2)
+
+// =============================================================================
+// FILTRO DE BLOOM (RESPOSTA RÁPIDA PARA TÍTULOS INEXISTENTES)
+// =============================================================================
+
+/**
+ * Filtro de Bloom de contadores, dividido em blocos do tamanho de uma linha de cache
+ * Cada título marca FUNCOES_HASH_BLOOM contadores de um único bloco, então uma
+ * consulta lê apenas 64 bytes. Os contadores permitem remover títulos.
+ */
+typedef struct FiltroBloom {
+    uint8_t* contadores;        // Vetor de blocos * CONTADORES_POR_BLOCO contadores
+    int total_blocos;           // Número de blocos
+    int total_titulos;          // Títulos inseridos
+    long long consultas;        // Consultas realizadas
+    long long negativos;        // Consultas descartadas pelo filtro (título inexistente)
+    long long falsos_positivos; // Filtro indicou "talvez", mas o título não existia
+} FiltroBloom;
+
+/**
+ * Cria um filtro de Bloom vazio
+ * Retorna: Ponteiro para o filtro criado, ou NULL em caso de erro
+ */
+FiltroBloom* criar_filtro_bloom();
+
+/**
+ * Registra um título (já em minúsculas) no filtro
+ * Parâmetros:
+ *   - filtro: Ponteiro para o filtro
+ *   - titulo_busca: Título em minúsculas
+ */
+void filtro_bloom_adicionar(FiltroBloom* filtro, const char* titulo_busca);
+
+/**
+ * Retira um título (já em minúsculas) do filtro
+ * Parâmetros:
+ *   - filtro: Ponteiro para o filtro
+ *   - titulo_busca: Título em minúsculas
+ */
+void filtro_bloom_remover(FiltroBloom* filtro, const char* titulo_busca);
+
+/**
+ * Verifica se um título pode estar no catálogo
+ * Parâmetros:
+ *   - filtro: Ponteiro para o filtro
+ *   - titulo_busca: Título em minúsculas
+ * Retorna: false se o título certamente não existe, true se talvez exista
+ */
+bool filtro_bloom_talvez_contem(FiltroBloom* filtro, const char* titulo_busca);
+
+/**
+ * Reconstrói o filtro com o dobro de blocos quando ele fica cheio demais
+ * Parâmetros:
+ *   - filtro: Ponteiro para o filtro
+ *   - lista: Catálogo cujos títulos serão reinseridos
+ * Retorna: true se o filtro está dimensionado corretamente ao final
+ */
+bool filtro_bloom_ajustar(FiltroBloom* filtro, ListaLivros* lista);
+
+/**
+ * Estima a taxa de falsos positivos a partir da ocupação dos contadores
+ * Parâmetros:
+ *   - filtro: Ponteiro para o filtro
+ * Retorna: Probabilidade estimada (0.0 a 1.0)
+ */
+double filtro_bloom_taxa_estimada(FiltroBloom* filtro);
+
+/**
+ * Calcula a taxa de falsos positivos observada nas consultas
+ * Parâmetros:
+ *   - filtro: Ponteiro para o filtro
+ * Retorna: Falsos positivos / consultas por títulos inexistentes (0.0 a 1.0)
+ */
+double filtro_bloom_taxa_observada(FiltroBloom* filtro);
+
+/**
+ * Libera toda a memória do filtro
+ * Parâmetros:
+ *   - filtro: Ponteiro para o filtro a ser liberado
+ */
+void liberar_filtro_bloom(FiltroBloom* filtro);
+
+// =============================================================================
+// ÍNDICE DE ISBN (CHAVES INTEIRAS DE 64 BITS)
+// =============================================================================
+
+/**
+ * Posição da tabela hash de ISBNs
+ */
+typedef struct {
+    uint64_t chave;     // ISBN-13 normalizado (0 = posição livre)
+    NoLivro* livro;     // Livro com este ISBN
+} EntradaISBN;
+
+/**
+ * Tabela hash de ISBNs com endereçamento aberto (sondagem linear)
+ */
+typedef struct IndiceISBN {
+    EntradaISBN* entradas;  // Vetor de posições
+    int capacidade;         // Número de posições (potência de 2)
+    int total;              // Posições ocupadas
+} IndiceISBN;
+
+/**
+ * Valida um ISBN-10 ou ISBN-13 e o converte em um inteiro de 64 bits
+ * Hífens e espaços são ignorados; um ISBN-10 é convertido para o ISBN-13
+ * equivalente (prefixo 978), então as duas formas geram a mesma chave.
+ * Parâmetros:
+ *   - isbn: String com o ISBN
+ * Retorna: O ISBN-13 como número, ou 0 se o ISBN for inválido
+ */
+uint64_t normalizar_isbn(const char* isbn);
+
+/**
+ * Cria um índice de ISBN vazio
+ * Retorna: Ponteiro para o índice criado, ou NULL em caso de erro
+ */
+IndiceISBN* criar_indice_isbn();
+
+/**
+ * Associa uma chave de ISBN a um livro
+ * Parâmetros:
+ *   - indice: Ponteiro para o índice
+ *   - chave: ISBN normalizado (diferente de 0)
+ *   - livro: Nó do livro
+ * Retorna: true se inserido, false se a chave já existe ou faltou memória
+ */
+bool indice_isbn_adicionar(IndiceISBN* indice, uint64_t chave, NoLivro* livro);
+
+/**
+ * Busca o livro associado a uma chave de ISBN
+ * Parâmetros:
+ *   - indice: Ponteiro para o índice
+ *   - chave: ISBN normalizado
+ * Retorna: Ponteiro para o nó do livro, ou NULL se não encontrado
+ */
+NoLivro* indice_isbn_buscar(IndiceISBN* indice, uint64_t chave);
+
+/**
+ * Remove uma chave de ISBN do índice
+ * Parâmetros:
+ *   - indice: Ponteiro para o índice
+ *   - chave: ISBN normalizado
+ */
+void indice_isbn_remover(IndiceISBN* indice, uint64_t chave);
+
+/**
+ * Libera toda a memória do índice de ISBN
+ * Parâmetros:
+ *   - indice: Ponteiro para o índice a ser liberado
+ */
+void liberar_indice_isbn(IndiceISBN* indice);
+
+#endif // INDICES_H
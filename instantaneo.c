@@ -0,0 +1,259 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: instantaneo.c
+ * Descrição: Implementação dos instantâneos em segundo plano
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L // fork() e waitpid() com -std=c99
+
+#include "instantaneo.h"
+#include "exportacao.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <unistd.h>
+#ifndef _WIN32
+#include <sys/wait.h>
+#endif
+
+/**
+ * Instantâneo em andamento (processo filho ainda não recolhido)
+ */
+typedef struct Instantaneo {
+    pid_t processo;                               // Processo filho (0 = posição livre)
+    char descricao[MAX_DESCRICAO_INSTANTANEO];    // Texto do aviso de conclusão
+    time_t inicio;                                // Quando o instantâneo foi criado
+} Instantaneo;
+
+/**
+ * Parâmetros de uma exportação em segundo plano
+ */
+typedef struct ExportacaoInstantaneo {
+    char prefixo[MAX_CAMINHO_INSTANTANEO]; // Início do caminho dos arquivos
+    int formato;                           // FORMATO_CSV ou FORMATO_JSON_LINHAS
+} ExportacaoInstantaneo;
+
+// Instantâneos do processo principal
+static Instantaneo instantaneos[MAX_INSTANTANEOS];
+
+// =============================================================================
+// CRIAÇÃO E RECOLHIMENTO
+// =============================================================================
+
+#ifdef _WIN32
+/**
+ * Sem fork() no Windows: executa a tarefa no próprio processo, com o menu parado
+ * A saída padrão vai para o arquivo durante a tarefa e depois volta para a tela.
+ */
+static bool executar_no_processo(Biblioteca* bib, const char* descricao, const char* caminho,
+                                 TarefaInstantaneo tarefa, void* contexto) {
+    time_t inicio = time(NULL);
+    int tela = -1;
+
+    fflush(stdout);
+    if (caminho != NULL) {
+        int descritor = open(caminho, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (descritor < 0) {
+            printf("Erro: Não foi possível criar '%s' (%s)!\n", caminho, strerror(errno));
+            return false;
+        }
+        tela = dup(STDOUT_FILENO);
+        dup2(descritor, STDOUT_FILENO);
+        close(descritor);
+    }
+
+    bool sucesso = tarefa(bib, contexto);
+    if (fflush(stdout) != 0) {
+        sucesso = false;
+    }
+    if (tela >= 0) {
+        dup2(tela, STDOUT_FILENO);
+        close(tela);
+    }
+
+    if (sucesso) {
+        printf("\n✓ %s terminou (%ld s).\n", descricao != NULL ? descricao : "Instantâneo",
+               (long)(time(NULL) - inicio));
+    } else {
+        printf("\nErro: %s falhou!\n", descricao != NULL ? descricao : "Instantâneo");
+    }
+    return sucesso;
+}
+#endif
+
+/**
+ * Congela o estado atual da biblioteca e executa uma tarefa sobre ele em segundo plano
+ */
+bool iniciar_instantaneo(Biblioteca* bib, const char* descricao, const char* caminho,
+                         TarefaInstantaneo tarefa, void* contexto) {
+    if (bib == NULL || tarefa == NULL) {
+        return false;
+    }
+
+#ifdef _WIN32
+    return executar_no_processo(bib, descricao, caminho, tarefa, contexto);
+#else
+
+    int posicao = 0;
+    while (posicao < MAX_INSTANTANEOS && instantaneos[posicao].processo != 0) {
+        posicao++;
+    }
+    if (posicao == MAX_INSTANTANEOS) {
+        printf("Erro: Já há %d relatórios em segundo plano; aguarde algum terminar!\n", MAX_INSTANTANEOS);
+        return false;
+    }
+
+    // O que está no buffer do printf() sairia duas vezes (uma por processo)
+    fflush(stdout);
+    fflush(stderr);
+
+    pid_t processo = fork();
+    if (processo < 0) {
+        printf("Erro: Não foi possível criar o instantâneo (%s)!\n", strerror(errno));
+        return false;
+    }
+
+    if (processo == 0) {
+        // Processo filho: só lê a cópia congelada e termina com _exit(), sem
+        // liberar a biblioteca (isso apagaria os arquivos do histórico, que
+        // continuam em uso pelo processo principal)
+        if (caminho != NULL) {
+            int descritor = open(caminho, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (descritor < 0) {
+                printf("Erro: Não foi possível criar '%s' (%s)!\n", caminho, strerror(errno));
+                fflush(stdout);
+                _exit(1);
+            }
+            dup2(descritor, STDOUT_FILENO);
+            close(descritor);
+        }
+
+        bool sucesso = tarefa(bib, contexto);
+        if (fflush(stdout) != 0) {
+            sucesso = false;
+        }
+        _exit(sucesso ? 0 : 1);
+    }
+
+    instantaneos[posicao].processo = processo;
+    strncpy(instantaneos[posicao].descricao, descricao != NULL ? descricao : "Instantâneo",
+            MAX_DESCRICAO_INSTANTANEO - 1);
+    instantaneos[posicao].descricao[MAX_DESCRICAO_INSTANTANEO - 1] = '\0';
+    instantaneos[posicao].inicio = time(NULL);
+    return true;
+#endif
+}
+
+/**
+ * Recolhe os instantâneos que terminaram e avisa o resultado de cada um
+ */
+int verificar_instantaneos(bool aguardar) {
+    int recolhidos = 0;
+
+#ifdef _WIN32
+    (void)aguardar; // As tarefas já terminaram em iniciar_instantaneo()
+#else
+    for (int i = 0; i < MAX_INSTANTANEOS; i++) {
+        if (instantaneos[i].processo == 0) continue;
+
+        int situacao;
+        pid_t resultado = waitpid(instantaneos[i].processo, &situacao, aguardar ? 0 : WNOHANG);
+        if (resultado == 0) continue; // Ainda em andamento
+        if (resultado < 0 && errno == EINTR) {
+            i--; // Interrompido por um sinal: tenta de novo
+            continue;
+        }
+
+        if (resultado > 0 && WIFEXITED(situacao) && WEXITSTATUS(situacao) == 0) {
+            printf("\n✓ Segundo plano: %s terminou (%ld s).\n", instantaneos[i].descricao,
+                   (long)(time(NULL) - instantaneos[i].inicio));
+        } else {
+            printf("\nErro: %s em segundo plano falhou!\n", instantaneos[i].descricao);
+        }
+        instantaneos[i].processo = 0;
+        recolhidos++;
+    }
+#endif
+
+    return recolhidos;
+}
+
+/**
+ * Quantidade de instantâneos ainda em andamento
+ */
+int instantaneos_em_andamento() {
+    int total = 0;
+    for (int i = 0; i < MAX_INSTANTANEOS; i++) {
+        if (instantaneos[i].processo != 0) {
+            total++;
+        }
+    }
+    return total;
+}
+
+// =============================================================================
+// TAREFAS PRONTAS
+// =============================================================================
+
+/**
+ * Tarefa: exporta as quatro estruturas
+ */
+static bool tarefa_exportar(Biblioteca* bib, void* contexto) {
+    ExportacaoInstantaneo* exportacao = (ExportacaoInstantaneo*)contexto;
+    return exportar_biblioteca(bib, exportacao->prefixo, exportacao->formato, true);
+}
+
+/**
+ * Tarefa: gera um dos relatórios do menu na saída padrão
+ */
+static bool tarefa_relatorio(Biblioteca* bib, void* contexto) {
+    int relatorio = *(int*)contexto;
+
+    switch (relatorio) {
+        case RELATORIO_EMPRESTADOS:
+            listar_livros_emprestados(bib->catalogo);
+            break;
+        case RELATORIO_HISTORICO:
+            exibir_historico(bib->historico, 0);
+            break;
+        default:
+            relatorio_sistema(bib);
+            break;
+    }
+    return true;
+}
+
+/**
+ * Exporta as quatro estruturas a partir de um instantâneo
+ */
+bool instantaneo_exportar(Biblioteca* bib, const char* prefixo, int formato) {
+    // O contexto pode ficar na pilha: o filho recebe uma cópia dela no fork()
+    ExportacaoInstantaneo exportacao;
+    if (prefixo == NULL || strlen(prefixo) >= MAX_CAMINHO_INSTANTANEO) {
+        printf("Erro: Caminho muito longo!\n");
+        return false;
+    }
+    strcpy(exportacao.prefixo, prefixo);
+    exportacao.formato = formato;
+
+    return iniciar_instantaneo(bib, "Exportação", NULL, tarefa_exportar, &exportacao);
+}
+
+/**
+ * Gera um relatório em um arquivo a partir de um instantâneo
+ */
+bool instantaneo_relatorio(Biblioteca* bib, int relatorio, const char* caminho) {
+    const char* descricao = relatorio == RELATORIO_EMPRESTADOS ? "Relatório de empréstimos"
+                          : relatorio == RELATORIO_HISTORICO ? "Relatório do histórico"
+                                                             : "Relatório do sistema";
+
+    if (caminho == NULL) {
+        return false;
+    }
+    return iniciar_instantaneo(bib, descricao, caminho, tarefa_relatorio, &relatorio);
+}
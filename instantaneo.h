@@ -0,0 +1,99 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: instantaneo.h
+ * Descrição: Relatórios e exportações sobre um instantâneo da biblioteca,
+ *            gerados em segundo plano (fork com cópia na escrita)
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef INSTANTANEO_H
+#define INSTANTANEO_H
+
+#include "biblioteca.h"
+
+// =============================================================================
+// CONSTANTES DOS INSTANTÂNEOS
+// =============================================================================
+
+#define MAX_INSTANTANEOS 8              // Instantâneos em andamento ao mesmo tempo
+#define MAX_DESCRICAO_INSTANTANEO 64    // Tamanho máximo da descrição de um instantâneo
+#define MAX_CAMINHO_INSTANTANEO 512     // Tamanho máximo do arquivo de saída
+
+#define RELATORIO_SISTEMA 0             // relatorio_sistema()
+#define RELATORIO_EMPRESTADOS 1         // listar_livros_emprestados()
+#define RELATORIO_HISTORICO 2           // exibir_historico() completo
+
+/**
+ * Trabalho executado sobre o instantâneo
+ * Roda em um processo filho: pode ler a biblioteca à vontade, mas o que ele
+ * alterar não volta para o processo principal.
+ * Parâmetros:
+ *   - bib: Biblioteca congelada no momento do instantâneo
+ *   - contexto: Dados do chamador (copiados junto com o processo)
+ * Retorna: true se o trabalho terminou sem erro
+ */
+typedef bool (*TarefaInstantaneo)(Biblioteca* bib, void* contexto);
+
+// =============================================================================
+// FUNÇÕES DOS INSTANTÂNEOS
+// =============================================================================
+
+/**
+ * Congela o estado atual da biblioteca e executa uma tarefa sobre ele em segundo plano
+ * O processo é duplicado com fork(): o filho enxerga a biblioteca exatamente
+ * como estava nesta chamada, enquanto empréstimos e devoluções continuam no
+ * processo principal. O sistema só copia as páginas de memória que o processo
+ * principal alterar depois, então o instantâneo custa a cópia das tabelas de
+ * páginas, não a do catálogo. Não deve ser chamada durante uma varredura paralela.
+ * No Windows (sem fork()), a tarefa roda na hora, no próprio processo, e o
+ * menu espera ela terminar; o aviso de conclusão sai no fim desta chamada.
+ * Parâmetros:
+ *   - bib: Ponteiro para a biblioteca
+ *   - descricao: Texto exibido quando a tarefa terminar
+ *   - caminho: Arquivo que recebe a saída padrão da tarefa (NULL = a própria tela)
+ *   - tarefa: Trabalho executado no instantâneo
+ *   - contexto: Dados passados à tarefa
+ * Retorna: true se o instantâneo foi criado (o resultado vem em verificar_instantaneos())
+ */
+bool iniciar_instantaneo(Biblioteca* bib, const char* descricao, const char* caminho,
+                         TarefaInstantaneo tarefa, void* contexto);
+
+/**
+ * Exporta as quatro estruturas (exportar_biblioteca()) a partir de um instantâneo
+ * Parâmetros:
+ *   - bib: Ponteiro para a biblioteca
+ *   - prefixo: Início do caminho dos arquivos
+ *   - formato: FORMATO_CSV ou FORMATO_JSON_LINHAS
+ * Retorna: true se a exportação foi iniciada
+ */
+bool instantaneo_exportar(Biblioteca* bib, const char* prefixo, int formato);
+
+/**
+ * Gera um relatório em um arquivo a partir de um instantâneo
+ * Parâmetros:
+ *   - bib: Ponteiro para a biblioteca
+ *   - relatorio: RELATORIO_SISTEMA, RELATORIO_EMPRESTADOS ou RELATORIO_HISTORICO
+ *   - caminho: Arquivo de destino (no formato dos relatórios do menu)
+ * Retorna: true se o relatório foi iniciado
+ */
+bool instantaneo_relatorio(Biblioteca* bib, int relatorio, const char* caminho);
+
+/**
+ * Recolhe os instantâneos que terminaram e avisa o resultado de cada um
+ * Parâmetros:
+ *   - aguardar: true para esperar todos terminarem (antes de liberar a biblioteca)
+ * Retorna: Quantidade de instantâneos recolhidos
+ */
+int verificar_instantaneos(bool aguardar);
+
+/**
+ * Quantidade de instantâneos ainda em andamento
+ * Retorna: Instantâneos iniciados e ainda não recolhidos
+ */
+int instantaneos_em_andamento();
+
+#endif // INSTANTANEO_H
@@ -0,0 +1,307 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: leitores.c
+ * Descrição: Implementação do cadastro de leitores
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#include "leitores.h"
+
+// =============================================================================
+// FUNÇÕES DO CADASTRO DE LEITORES
+// =============================================================================
+
+/**
+ * Cria um cadastro de leitores vazio
+ */
+CadastroLeitores* criar_cadastro_leitores() {
+    CadastroLeitores* cadastro = (CadastroLeitores*)malloc(sizeof(CadastroLeitores));
+    if (cadastro == NULL) {
+        return NULL;
+    }
+
+    cadastro->capacidade = CAPACIDADE_INICIAL_LEITORES;
+    cadastro->baldes = (Leitor**)calloc(cadastro->capacidade, sizeof(Leitor*));
+    cadastro->capacidade_ids = CAPACIDADE_INICIAL_LEITORES;
+    cadastro->por_id = (Leitor**)malloc(cadastro->capacidade_ids * sizeof(Leitor*));
+    if (cadastro->baldes == NULL || cadastro->por_id == NULL) {
+        free(cadastro->baldes);
+        free(cadastro->por_id);
+        free(cadastro);
+        return NULL;
+    }
+
+    cadastro->total = 0;
+    cadastro->limite_emprestimos = MAX_EMPRESTIMOS_POR_LEITOR;
+    return cadastro;
+}
+
+/**
+ * Procura um leitor pelo nome já convertido para minúsculas
+ */
+static Leitor* procurar_leitor(CadastroLeitores* cadastro, const char* nome_busca) {
+    Leitor* atual = cadastro->baldes[calcular_hash(nome_busca) % cadastro->capacidade];
+    while (atual != NULL) {
+        if (strcmp(atual->nome_busca, nome_busca) == 0) {
+            return atual;
+        }
+        atual = atual->proximo_balde;
+    }
+    return NULL;
+}
+
+/**
+ * Busca um leitor pelo nome (case-insensitive)
+ */
+Leitor* buscar_leitor(CadastroLeitores* cadastro, const char* nome) {
+    if (cadastro == NULL || nome == NULL || strlen(nome) >= MAX_NOME_LEITOR) {
+        return NULL;
+    }
+
+    char nome_busca[MAX_NOME_LEITOR];
+    para_minusculo(nome_busca, nome);
+    return procurar_leitor(cadastro, nome_busca);
+}
+
+/**
+ * Busca um leitor pelo identificador
+ */
+Leitor* buscar_leitor_por_id(CadastroLeitores* cadastro, int id) {
+    if (cadastro == NULL || id < 1 || id > cadastro->total) {
+        return NULL;
+    }
+    return cadastro->por_id[id - 1];
+}
+
+/**
+ * Dobra o número de baldes da tabela de leitores
+ */
+static void redimensionar_cadastro(CadastroLeitores* cadastro) {
+    int nova_capacidade = cadastro->capacidade * 2;
+    Leitor** novos = (Leitor**)calloc(nova_capacidade, sizeof(Leitor*));
+    if (novos == NULL) {
+        return; // Continua funcionando, com baldes mais cheios
+    }
+
+    for (int i = 0; i < cadastro->capacidade; i++) {
+        Leitor* atual = cadastro->baldes[i];
+        while (atual != NULL) {
+            Leitor* proximo = atual->proximo_balde;
+            unsigned int balde = calcular_hash(atual->nome_busca) % nova_capacidade;
+            atual->proximo_balde = novos[balde];
+            novos[balde] = atual;
+            atual = proximo;
+        }
+    }
+
+    free(cadastro->baldes);
+    cadastro->baldes = novos;
+    cadastro->capacidade = nova_capacidade;
+}
+
+/**
+ * Busca um leitor pelo nome, cadastrando-o se ainda não existir
+ */
+Leitor* obter_leitor(CadastroLeitores* cadastro, const char* nome) {
+    if (cadastro == NULL || nome == NULL || strlen(nome) >= MAX_NOME_LEITOR) {
+        return NULL;
+    }
+
+    char nome_busca[MAX_NOME_LEITOR];
+    para_minusculo(nome_busca, nome);
+
+    Leitor* leitor = procurar_leitor(cadastro, nome_busca);
+    if (leitor != NULL) {
+        return leitor;
+    }
+
+    // Garante espaço no vetor de acesso por id
+    if (cadastro->total == cadastro->capacidade_ids) {
+        int nova_capacidade = cadastro->capacidade_ids * 2;
+        Leitor** novos = (Leitor**)realloc(cadastro->por_id, nova_capacidade * sizeof(Leitor*));
+        if (novos == NULL) {
+            return NULL;
+        }
+        cadastro->por_id = novos;
+        cadastro->capacidade_ids = nova_capacidade;
+    }
+
+    leitor = (Leitor*)malloc(sizeof(Leitor));
+    if (leitor == NULL) {
+        printf("Erro: Falha ao alocar memória para o leitor!\n");
+        return NULL;
+    }
+
+    strcpy(leitor->nome, nome);
+    strcpy(leitor->nome_busca, nome_busca);
+    leitor->emprestimos = NULL;
+    leitor->total_emprestimos = 0;
+    leitor->solicitacoes = NULL;
+    leitor->total_solicitacoes = 0;
+    leitor->prioridade = PRIORIDADE_GERAL;
+
+    // Insere no início do balde e no vetor por id
+    unsigned int balde = calcular_hash(nome_busca) % cadastro->capacidade;
+    leitor->proximo_balde = cadastro->baldes[balde];
+    cadastro->baldes[balde] = leitor;
+
+    cadastro->por_id[cadastro->total] = leitor;
+    cadastro->total++;
+    leitor->id = cadastro->total;
+
+    // Mantém em média no máximo um leitor por balde
+    if (cadastro->total > cadastro->capacidade) {
+        redimensionar_cadastro(cadastro);
+    }
+
+    return leitor;
+}
+
+/**
+ * Registra um exemplar entre os empréstimos do leitor (insere no início da lista)
+ */
+void leitor_vincular_emprestimo(Leitor* leitor, Exemplar* exemplar) {
+    if (leitor == NULL || exemplar == NULL) return;
+
+    exemplar->leitor_atual = leitor;
+    exemplar->anterior_do_leitor = NULL;
+    exemplar->proximo_do_leitor = leitor->emprestimos;
+    if (leitor->emprestimos != NULL) {
+        leitor->emprestimos->anterior_do_leitor = exemplar;
+    }
+    leitor->emprestimos = exemplar;
+    leitor->total_emprestimos++;
+}
+
+/**
+ * Retira um exemplar dos empréstimos do seu leitor atual
+ */
+void leitor_desvincular_emprestimo(Exemplar* exemplar) {
+    if (exemplar == NULL || exemplar->leitor_atual == NULL) return;
+
+    Leitor* leitor = exemplar->leitor_atual;
+    if (exemplar->anterior_do_leitor != NULL) {
+        exemplar->anterior_do_leitor->proximo_do_leitor = exemplar->proximo_do_leitor;
+    } else {
+        leitor->emprestimos = exemplar->proximo_do_leitor;
+    }
+    if (exemplar->proximo_do_leitor != NULL) {
+        exemplar->proximo_do_leitor->anterior_do_leitor = exemplar->anterior_do_leitor;
+    }
+
+    exemplar->leitor_atual = NULL;
+    exemplar->anterior_do_leitor = NULL;
+    exemplar->proximo_do_leitor = NULL;
+    leitor->total_emprestimos--;
+}
+
+/**
+ * Registra uma solicitação entre as solicitações do leitor
+ */
+void leitor_vincular_solicitacao(Leitor* leitor, NoFila* solicitacao) {
+    if (leitor == NULL || solicitacao == NULL) return;
+
+    solicitacao->leitor = leitor;
+    solicitacao->anterior_do_leitor = NULL;
+    solicitacao->proximo_do_leitor = leitor->solicitacoes;
+    if (leitor->solicitacoes != NULL) {
+        leitor->solicitacoes->anterior_do_leitor = solicitacao;
+    }
+    leitor->solicitacoes = solicitacao;
+    leitor->total_solicitacoes++;
+}
+
+/**
+ * Retira uma solicitação da lista do seu leitor
+ */
+void leitor_desvincular_solicitacao(NoFila* solicitacao) {
+    if (solicitacao == NULL || solicitacao->leitor == NULL) return;
+
+    Leitor* leitor = solicitacao->leitor;
+    if (solicitacao->anterior_do_leitor != NULL) {
+        solicitacao->anterior_do_leitor->proximo_do_leitor = solicitacao->proximo_do_leitor;
+    } else {
+        leitor->solicitacoes = solicitacao->proximo_do_leitor;
+    }
+    if (solicitacao->proximo_do_leitor != NULL) {
+        solicitacao->proximo_do_leitor->anterior_do_leitor = solicitacao->anterior_do_leitor;
+    }
+
+    solicitacao->leitor = NULL;
+    solicitacao->anterior_do_leitor = NULL;
+    solicitacao->proximo_do_leitor = NULL;
+    leitor->total_solicitacoes--;
+}
+
+/**
+ * Verifica se o leitor ainda pode pegar mais um livro emprestado
+ */
+bool leitor_pode_emprestar(CadastroLeitores* cadastro, Leitor* leitor) {
+    if (cadastro == NULL || leitor == NULL) {
+        return false; // Leitor fora do cadastro: o empréstimo não teria controle de limite
+    }
+    return leitor->total_emprestimos < cadastro->limite_emprestimos;
+}
+
+/**
+ * Exibe os livros emprestados e as solicitações na fila de um leitor
+ */
+int listar_situacao_leitor(CadastroLeitores* cadastro, const char* nome) {
+    Leitor* leitor = buscar_leitor(cadastro, nome);
+    if (leitor == NULL) {
+        printf("\nLeitor '%s' não possui empréstimos nem solicitações registrados.\n", nome);
+        return -1;
+    }
+
+    printf("\n=== SITUAÇÃO DO LEITOR: %s (id %d) ===\n", leitor->nome, leitor->id);
+    printf("Classe na fila de espera: %s\n",
+           leitor->prioridade == PRIORIDADE_PREFERENCIAL ? "Preferencial" : "Geral");
+    printf("Livros emprestados: %d (limite: %d)\n",
+           leitor->total_emprestimos, cadastro->limite_emprestimos);
+
+    int contador = 1;
+    Exemplar* exemplar = leitor->emprestimos;
+    while (exemplar != NULL) {
+        char data_str[30];
+        char prazo_str[30];
+        formatar_data(exemplar->data_emprestimo, data_str, sizeof(data_str));
+        formatar_data(exemplar->data_devolucao_prevista, prazo_str, sizeof(prazo_str));
+        printf("[%d] %s (exemplar %d) - emprestado em %s, devolver até %s\n", contador,
+               exemplar->livro->dados.titulo, exemplar->numero, data_str, prazo_str);
+        exemplar = exemplar->proximo_do_leitor;
+        contador++;
+    }
+
+    printf("\nSolicitações na fila de espera: %d\n", leitor->total_solicitacoes);
+
+    contador = 1;
+    NoFila* solicitacao = leitor->solicitacoes;
+    while (solicitacao != NULL) {
+        char data_str[30];
+        formatar_data(solicitacao->dados.data_solicitacao, data_str, sizeof(data_str));
+        printf("[%d] %s - solicitado em %s\n", contador, solicitacao->dados.titulo_livro, data_str);
+        solicitacao = solicitacao->proximo_do_leitor;
+        contador++;
+    }
+
+    return leitor->total_emprestimos;
+}
+
+/**
+ * Libera toda a memória do cadastro
+ */
+void liberar_cadastro_leitores(CadastroLeitores* cadastro) {
+    if (cadastro == NULL) return;
+
+    for (int i = 0; i < cadastro->total; i++) {
+        free(cadastro->por_id[i]);
+    }
+
+    free(cadastro->por_id);
+    free(cadastro->baldes);
+    free(cadastro);
+}
@@ -0,0 +1,144 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: leitores.h
+ * Descrição: Cadastro de leitores (tabela hash) com seus empréstimos e solicitações
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef LEITORES_H
+#define LEITORES_H
+
+#include "biblioteca.h"
+
+// =============================================================================
+// CONSTANTES DO CADASTRO
+// =============================================================================
+
+#define CAPACIDADE_INICIAL_LEITORES 64  // Baldes iniciais da tabela de leitores
+
+// =============================================================================
+// ESTRUTURA 4: TABELA HASH (CADASTRO DE LEITORES)
+// =============================================================================
+
+/**
+ * Estrutura que representa um LEITOR
+ * Os empréstimos e as solicitações ficam em listas intrusivas: os próprios nós
+ * do catálogo e da fila guardam os ponteiros, então vincular e desvincular é O(1).
+ */
+typedef struct Leitor {
+    int id;                                 // Identificador (1, 2, 3, ...)
+    char nome[MAX_NOME_LEITOR];             // Nome como foi digitado pela primeira vez
+    char nome_busca[MAX_NOME_LEITOR];       // Nome em minúsculas (chave da tabela)
+    Exemplar* emprestimos;                  // Primeiro exemplar emprestado ao leitor
+    int total_emprestimos;                  // Livros emprestados no momento
+    NoFila* solicitacoes;                   // Primeira solicitação do leitor na fila
+    int total_solicitacoes;                 // Solicitações na fila de espera
+    int prioridade;                         // Classe na fila de espera (PRIORIDADE_*)
+    struct Leitor* proximo_balde;           // Próximo leitor no mesmo balde
+} Leitor;
+
+/**
+ * Tabela hash de leitores (por nome) com acesso direto por id
+ */
+typedef struct CadastroLeitores {
+    Leitor** baldes;            // Tabela hash indexada pelo nome em minúsculas
+    int capacidade;             // Número de baldes
+    Leitor** por_id;            // Vetor indexado por id - 1
+    int capacidade_ids;         // Capacidade do vetor por id
+    int total;                  // Total de leitores cadastrados
+    int limite_emprestimos;     // Máximo de livros com o mesmo leitor
+} CadastroLeitores;
+
+/**
+ * Cria um cadastro de leitores vazio
+ * Retorna: Ponteiro para o cadastro criado, ou NULL em caso de erro
+ */
+CadastroLeitores* criar_cadastro_leitores();
+
+/**
+ * Busca um leitor pelo nome (case-insensitive)
+ * Parâmetros:
+ *   - cadastro: Ponteiro para o cadastro
+ *   - nome: Nome do leitor
+ * Retorna: Ponteiro para o leitor, ou NULL se não cadastrado
+ */
+Leitor* buscar_leitor(CadastroLeitores* cadastro, const char* nome);
+
+/**
+ * Busca um leitor pelo identificador
+ * Parâmetros:
+ *   - cadastro: Ponteiro para o cadastro
+ *   - id: Identificador do leitor
+ * Retorna: Ponteiro para o leitor, ou NULL se não existir
+ */
+Leitor* buscar_leitor_por_id(CadastroLeitores* cadastro, int id);
+
+/**
+ * Busca um leitor pelo nome, cadastrando-o se ainda não existir
+ * Parâmetros:
+ *   - cadastro: Ponteiro para o cadastro
+ *   - nome: Nome do leitor
+ * Retorna: Ponteiro para o leitor, ou NULL em caso de erro
+ */
+Leitor* obter_leitor(CadastroLeitores* cadastro, const char* nome);
+
+/**
+ * Registra um exemplar entre os empréstimos do leitor
+ * Parâmetros:
+ *   - leitor: Ponteiro para o leitor
+ *   - exemplar: Exemplar emprestado
+ */
+void leitor_vincular_emprestimo(Leitor* leitor, Exemplar* exemplar);
+
+/**
+ * Retira um exemplar dos empréstimos do seu leitor atual (se houver)
+ * Parâmetros:
+ *   - exemplar: Exemplar devolvido
+ */
+void leitor_desvincular_emprestimo(Exemplar* exemplar);
+
+/**
+ * Registra uma solicitação da fila entre as solicitações do leitor
+ * Parâmetros:
+ *   - leitor: Ponteiro para o leitor
+ *   - solicitacao: Nó da fila de espera
+ */
+void leitor_vincular_solicitacao(Leitor* leitor, NoFila* solicitacao);
+
+/**
+ * Retira uma solicitação da lista do seu leitor (se houver)
+ * Parâmetros:
+ *   - solicitacao: Nó da fila de espera
+ */
+void leitor_desvincular_solicitacao(NoFila* solicitacao);
+
+/**
+ * Verifica se o leitor ainda pode pegar mais um livro emprestado
+ * Parâmetros:
+ *   - cadastro: Ponteiro para o cadastro
+ *   - leitor: Ponteiro para o leitor (NULL = não cadastrado)
+ * Retorna: true se está abaixo do limite de empréstimos (false sem leitor ou cadastro)
+ */
+bool leitor_pode_emprestar(CadastroLeitores* cadastro, Leitor* leitor);
+
+/**
+ * Exibe os livros emprestados e as solicitações na fila de um leitor
+ * Parâmetros:
+ *   - cadastro: Ponteiro para o cadastro
+ *   - nome: Nome do leitor
+ * Retorna: Número de livros emprestados ao leitor (-1 se não cadastrado)
+ */
+int listar_situacao_leitor(CadastroLeitores* cadastro, const char* nome);
+
+/**
+ * Libera toda a memória do cadastro (os nós de livros e da fila não são liberados)
+ * Parâmetros:
+ *   - cadastro: Ponteiro para o cadastro a ser liberado
+ */
+void liberar_cadastro_leitores(CadastroLeitores* cadastro);
+
+#endif // LEITORES_H
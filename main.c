@@ -1,5 +1,20 @@
 #include "biblioteca.h"
+#include "busca.h"
+#include "indices.h"
+#include "leitores.h"
+#include "prazos.h"
+#include "filas.h"
+#include "visoes.h"
+#include "analises.h"
+#include "consulta.h"
+#include "saida.h"
+#include "exportacao.h"
+#include "instantaneo.h"
+#include "persistencia.h"
 #include <locale.h>
+#ifdef _WIN32
+#include <windows.h>
+#endif
 
 // =============================================================================
 // PROTÓTIPOS DAS FUNÇÕES DO MENU
@@ -10,10 +25,15 @@ void menu_cadastrar_livro(Biblioteca* bib);
 void menu_emprestar_livro(Biblioteca* bib);
 void menu_devolver_livro(Biblioteca* bib);
 void menu_consultar_livros(Biblioteca* bib);
+void menu_listar_ordenado(Biblioteca* bib);
 void menu_fila_espera(Biblioteca* bib);
 void menu_historico(Biblioteca* bib);
 void menu_remover_livro(Biblioteca* bib);
+void menu_consultar_leitor(Biblioteca* bib);
+void menu_exportacao(Biblioteca* bib);
 void pausar();
+bool pedir_proxima_pagina();
+bool ler_periodo(time_t* inicio, time_t* fim);
 
 // =============================================================================
 // FUNÇÃO PRINCIPAL
@@ -21,7 +41,9 @@ void pausar();
 
 int main() {
     setlocale(LC_ALL, "pt_BR.UTF-8");
-    SetConsoleOutputCP(65001);
+#ifdef _WIN32
+    SetConsoleOutputCP(65001); // Console do Windows em UTF-8
+#endif
 
     // Inicializa o sistema
     printf("    SISTEMA DE GERENCIAMENTO DE BIBLIOTECA EM C         \n");
@@ -34,6 +56,16 @@ Biblioteca* biblioteca = inicializar_biblioteca();
         return 1;
     }
 
+    // Histórico em camadas: as operações antigas vão para arquivos compactados
+    // (apagados ao sair); o horário no nome separa execuções na mesma pasta
+    char prefixo_historico[64];
+    snprintf(prefixo_historico, sizeof(prefixo_historico), "historico_%ld", (long)time(NULL));
+    if (!historico_ativar_arquivamento(biblioteca->historico, prefixo_historico,
+                                       OPERACOES_HISTORICO_EM_MEMORIA)) {
+        printf("Aviso: Histórico ficará todo em memória (não foi possível gravar %s_*.seg).\n",
+               prefixo_historico);
+    }
+
     printf("Sistema inicializado com sucesso!\n");
     pausar();
 
@@ -41,6 +73,12 @@ Biblioteca* biblioteca = inicializar_biblioteca();
     int opcao;
 
     do {
+        // Avisa sobre empréstimos vencidos e reservas expiradas desde a última volta ao menu
+        verificar_atrasos(biblioteca);
+        verificar_reservas(biblioteca);
+        verificar_instantaneos(false);
+        verificar_fusao(biblioteca->catalogo->paginas, false);
+
         exibir_menu_principal();
         printf("Digite sua opção: ");
 
@@ -87,17 +125,29 @@ Biblioteca* biblioteca = inicializar_biblioteca();
                 break;
 
             case 9:
+                menu_consultar_leitor(biblioteca);
+                break;
+
+            case 10:
+                menu_exportacao(biblioteca);
+                break;
+
+            case 11:
                 printf("\nEncerrando sistema...\n");
+                if (instantaneos_em_andamento() > 0) {
+                    printf("Aguardando os relatórios em segundo plano...\n");
+                    verificar_instantaneos(true);
+                }
                 liberar_biblioteca(biblioteca);
                 printf("Até logo!\n");
                 break;
 
             default:
-                printf("\nOpção inválida! Escolha entre 1 e 9.\n");
+                printf("\nOpção inválida! Escolha entre 1 e 11.\n");
                 pausar();
         }
 
-    } while (opcao != 9);
+    } while (opcao != 11);
 
     return 0;
 }
@@ -120,7 +170,9 @@ void exibir_menu_principal(){
     printf("    6. Ver Histórico                                      \n");
     printf("    7. Relatório do Sistema                               \n");
     printf("    8. Remover Livro                                      \n");
-    printf("    9. Sair                                               \n");
+    printf("    9. Consultar Leitor                                   \n");
+    printf("    10. Exportar ou Importar Dados                        \n");
+    printf("    11. Sair                                              \n");
 
 }
 
@@ -174,10 +226,17 @@ Livro novo_livro;
     fgets(novo_livro.isbn, MAX_ISBN, stdin);
     novo_livro.isbn[strcspn(novo_livro.isbn, "\n")] = '\0';
 
+    // Solicita a quantidade de exemplares (padrão: 1)
+    char quantidade_str[16];
+    printf("Quantidade de exemplares (pressione ENTER para 1): ");
+    fgets(quantidade_str, sizeof(quantidade_str), stdin);
+    novo_livro.quantidade = atoi(quantidade_str);
+    if (novo_livro.quantidade < 1) {
+        novo_livro.quantidade = 1;
+    }
+
     // Define status inicial como disponível
     novo_livro.status = true;
-    strcpy(novo_livro.nome_leitor_atual, "");
-    novo_livro.data_emprestimo = 0;
 
     // Adiciona o livro ao catálogo
     if (adicionar_livro(bib->catalogo, novo_livro)) {
@@ -205,8 +264,8 @@ void menu_emprestar_livro(Biblioteca* bib) {
     char titulo[MAX_TITULO];
     char nome_leitor[MAX_NOME_LEITOR];
 
-    // Solicita o título do livro
-    printf("Título do livro: ");
+    // Solicita o título do livro (ou o ISBN, digitado ou lido pelo leitor de código de barras)
+    printf("Título ou ISBN do livro: ");
     fgets(titulo, MAX_TITULO, stdin);
     titulo[strcspn(titulo, "\n")] = '\0';
 
@@ -227,8 +286,13 @@ void menu_emprestar_livro(Biblioteca* bib) {
         return;
     }
 
-    // Realiza o empréstimo
-    int resultado = emprestar_livro(bib, titulo, nome_leitor);
+    // Realiza o empréstimo (pelo ISBN, se o valor digitado for um ISBN válido);
+    // as funções de empréstimo já exibem o resultado
+    if (normalizar_isbn(titulo) != 0) {
+        emprestar_livro_isbn(bib, titulo, nome_leitor);
+    } else {
+        emprestar_livro(bib, titulo, nome_leitor);
+    }
 
     pausar();
 }
@@ -247,8 +311,8 @@ void menu_devolver_livro(Biblioteca* bib) {
 
     char titulo[MAX_TITULO];
 
-    // Solicita o título do livro
-    printf("Título do livro a ser devolvido: ");
+    // Solicita o título do livro (ou o ISBN)
+    printf("Título ou ISBN do livro a ser devolvido: ");
     fgets(titulo, MAX_TITULO, stdin);
     titulo[strcspn(titulo, "\n")] = '\0';
 
@@ -258,8 +322,28 @@ void menu_devolver_livro(Biblioteca* bib) {
         return;
     }
 
-    // Realiza a devolução
-    int resultado = devolver_livro(bib, titulo);
+    // Realiza a devolução (pelo ISBN, se o valor digitado for um ISBN válido)
+    int resultado;
+    NoLivro* livro = NULL;
+    if (normalizar_isbn(titulo) != 0) {
+        resultado = devolver_livro_isbn(bib, titulo);
+        livro = buscar_por_isbn(bib->catalogo, titulo);
+    } else {
+        resultado = devolver_livro(bib, titulo);
+        livro = buscar_por_titulo(bib->catalogo, titulo);
+    }
+
+    // Com mais de um exemplar emprestado, o leitor identifica qual está voltando
+    if (resultado == 3 && livro != NULL) {
+        char nome_leitor[MAX_NOME_LEITOR];
+        printf("\nNome do leitor que está devolvendo: ");
+        fgets(nome_leitor, MAX_NOME_LEITOR, stdin);
+        nome_leitor[strcspn(nome_leitor, "\n")] = '\0';
+
+        if (strlen(nome_leitor) > 0) {
+            resultado = devolver_livro_leitor(bib, livro->dados.titulo, nome_leitor);
+        }
+    }
 
     pausar();
 }
@@ -278,9 +362,16 @@ void menu_consultar_livros(Biblioteca* bib) {
         printf("    1. Listar todos os livros                             \n");
         printf("    2. Buscar livro por título                            \n");
         printf("    3. Buscar livros por autor                            \n");
-        printf("    4. Listar apenas livros disponíveis                   \n");
-        printf("    5. Listar apenas livros emprestados                   \n");
-        printf("    6. Voltar ao menu principal                           \n");
+        printf("    4. Buscar por palavras-chave (título e autor)         \n");
+        printf("    5. Listar apenas livros disponíveis                   \n");
+        printf("    6. Listar apenas livros emprestados                   \n");
+        printf("    7. Buscar título aproximado (tolera erros)            \n");
+        printf("    8. Sugestões de títulos (autocompletar)               \n");
+        printf("    9. Buscar livro por ISBN                              \n");
+        printf("    10. Listar livros atrasados                           \n");
+        printf("    11. Listar em ordem (título, autor ou ano)            \n");
+        printf("    12. Consulta com filtros (ex.: disponivel e ano < 1900)\n");
+        printf("    13. Voltar ao menu principal                          \n");
         printf("Digite sua opção: ");
 
         if (scanf("%d", &opcao) != 1) {
@@ -293,11 +384,25 @@ void menu_consultar_livros(Biblioteca* bib) {
 
         char busca[MAX_TITULO];
         NoLivro* resultado;
+        ResultadoAproximado aproximados[MAX_RESULTADOS_BUSCA];
+        ResultadoRanqueado ranqueados[MAX_RESULTADOS_BUSCA];
+        NoLivro* sugestoes[MAX_SUGESTOES];
+        int encontrados;
+        CursorListagem cursor;
+        char consulta[MAX_CONSULTA];
 
         switch (opcao) {
             case 1:
-                listar_todos_livros(bib->catalogo);
-                pausar();
+                // Uma página por vez; o cursor sobrevive a cadastros e remoções
+                catalogo_abrir_cursor(bib->catalogo, &cursor);
+                encontrados = listar_livros_pagina(bib->catalogo, &cursor, TAMANHO_PAGINA);
+                while (encontrados == TAMANHO_PAGINA && pedir_proxima_pagina()) {
+                    encontrados = listar_livros_pagina(bib->catalogo, &cursor, TAMANHO_PAGINA);
+                }
+                catalogo_fechar_cursor(bib->catalogo, &cursor);
+                if (encontrados < TAMANHO_PAGINA) {
+                    pausar();
+                }
                 break;
 
             case 2:
@@ -313,14 +418,8 @@ void menu_consultar_livros(Biblioteca* bib) {
                     printf("Autor: %s\n", resultado->dados.autor);
                     printf("Ano: %d\n", resultado->dados.ano_publicacao);
                     printf("ISBN: %s\n", strlen(resultado->dados.isbn) > 0 ? resultado->dados.isbn : "N/A");
-                    printf("Status: %s\n", resultado->dados.status ? "Disponível" : "Emprestado");
-
-                    if (!resultado->dados.status) {
-                        char data_str[30];
-                        formatar_data(resultado->dados.data_emprestimo, data_str, sizeof(data_str));
-                        printf("Emprestado para: %s (em %s)\n",
-                               resultado->dados.nome_leitor_atual, data_str);
-                    }
+                    printf("Status: %s\n", resultado->dados.status ? "Disponível" : "Indisponível");
+                    exibir_exemplares(resultado);
                 } else {
                     printf("\nLivro não encontrado!\n");
                 }
@@ -337,25 +436,199 @@ void menu_consultar_livros(Biblioteca* bib) {
                 break;
 
             case 4:
-                listar_livros_disponiveis(bib->catalogo);
+                printf("\nPalavras-chave (ex.: historia brasil): ");
+                fgets(busca, MAX_TITULO, stdin);
+                busca[strcspn(busca, "\n")] = '\0';
+
+                encontrados = buscar_por_palavras_chave(bib->catalogo, busca,
+                                                        ranqueados, MAX_RESULTADOS_BUSCA);
+
+                if (encontrados == 0) {
+                    printf("\nNenhum livro encontrado para '%s'.\n", busca);
+                } else {
+                    printf("\n=== RESULTADOS PARA '%s' (mais relevantes primeiro) ===\n", busca);
+                    for (int i = 0; i < encontrados; i++) {
+                        printf("\n[%d] Título: %s\n", i + 1, ranqueados[i].livro->dados.titulo);
+                        printf("    Autor: %s\n", ranqueados[i].livro->dados.autor);
+                        printf("    Status: %s\n",
+                               ranqueados[i].livro->dados.status ? "Disponível" : "Indisponível");
+                        printf("    Relevância: %.2f\n", ranqueados[i].pontuacao);
+                    }
+                }
                 pausar();
                 break;
 
             case 5:
-                listar_livros_emprestados(bib->catalogo);
+                listar_livros_disponiveis(bib->catalogo);
                 pausar();
                 break;
 
             case 6:
+                listar_livros_emprestados(bib->catalogo);
+                pausar();
+                break;
+
+            case 7:
+                printf("\nTítulo do livro (aproximado): ");
+                fgets(busca, MAX_TITULO, stdin);
+                busca[strcspn(busca, "\n")] = '\0';
+
+                encontrados = buscar_titulo_aproximado(bib->catalogo, busca, DISTANCIA_PADRAO,
+                                                       aproximados, MAX_RESULTADOS_BUSCA);
+
+                if (encontrados == 0) {
+                    printf("\nNenhum título parecido com '%s' foi encontrado.\n", busca);
+                } else {
+                    printf("\n=== TÍTULOS PARECIDOS COM '%s' ===\n", busca);
+                    for (int i = 0; i < encontrados; i++) {
+                        printf("[%d] %s (%s) - %d diferença(s)\n", i + 1,
+                               aproximados[i].livro->dados.titulo,
+                               aproximados[i].livro->dados.status ? "Disponível" : "Indisponível",
+                               aproximados[i].distancia);
+                    }
+                }
+                pausar();
+                break;
+
+            case 8:
+                printf("\nDigite o início do título: ");
+                fgets(busca, MAX_TITULO, stdin);
+                busca[strcspn(busca, "\n")] = '\0';
+
+                encontrados = sugerir_titulos(bib->catalogo, busca, sugestoes, MAX_SUGESTOES);
+
+                if (encontrados == 0) {
+                    printf("\nNenhum título começa com '%s'.\n", busca);
+                } else {
+                    printf("\n=== SUGESTÕES (mais emprestados primeiro) ===\n");
+                    for (int i = 0; i < encontrados; i++) {
+                        printf("[%d] %s - %d empréstimo(s)\n", i + 1,
+                               sugestoes[i]->dados.titulo, sugestoes[i]->total_emprestimos);
+                    }
+                }
+                pausar();
+                break;
+
+            case 9:
+                printf("\nISBN do livro: ");
+                fgets(busca, MAX_TITULO, stdin);
+                busca[strcspn(busca, "\n")] = '\0';
+
+                if (normalizar_isbn(busca) == 0) {
+                    printf("\nISBN inválido! Informe um ISBN-10 ou ISBN-13.\n");
+                    pausar();
+                    break;
+                }
+
+                resultado = buscar_por_isbn(bib->catalogo, busca);
+
+                if (resultado != NULL) {
+                    printf("\n=== LIVRO ENCONTRADO ===\n");
+                    printf("Título: %s\n", resultado->dados.titulo);
+                    printf("Autor: %s\n", resultado->dados.autor);
+                    printf("Ano: %d\n", resultado->dados.ano_publicacao);
+                    printf("ISBN: %s\n", resultado->dados.isbn);
+                    printf("Status: %s\n", resultado->dados.status ? "Disponível" : "Indisponível");
+                    exibir_exemplares(resultado);
+                } else {
+                    printf("\nNenhum livro com este ISBN!\n");
+                }
+                pausar();
+                break;
+
+            case 10:
+                listar_livros_atrasados(bib->catalogo->prazos);
+                pausar();
+                break;
+
+            case 11:
+                menu_listar_ordenado(bib);
+                break;
+
+            case 12:
+                printf("\nCampos: titulo, autor, ano, isbn, status, leitor\n");
+                printf("Operadores: = != < <= > >= ~ (contém) ^ (começa com) : (palavra)\n");
+                printf("Combine com e, ou, nao e parênteses. Ex.: disponivel e autor ~ machado e ano < 1900\n");
+                printf("Consulta: ");
+                fgets(consulta, MAX_CONSULTA, stdin);
+                consulta[strcspn(consulta, "\n")] = '\0';
+
+                exibir_consulta(bib, consulta);
+                pausar();
+                break;
+
+            case 13:
                 // Volta ao menu principal
                 break;
 
             default:
-                printf("\nOpção inválida! Escolha entre 1 e 6.\n");
+                printf("\nOpção inválida! Escolha entre 1 e 13.\n");
                 pausar();
         }
 
-    } while (opcao != 6);
+    } while (opcao != 13);
+}
+
+/**
+ * Menu: Listar o catálogo em ordem, uma página por vez
+ */
+void menu_listar_ordenado(Biblioteca* bib) {
+    printf("\n=== LISTAR EM ORDEM ===\n");
+    printf("1. Por título\n");
+    printf("2. Por autor\n");
+    printf("3. Por ano de publicação\n");
+    printf("Digite sua opção: ");
+
+    int escolha;
+    if (scanf("%d", &escolha) != 1 || escolha < 1 || escolha > 3) {
+        limpar_buffer();
+        printf("\nOpção inválida!\n");
+        pausar();
+        return;
+    }
+    limpar_buffer();
+
+    int ordem = (escolha == 1) ? ORDEM_TITULO : (escolha == 2) ? ORDEM_AUTOR : ORDEM_ANO;
+
+    // Ponto de partida opcional (busca O(log n) na visão ordenada)
+    char inicio[MAX_TITULO];
+    printf("Começar a partir de (%s, ENTER para o início): ",
+           ordem == ORDEM_ANO ? "ano" : ordem == ORDEM_AUTOR ? "autor" : "título");
+    fgets(inicio, MAX_TITULO, stdin);
+    inicio[strcspn(inicio, "\n")] = '\0';
+
+    CursorVisao cursor;
+    if (strlen(inicio) > 0) {
+        visao_cursor_buscar(&cursor, ordem, inicio, atoi(inicio));
+    } else {
+        visao_cursor_iniciar(&cursor, ordem);
+    }
+
+    NoLivro* pagina[TAMANHO_PAGINA];
+
+    while (true) {
+        int posicao = visao_posicao_cursor(bib->catalogo->visoes, &cursor);
+        int encontrados = visao_proxima_pagina(bib->catalogo->visoes, &cursor,
+                                               pagina, TAMANHO_PAGINA);
+        if (encontrados == 0) {
+            printf("\nFim da listagem.\n");
+            pausar();
+            return;
+        }
+
+        for (int i = 0; i < encontrados; i++) {
+            printf("\n[%d] Título: %s\n", posicao + i + 1, pagina[i]->dados.titulo);
+            printf("    Autor: %s\n", pagina[i]->dados.autor);
+            printf("    Ano: %d\n", pagina[i]->dados.ano_publicacao);
+            printf("    Exemplares livres: %d de %d\n",
+                   pagina[i]->total_livres, pagina[i]->dados.quantidade);
+        }
+
+        printf("\nLivros %d a %d de %d.", posicao + 1, posicao + encontrados, bib->catalogo->total);
+        if (!pedir_proxima_pagina()) {
+            return;
+        }
+    }
 }
 
 /**
@@ -370,7 +643,10 @@ void menu_fila_espera(Biblioteca* bib) {
         printf("    1. Ver fila de um livro específico                    \n");
         printf("    2. Ver todas as solicitações em espera                \n");
         printf("    3. Consultar minha posição na fila                    \n");
-        printf("    4. Voltar ao menu principal                           \n");
+        printf("    4. Ativar/desativar modo de prioridade (atual: %s)   \n",
+               bib->fila_espera->por_titulo->modo_prioridade ? "ativo" : "FIFO");
+        printf("    5. Definir classe de prioridade de um leitor          \n");
+        printf("    6. Voltar ao menu principal                           \n");
         printf("Digite sua opção: ");
 
         if (scanf("%d", &opcao) != 1) {
@@ -384,6 +660,8 @@ void menu_fila_espera(Biblioteca* bib) {
         char titulo[MAX_TITULO];
         char nome[MAX_NOME_LEITOR];
         int posicao;
+        int exibidos;
+        CursorListagem cursor;
 
         switch (opcao) {
             case 1:
@@ -396,8 +674,15 @@ void menu_fila_espera(Biblioteca* bib) {
                 break;
 
             case 2:
-                listar_todas_filas(bib->fila_espera);
-                pausar();
+                fila_abrir_cursor(bib->fila_espera, &cursor);
+                exibidos = listar_filas_pagina(bib->fila_espera, &cursor, TAMANHO_PAGINA);
+                while (exibidos == TAMANHO_PAGINA && pedir_proxima_pagina()) {
+                    exibidos = listar_filas_pagina(bib->fila_espera, &cursor, TAMANHO_PAGINA);
+                }
+                fila_fechar_cursor(bib->fila_espera, &cursor);
+                if (exibidos < TAMANHO_PAGINA) {
+                    pausar();
+                }
                 break;
 
             case 3:
@@ -421,15 +706,52 @@ void menu_fila_espera(Biblioteca* bib) {
                 break;
 
             case 4:
+                definir_modo_prioridade(bib->fila_espera,
+                                        !bib->fila_espera->por_titulo->modo_prioridade);
+
+                if (bib->fila_espera->por_titulo->modo_prioridade) {
+                    printf("\n✓ Modo prioridade ativado: docentes e leitores com necessidades\n");
+                    printf("  de acessibilidade são atendidos antes dos demais.\n");
+                } else {
+                    printf("\n✓ Modo FIFO ativado: todos são atendidos por ordem de chegada.\n");
+                }
+                pausar();
+                break;
+
+            case 5:
+                printf("\nNome do leitor: ");
+                fgets(nome, MAX_NOME_LEITOR, stdin);
+                nome[strcspn(nome, "\n")] = '\0';
+
+                if (strlen(nome) == 0) {
+                    printf("Erro: O nome do leitor não pode estar vazio!\n");
+                    pausar();
+                    break;
+                }
+
+                printf("Preferencial (docente/acessibilidade)? (s/n): ");
+                fgets(titulo, MAX_TITULO, stdin);
+
+                if (definir_prioridade_leitor(bib, nome, (titulo[0] == 's' || titulo[0] == 'S')
+                                                             ? PRIORIDADE_PREFERENCIAL
+                                                             : PRIORIDADE_GERAL)) {
+                    printf("\n✓ Classe do leitor '%s' atualizada.\n", nome);
+                } else {
+                    printf("\nErro ao atualizar a classe do leitor!\n");
+                }
+                pausar();
+                break;
+
+            case 6:
                 // Volta ao menu principal
                 break;
 
             default:
-                printf("\nOpção inválida! Escolha entre 1 e 4.\n");
+                printf("\nOpção inválida! Escolha entre 1 e 6.\n");
                 pausar();
         }
 
-    } while (opcao != 4);
+    } while (opcao != 6);
 }
 
 /**
@@ -444,7 +766,12 @@ void menu_historico(Biblioteca* bib) {
         printf("    1. Ver histórico geral (todas as operações)           \n");
         printf("    2. Ver histórico geral (últimas N operações)          \n");
         printf("    3. Ver histórico de um livro específico               \n");
-        printf("    4. Voltar ao menu principal                           \n");
+        printf("    4. Ver operações de um período                        \n");
+        printf("    5. Ver movimento por hora ou por dia                  \n");
+        printf("    6. Relatório de circulação (mais emprestados/disputados)\n");
+        printf("    7. Formato dos relatórios (atual: %s)                 \n",
+               saida_nome_formato(saida_formato_padrao()));
+        printf("    8. Voltar ao menu principal                           \n");
 
         printf("Digite sua opção: ");
 
@@ -457,12 +784,22 @@ void menu_historico(Biblioteca* bib) {
         limpar_buffer();
 
         int limite;
+        int exibidos;
         char titulo[MAX_TITULO];
+        CursorListagem cursor;
+        time_t inicio;
+        time_t fim;
 
         switch (opcao) {
             case 1:
-                exibir_historico(bib->historico, 0); // 0 = todas
-                pausar();
+                iniciar_cursor(&cursor);
+                exibidos = exibir_historico_pagina(bib->historico, &cursor, TAMANHO_PAGINA);
+                while (exibidos == TAMANHO_PAGINA && pedir_proxima_pagina()) {
+                    exibidos = exibir_historico_pagina(bib->historico, &cursor, TAMANHO_PAGINA);
+                }
+                if (exibidos < TAMANHO_PAGINA) {
+                    pausar();
+                }
                 break;
 
             case 2:
@@ -489,15 +826,71 @@ void menu_historico(Biblioteca* bib) {
                 break;
 
             case 4:
+                if (ler_periodo(&inicio, &fim)) {
+                    exibir_historico_periodo(bib->historico, inicio, fim);
+                }
+                pausar();
+                break;
+
+            case 5:
+                if (!ler_periodo(&inicio, &fim)) {
+                    pausar();
+                    break;
+                }
+
+                printf("Agrupar por (1 = hora, 2 = dia): ");
+                if (scanf("%d", &limite) != 1 || (limite != 1 && limite != 2)) {
+                    limpar_buffer();
+                    printf("Opção inválida!\n");
+                    pausar();
+                    break;
+                }
+                limpar_buffer();
+
+                exibir_movimento_historico(bib->historico, inicio, fim,
+                                           limite == 1 ? PERIODO_HORA : PERIODO_DIA);
+                pausar();
+                break;
+
+            case 6:
+                printf("\nQuantos títulos em cada ranking? ");
+                if (scanf("%d", &limite) != 1 || limite < 1) {
+                    limpar_buffer();
+                    printf("Número inválido!\n");
+                    pausar();
+                    break;
+                }
+                limpar_buffer();
+
+                exibir_relatorio_analises(bib, limite);
+                pausar();
+                break;
+
+            case 7:
+                printf("\nFormato (1 = texto, 2 = CSV, 3 = JSON): ");
+                if (scanf("%d", &limite) != 1 || limite < 1 || limite > 3) {
+                    limpar_buffer();
+                    printf("Opção inválida!\n");
+                    pausar();
+                    break;
+                }
+                limpar_buffer();
+
+                saida_definir_formato_padrao(limite == 1 ? FORMATO_TEXTO : (limite == 2 ? FORMATO_CSV : FORMATO_JSON));
+                printf("Histórico e empréstimos serão exibidos em %s.\n", saida_nome_formato(saida_formato_padrao()));
+                pausar();
+                break;
+
+            case 8:
                 // Volta ao menu principal
                 break;
 
             default:
-                printf("\nOpção inválida! Escolha entre 1 e 4.\n");
+                printf("\nOpção inválida! Escolha entre 1 e 8.\n");
                 pausar();
         }
 
-    } while (opcao != 4);
+    } while (opcao != 8);
 }
 
 /**
@@ -540,7 +933,8 @@ NoLivro* livro = buscar_por_titulo(bib->catalogo, titulo);
     printf("Título: %s\n", livro->dados.titulo);
     printf("Autor: %s\n", livro->dados.autor);
     printf("Ano: %d\n", livro->dados.ano_publicacao);
-    printf("Status: %s\n", livro->dados.status ? "Disponível" : "Emprestado");
+    printf("Status: %s\n", livro->dados.status ? "Disponível" : "Indisponível");
+    exibir_exemplares(livro);
 
     // Pede confirmação
     printf("\nATENÇÃO: Esta operação é IRREVERSÍVEL!\n");
@@ -562,10 +956,215 @@ NoLivro* livro = buscar_por_titulo(bib->catalogo, titulo);
     pausar();
 }
 
+/**
+ * Menu: Consultar leitor (livros emprestados e solicitações na fila)
+ */
+void menu_consultar_leitor(Biblioteca* bib) {
+    printf("\n=== CONSULTAR LEITOR ===\n");
+
+    char nome[MAX_NOME_LEITOR];
+
+    // Solicita o nome do leitor
+    printf("Nome do leitor: ");
+    fgets(nome, MAX_NOME_LEITOR, stdin);
+    nome[strcspn(nome, "\n")] = '\0';
+
+    if (strlen(nome) == 0) {
+        printf("Erro: O nome do leitor não pode estar vazio!\n");
+        pausar();
+        return;
+    }
+
+    listar_situacao_leitor(bib->leitores, nome);
+    pausar();
+}
+
+/**
+ * Menu: Exportar ou importar catálogo, fila e histórico (CSV ou JSON Lines)
+ * e pontos de controle incrementais do catálogo
+ */
+void menu_exportacao(Biblioteca* bib) {
+    printf("\n=== EXPORTAR OU IMPORTAR DADOS ===\n");
+    printf("1. Exportar catálogo, empréstimos, fila e histórico\n");
+    printf("2. Exportar em segundo plano (instantâneo, sem bloquear empréstimos)\n");
+    printf("3. Importar catálogo, fila e histórico\n");
+    printf("4. Gerar relatório em segundo plano (instantâneo)\n");
+    printf("5. Salvar ponto de controle do catálogo (só as páginas alteradas)\n");
+    printf("6. Recuperar catálogo de um ponto de controle\n");
+    printf("7. Voltar ao menu principal\n");
+    printf("Digite sua opção: ");
+
+    int escolha;
+    if (scanf("%d", &escolha) != 1 || escolha < 1 || escolha > 7) {
+        limpar_buffer();
+        printf("\nOpção inválida!\n");
+        pausar();
+        return;
+    }
+    limpar_buffer();
+    if (escolha == 7) {
+        return;
+    }
+
+    if (escolha == 5 || escolha == 6) {
+        char caminho[MAX_CAMINHO_PONTO_CONTROLE];
+        printf("Arquivo da imagem base (ex.: backup/catalogo.bcp): ");
+        fgets(caminho, sizeof(caminho), stdin);
+        caminho[strcspn(caminho, "\n")] = '\0';
+
+        if (strlen(caminho) == 0) {
+            printf("Erro: O arquivo não pode estar vazio!\n");
+        } else if (escolha == 5) {
+            int paginas = salvar_ponto_controle(bib->catalogo, caminho);
+            if (paginas >= 0) {
+                printf("\n✓ Ponto de controle gravado: %d páginas (%s).\n", paginas,
+                       bib->catalogo->paginas->ultimo_delta == 0 ? "imagem base" : "delta");
+            }
+        } else {
+            int titulos = recuperar_ponto_controle(bib, caminho);
+            if (titulos >= 0) {
+                printf("\n✓ Catálogo recuperado: %d livros.\n", titulos);
+            }
+        }
+        pausar();
+        return;
+    }
+
+    if (escolha == 4) {
+        int relatorio;
+        printf("Relatório (1 = sistema, 2 = livros emprestados, 3 = histórico completo): ");
+        if (scanf("%d", &relatorio) != 1 || relatorio < 1 || relatorio > 3) {
+            limpar_buffer();
+            printf("Opção inválida!\n");
+            pausar();
+            return;
+        }
+        limpar_buffer();
+
+        char caminho[MAX_CAMINHO_INSTANTANEO];
+        printf("Arquivo de destino: ");
+        fgets(caminho, sizeof(caminho), stdin);
+        caminho[strcspn(caminho, "\n")] = '\0';
+
+        if (strlen(caminho) == 0) {
+            printf("Erro: O arquivo não pode estar vazio!\n");
+        } else if (instantaneo_relatorio(bib, relatorio - 1, caminho)) {
+            printf("\n✓ Relatório iniciado em segundo plano; o aviso aparece ao voltar ao menu.\n");
+        }
+        pausar();
+        return;
+    }
+
+    int formato;
+    printf("Formato (1 = CSV, 2 = JSON Lines): ");
+    if (scanf("%d", &formato) != 1 || formato < 1 || formato > 2) {
+        limpar_buffer();
+        printf("Opção inválida!\n");
+        pausar();
+        return;
+    }
+    limpar_buffer();
+    formato = (formato == 1) ? FORMATO_CSV : FORMATO_JSON_LINHAS;
+
+    char prefixo[MAX_CAMINHO_EXPORTACAO / 2];
+    printf("Prefixo dos arquivos (ex.: backup/noite): ");
+    fgets(prefixo, sizeof(prefixo), stdin);
+    prefixo[strcspn(prefixo, "\n")] = '\0';
+
+    if (strlen(prefixo) == 0) {
+        printf("Erro: O prefixo não pode estar vazio!\n");
+        pausar();
+        return;
+    }
+
+    if (escolha == 2) {
+        if (instantaneo_exportar(bib, prefixo, formato)) {
+            printf("\n✓ Exportação iniciada em segundo plano; o aviso aparece ao voltar ao menu.\n");
+        }
+    } else if (escolha == 1) {
+        char resposta[8];
+        printf("Uma thread por arquivo? (s/n): ");
+        fgets(resposta, sizeof(resposta), stdin);
+
+        if (exportar_biblioteca(bib, prefixo, formato, resposta[0] == 's' || resposta[0] == 'S')) {
+            printf("\n✓ Dados exportados para %s_*.%s\n", prefixo, formato == FORMATO_CSV ? "csv" : "jsonl");
+        }
+    } else {
+        if (importar_biblioteca(bib, prefixo, formato)) {
+            printf("\n✓ Importação concluída: %d livros, %d solicitações, %d operações.\n",
+                   bib->catalogo->total, bib->fila_espera->total, bib->historico->total);
+        }
+    }
+    pausar();
+}
+
 /**
  * Função auxiliar: Pausa a execução até o usuário pressionar ENTER
  */
 void pausar() {
     printf("\nPressione ENTER para continuar...");
     getchar();
-}
\ No newline at end of file
+}
+
+/**
+ * Função auxiliar: Pergunta se a listagem deve seguir para a próxima página
+ * Retorna: true se o usuário pressionou ENTER, false se digitou 0
+ */
+bool pedir_proxima_pagina() {
+    char resposta[8];
+
+    printf("\nENTER para a próxima página, 0 para voltar: ");
+    if (fgets(resposta, sizeof(resposta), stdin) == NULL || resposta[0] == '0') {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Função auxiliar: Lê um período de datas (dd/mm/aaaa, ambas incluídas)
+ * Parâmetros:
+ *   - inicio: Recebe a meia-noite da data inicial
+ *   - fim: Recebe a meia-noite do dia seguinte à data final
+ * Retorna: true se as datas são válidas, false caso contrário
+ */
+bool ler_periodo(time_t* inicio, time_t* fim) {
+    char linha[32];
+    struct tm data;
+    int dia, mes, ano;
+
+    for (int i = 0; i < 2; i++) {
+        printf(i == 0 ? "\nData inicial (dd/mm/aaaa): " : "Data final (dd/mm/aaaa, ENTER = mesma): ");
+        if (fgets(linha, sizeof(linha), stdin) == NULL) {
+            return false;
+        }
+
+        if (i == 1 && (linha[0] == '\n' || linha[0] == '\0')) {
+            *fim = *inicio;
+        } else {
+            if (sscanf(linha, "%d/%d/%d", &dia, &mes, &ano) != 3 ||
+                dia < 1 || dia > 31 || mes < 1 || mes > 12 || ano < 1970) {
+                printf("Data inválida!\n");
+                return false;
+            }
+
+            memset(&data, 0, sizeof(data));
+            data.tm_mday = dia;
+            data.tm_mon = mes - 1;
+            data.tm_year = ano - 1900;
+            data.tm_isdst = -1;
+            *(i == 0 ? inicio : fim) = mktime(&data);
+        }
+    }
+
+    if (*fim < *inicio) {
+        printf("A data final é anterior à inicial!\n");
+        return false;
+    }
+
+    // A data final entra inteira: o intervalo vai até a meia-noite seguinte
+    struct tm seguinte = *localtime(fim);
+    seguinte.tm_mday++;
+    seguinte.tm_isdst = -1;
+    *fim = mktime(&seguinte);
+    return true;
+}
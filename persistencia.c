@@ -0,0 +1,989 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: persistencia.c
+ * Descrição: Implementação dos pontos de controle incrementais do catálogo
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L // pthreads e fsync() com -std=c99
+
+#include "persistencia.h"
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#ifdef _WIN32
+#include <io.h>
+#define fsync(descritor) _commit(descritor)
+#endif
+
+#define MARCA_BASE "BCPB"           // Início da imagem base
+#define MARCA_DELTA "BCPD"          // Início de um delta
+#define TAMANHO_MARCA 4
+#define PAGINA_FINAL 0xFFFFFFFFu    // Número da página que encerra o arquivo
+
+#define EXEMPLAR_EMPRESTADO 1       // Situação gravada: exemplar com um leitor
+#define EXEMPLAR_SEPARADO 2         // Situação gravada: exemplar separado para a fila
+
+/**
+ * Bytes de uma página (montada antes de gravar, ou lida antes de decodificar)
+ */
+typedef struct BufferPagina {
+    unsigned char* dados;       // Conteúdo
+    size_t tamanho;             // Bytes usados
+    size_t capacidade;          // Bytes alocados
+    size_t posicao;             // Próximo byte a decodificar
+} BufferPagina;
+
+/**
+ * Arquivo aberto em uma fusão ou recuperação, posicionado em uma página
+ */
+typedef struct EntradaPontoControle {
+    FILE* arquivo;              // Imagem base ou delta
+    uint32_t pagina;            // Página atual (PAGINA_FINAL = fim do arquivo)
+    uint32_t tamanho;           // Tamanho do conteúdo da página atual
+    bool pendente;              // Conteúdo ainda não lido (será pulado ao avançar)
+} EntradaPontoControle;
+
+/**
+ * Imagem base e deltas abertos juntos, do mais antigo ao mais novo
+ */
+typedef struct ConjuntoPontoControle {
+    EntradaPontoControle entradas[MAX_DELTAS_FUSAO + 1]; // [0] = imagem base
+    int total;                  // Arquivos abertos
+    uint64_t geracao;           // Geração da imagem base
+    int numero_base;            // Último delta incorporado à imagem base
+    int ultimo_delta;           // Último delta aberto
+    int usadas;                 // Maior total de vagas usadas entre os arquivos
+} ConjuntoPontoControle;
+
+/**
+ * Fusão em segundo plano
+ */
+struct FusaoDeltas {
+    char caminho[MAX_CAMINHO_PONTO_CONTROLE]; // Imagem base
+    int ate_delta;              // Último delta a fundir
+    bool sucesso;               // Nova imagem base gravada
+    bool terminou;              // A thread já acabou (protegido pela trava)
+    pthread_mutex_t trava;      // Protege terminou
+    pthread_t thread;           // Thread da fusão
+};
+
+// =============================================================================
+// CODIFICAÇÃO DAS PÁGINAS
+// =============================================================================
+
+/**
+ * Garante espaço para mais bytes no buffer
+ */
+static bool reservar_buffer(BufferPagina* buffer, size_t extra) {
+    if (buffer->tamanho + extra <= buffer->capacidade) {
+        return true;
+    }
+
+    size_t capacidade = buffer->capacidade > 0 ? buffer->capacidade : 4096;
+    while (capacidade < buffer->tamanho + extra) {
+        capacidade *= 2;
+    }
+    unsigned char* dados = (unsigned char*)realloc(buffer->dados, capacidade);
+    if (dados == NULL) {
+        return false;
+    }
+    buffer->dados = dados;
+    buffer->capacidade = capacidade;
+    return true;
+}
+
+/**
+ * Acrescenta um inteiro de 'bytes' bytes (little-endian)
+ */
+static bool escrever_inteiro(BufferPagina* buffer, uint64_t valor, int bytes) {
+    if (!reservar_buffer(buffer, (size_t)bytes)) {
+        return false;
+    }
+    for (int i = 0; i < bytes; i++) {
+        buffer->dados[buffer->tamanho++] = (unsigned char)(valor >> (8 * i));
+    }
+    return true;
+}
+
+/**
+ * Acrescenta um texto curto (tamanho em um byte)
+ */
+static bool escrever_texto(BufferPagina* buffer, const char* texto) {
+    size_t tamanho = strlen(texto);
+    if (tamanho > 255 || !escrever_inteiro(buffer, tamanho, 1) || !reservar_buffer(buffer, tamanho)) {
+        return false;
+    }
+    memcpy(buffer->dados + buffer->tamanho, texto, tamanho);
+    buffer->tamanho += tamanho;
+    return true;
+}
+
+/**
+ * Lê um inteiro de 'bytes' bytes (false se a página acabou antes)
+ */
+static bool ler_inteiro(BufferPagina* buffer, int bytes, uint64_t* valor) {
+    if (buffer->posicao + (size_t)bytes > buffer->tamanho) {
+        return false;
+    }
+    *valor = 0;
+    for (int i = 0; i < bytes; i++) {
+        *valor |= (uint64_t)buffer->dados[buffer->posicao++] << (8 * i);
+    }
+    return true;
+}
+
+/**
+ * Lê um texto curto para um campo de tamanho fixo
+ */
+static bool ler_texto(BufferPagina* buffer, char* destino, size_t maximo) {
+    uint64_t tamanho;
+    if (!ler_inteiro(buffer, 1, &tamanho) || tamanho >= maximo ||
+        buffer->posicao + tamanho > buffer->tamanho) {
+        return false;
+    }
+    memcpy(destino, buffer->dados + buffer->posicao, tamanho);
+    destino[tamanho] = '\0';
+    buffer->posicao += tamanho;
+    return true;
+}
+
+/**
+ * Monta o conteúdo de uma página: títulos ocupados, com a situação de cada exemplar
+ */
+static bool codificar_pagina(PaginasCatalogo* paginas, int pagina, BufferPagina* buffer) {
+    int primeira = pagina * LIVROS_POR_PAGINA;
+    int titulos = 0;
+
+    buffer->tamanho = 0;
+    for (int i = 0; i < LIVROS_POR_PAGINA && primeira + i < paginas->usadas; i++) {
+        if (paginas->vagas[primeira + i] != NULL) {
+            titulos++;
+        }
+    }
+    if (!escrever_inteiro(buffer, (uint64_t)titulos, 2)) {
+        return false;
+    }
+
+    for (int i = 0; i < LIVROS_POR_PAGINA && primeira + i < paginas->usadas; i++) {
+        NoLivro* livro = paginas->vagas[primeira + i];
+        if (livro == NULL) continue;
+
+        bool ok = escrever_inteiro(buffer, (uint64_t)i, 1) &&
+                  escrever_texto(buffer, livro->dados.titulo) &&
+                  escrever_texto(buffer, livro->dados.autor) &&
+                  escrever_texto(buffer, livro->dados.isbn) &&
+                  escrever_inteiro(buffer, (uint32_t)livro->dados.ano_publicacao, 4) &&
+                  escrever_inteiro(buffer, (uint32_t)livro->dados.quantidade, 4) &&
+                  escrever_inteiro(buffer, (uint32_t)livro->total_emprestimos, 4) &&
+                  escrever_inteiro(buffer, (uint64_t)livro->soma_duracoes, 8) &&
+                  escrever_inteiro(buffer, (uint32_t)livro->total_devolucoes, 4);
+
+        for (int e = 0; ok && e < livro->dados.quantidade; e++) {
+            Exemplar* exemplar = &livro->exemplares[e];
+            if (!exemplar->status) {
+                ok = escrever_inteiro(buffer, EXEMPLAR_EMPRESTADO, 1) &&
+                     escrever_texto(buffer, exemplar->nome_leitor_atual) &&
+                     escrever_inteiro(buffer, (uint64_t)exemplar->data_emprestimo, 8) &&
+                     escrever_inteiro(buffer, (uint64_t)exemplar->data_devolucao_prevista, 8);
+            } else if (strlen(exemplar->nome_reserva) > 0) {
+                ok = escrever_inteiro(buffer, EXEMPLAR_SEPARADO, 1) &&
+                     escrever_texto(buffer, exemplar->nome_reserva) &&
+                     escrever_inteiro(buffer, (uint64_t)exemplar->fim_reserva, 8);
+            } else {
+                ok = escrever_inteiro(buffer, 0, 1);
+            }
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// CRIAÇÃO E MARCAÇÃO DAS PÁGINAS
+// =============================================================================
+
+/**
+ * Cria o controle de páginas de um catálogo vazio
+ */
+PaginasCatalogo* criar_paginas_catalogo() {
+    PaginasCatalogo* paginas = (PaginasCatalogo*)calloc(1, sizeof(PaginasCatalogo));
+    if (paginas == NULL) {
+        printf("Erro: Falha ao alocar memória para as páginas do catálogo!\n");
+        return NULL;
+    }
+    return paginas;
+}
+
+/**
+ * Libera o controle de páginas (espera a fusão em andamento, se houver)
+ */
+void liberar_paginas_catalogo(PaginasCatalogo* paginas) {
+    if (paginas == NULL) return;
+
+    verificar_fusao(paginas, true);
+    free(paginas->vagas);
+    free(paginas->vazias);
+    free(paginas->sujas);
+    free(paginas);
+}
+
+/**
+ * Aumenta as vagas até caber a vaga indicada
+ */
+static bool garantir_vaga(PaginasCatalogo* paginas, int vaga) {
+    if (vaga < paginas->capacidade) {
+        return true;
+    }
+
+    int capacidade = paginas->capacidade > 0 ? paginas->capacidade : LIVROS_POR_PAGINA * 64;
+    while (capacidade <= vaga) {
+        capacidade *= 2;
+    }
+    int palavras_antes = paginas->capacidade / LIVROS_POR_PAGINA / 64;
+    int palavras = capacidade / LIVROS_POR_PAGINA / 64;
+
+    NoLivro** vagas = (NoLivro**)realloc(paginas->vagas, capacidade * sizeof(NoLivro*));
+    if (vagas == NULL) {
+        return false;
+    }
+    paginas->vagas = vagas;
+    int* vazias = (int*)realloc(paginas->vazias, capacidade * sizeof(int));
+    if (vazias == NULL) {
+        return false;
+    }
+    paginas->vazias = vazias;
+    uint64_t* sujas = (uint64_t*)realloc(paginas->sujas, palavras * sizeof(uint64_t));
+    if (sujas == NULL) {
+        return false;
+    }
+    paginas->sujas = sujas;
+
+    memset(vagas + paginas->capacidade, 0, (capacidade - paginas->capacidade) * sizeof(NoLivro*));
+    memset(sujas + palavras_antes, 0, (palavras - palavras_antes) * sizeof(uint64_t));
+    paginas->capacidade = capacidade;
+    return true;
+}
+
+/**
+ * Marca como suja a página de um título alterado (O(1))
+ */
+void paginas_marcar(PaginasCatalogo* paginas, const NoLivro* livro) {
+    if (paginas == NULL || livro == NULL || livro->vaga < 0) return;
+
+    int pagina = livro->vaga / LIVROS_POR_PAGINA;
+    uint64_t bit = (uint64_t)1 << (pagina % 64);
+    if ((paginas->sujas[pagina / 64] & bit) == 0) {
+        paginas->sujas[pagina / 64] |= bit;
+        paginas->total_sujas++;
+    }
+}
+
+/**
+ * Coloca um título novo em uma vaga (a última esvaziada, ou uma nova no fim)
+ */
+bool paginas_inserir(PaginasCatalogo* paginas, NoLivro* livro) {
+    if (paginas == NULL || paginas->recuperando) {
+        return true;
+    }
+
+    int vaga;
+    if (paginas->total_vazias > 0) {
+        vaga = paginas->vazias[--paginas->total_vazias];
+    } else {
+        if (!garantir_vaga(paginas, paginas->usadas)) {
+            return false;
+        }
+        vaga = paginas->usadas++;
+    }
+
+    paginas->vagas[vaga] = livro;
+    livro->vaga = vaga;
+    paginas_marcar(paginas, livro);
+    return true;
+}
+
+/**
+ * Esvazia a vaga de um título removido
+ */
+void paginas_remover(PaginasCatalogo* paginas, NoLivro* livro) {
+    if (paginas == NULL || livro == NULL || livro->vaga < 0) return;
+
+    paginas_marcar(paginas, livro);
+    paginas->vagas[livro->vaga] = NULL;
+    paginas->vazias[paginas->total_vazias++] = livro->vaga;
+    livro->vaga = -1;
+}
+
+// =============================================================================
+// ARQUIVOS
+// =============================================================================
+
+/**
+ * Monta o caminho de um delta (C.delta.N)
+ */
+static bool caminho_delta(char* destino, const char* caminho, int numero) {
+    int tamanho = snprintf(destino, MAX_CAMINHO_PONTO_CONTROLE + 32, "%s.delta.%d", caminho, numero);
+    return tamanho > 0 && tamanho < MAX_CAMINHO_PONTO_CONTROLE + 32;
+}
+
+/**
+ * Grava o cabeçalho de um arquivo de ponto de controle
+ */
+static bool escrever_cabecalho(FILE* arquivo, const char* marca, uint64_t geracao,
+                               int numero, int usadas, BufferPagina* buffer) {
+    buffer->tamanho = 0;
+    if (!reservar_buffer(buffer, TAMANHO_MARCA)) {
+        return false;
+    }
+    memcpy(buffer->dados, marca, TAMANHO_MARCA);
+    buffer->tamanho = TAMANHO_MARCA;
+    return escrever_inteiro(buffer, geracao, 8) &&
+           escrever_inteiro(buffer, (uint32_t)numero, 4) &&
+           escrever_inteiro(buffer, (uint32_t)usadas, 4) &&
+           fwrite(buffer->dados, 1, buffer->tamanho, arquivo) == buffer->tamanho;
+}
+
+/**
+ * Grava uma página (número, tamanho e conteúdo)
+ */
+static bool escrever_pagina(FILE* arquivo, uint32_t pagina, const unsigned char* dados, uint32_t tamanho) {
+    unsigned char cabecalho[8];
+    for (int i = 0; i < 4; i++) {
+        cabecalho[i] = (unsigned char)(pagina >> (8 * i));
+        cabecalho[4 + i] = (unsigned char)(tamanho >> (8 * i));
+    }
+    return fwrite(cabecalho, 1, sizeof(cabecalho), arquivo) == sizeof(cabecalho) &&
+           (tamanho == 0 || fwrite(dados, 1, tamanho, arquivo) == tamanho);
+}
+
+/**
+ * Encerra um arquivo gravado com nome temporário: página final, fsync e rename
+ */
+static bool concluir_arquivo(FILE* arquivo, const char* temporario, const char* destino) {
+    bool ok = escrever_pagina(arquivo, PAGINA_FINAL, NULL, 0) && fflush(arquivo) == 0 &&
+              fsync(fileno(arquivo)) == 0;
+    if (fclose(arquivo) != 0) {
+        ok = false;
+    }
+    if (ok && rename(temporario, destino) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        printf("Erro: Não foi possível gravar '%s' (%s)!\n", destino, strerror(errno));
+        remove(temporario);
+    }
+    return ok;
+}
+
+/**
+ * Lê o cabeçalho de um arquivo de ponto de controle
+ */
+static bool ler_cabecalho(FILE* arquivo, const char* marca, uint64_t* geracao, int* numero, int* usadas) {
+    unsigned char dados[TAMANHO_MARCA + 16];
+    if (fread(dados, 1, sizeof(dados), arquivo) != sizeof(dados) ||
+        memcmp(dados, marca, TAMANHO_MARCA) != 0) {
+        return false;
+    }
+
+    BufferPagina buffer = {dados, sizeof(dados), sizeof(dados), TAMANHO_MARCA};
+    uint64_t valor_numero, valor_usadas;
+    if (!ler_inteiro(&buffer, 8, geracao) || !ler_inteiro(&buffer, 4, &valor_numero) ||
+        !ler_inteiro(&buffer, 4, &valor_usadas)) {
+        return false;
+    }
+    *numero = (int)(int32_t)valor_numero;
+    *usadas = (int)(int32_t)valor_usadas;
+    return *numero >= 0 && *usadas >= 0;
+}
+
+/**
+ * Avança uma entrada para a próxima página (pulando o conteúdo não lido)
+ */
+static bool avancar_entrada(EntradaPontoControle* entrada) {
+    if (entrada->pendente && entrada->tamanho > 0 &&
+        fseek(entrada->arquivo, (long)entrada->tamanho, SEEK_CUR) != 0) {
+        return false;
+    }
+
+    unsigned char cabecalho[8];
+    if (fread(cabecalho, 1, sizeof(cabecalho), entrada->arquivo) != sizeof(cabecalho)) {
+        return false;
+    }
+    uint32_t pagina = 0, tamanho = 0;
+    for (int i = 0; i < 4; i++) {
+        pagina |= (uint32_t)cabecalho[i] << (8 * i);
+        tamanho |= (uint32_t)cabecalho[4 + i] << (8 * i);
+    }
+
+    // As páginas vêm em ordem crescente
+    if (pagina != PAGINA_FINAL && entrada->pagina != PAGINA_FINAL && pagina <= entrada->pagina) {
+        return false;
+    }
+    entrada->pagina = pagina;
+    entrada->tamanho = tamanho;
+    entrada->pendente = pagina != PAGINA_FINAL;
+    return true;
+}
+
+/**
+ * Fecha todos os arquivos de um conjunto
+ */
+static void fechar_conjunto(ConjuntoPontoControle* conjunto) {
+    for (int i = 0; i < conjunto->total; i++) {
+        fclose(conjunto->entradas[i].arquivo);
+    }
+    conjunto->total = 0;
+}
+
+/**
+ * Abre a imagem base e os deltas seguintes da mesma geração (até ate_delta, ou
+ * todos com ate_delta < 0), já posicionados na primeira página
+ */
+static bool abrir_conjunto(ConjuntoPontoControle* conjunto, const char* caminho, int ate_delta) {
+    char nome[MAX_CAMINHO_PONTO_CONTROLE + 32];
+
+    conjunto->total = 0;
+    FILE* base = fopen(caminho, "rb");
+    if (base == NULL) {
+        printf("Erro: Não foi possível abrir '%s' (%s)!\n", caminho, strerror(errno));
+        return false;
+    }
+    if (!ler_cabecalho(base, MARCA_BASE, &conjunto->geracao, &conjunto->numero_base, &conjunto->usadas)) {
+        printf("Erro: '%s' não é um ponto de controle do catálogo!\n", caminho);
+        fclose(base);
+        return false;
+    }
+    conjunto->entradas[0].arquivo = base;
+    conjunto->total = 1;
+    conjunto->ultimo_delta = conjunto->numero_base;
+
+    // Deltas contíguos: o primeiro que falta (ou é de outra geração) encerra a sequência
+    for (int numero = conjunto->numero_base + 1;
+         conjunto->total <= MAX_DELTAS_FUSAO && (ate_delta < 0 || numero <= ate_delta); numero++) {
+        if (!caminho_delta(nome, caminho, numero)) break;
+        FILE* delta = fopen(nome, "rb");
+        if (delta == NULL) break;
+
+        uint64_t geracao;
+        int numero_lido, usadas;
+        if (!ler_cabecalho(delta, MARCA_DELTA, &geracao, &numero_lido, &usadas) ||
+            geracao != conjunto->geracao || numero_lido != numero) {
+            fclose(delta);
+            break;
+        }
+        conjunto->entradas[conjunto->total++].arquivo = delta;
+        conjunto->ultimo_delta = numero;
+        if (usadas > conjunto->usadas) {
+            conjunto->usadas = usadas;
+        }
+    }
+
+    for (int i = 0; i < conjunto->total; i++) {
+        EntradaPontoControle* entrada = &conjunto->entradas[i];
+        entrada->pagina = PAGINA_FINAL;
+        entrada->pendente = false;
+        if (!avancar_entrada(entrada)) {
+            printf("Erro: Ponto de controle '%s' corrompido!\n", caminho);
+            fechar_conjunto(conjunto);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Próxima página do conjunto, na versão do arquivo mais novo que a contém
+ * Retorna: 1 com a página em buffer, 0 no fim, -1 se algum arquivo está corrompido
+ */
+static int proxima_pagina(ConjuntoPontoControle* conjunto, uint32_t* pagina, BufferPagina* buffer) {
+    uint32_t menor = PAGINA_FINAL;
+    int mais_nova = -1;
+
+    for (int i = 0; i < conjunto->total; i++) {
+        if (conjunto->entradas[i].pagina <= menor && conjunto->entradas[i].pagina != PAGINA_FINAL) {
+            menor = conjunto->entradas[i].pagina;
+            mais_nova = i; // Empate: vence o índice maior (arquivo mais novo)
+        }
+    }
+    if (mais_nova < 0) {
+        return 0;
+    }
+
+    EntradaPontoControle* entrada = &conjunto->entradas[mais_nova];
+    buffer->tamanho = 0;
+    buffer->posicao = 0;
+    if (!reservar_buffer(buffer, entrada->tamanho) ||
+        fread(buffer->dados, 1, entrada->tamanho, entrada->arquivo) != entrada->tamanho) {
+        return -1;
+    }
+    buffer->tamanho = entrada->tamanho;
+    entrada->pendente = false;
+    *pagina = menor;
+
+    // As versões antigas da mesma página são puladas
+    for (int i = 0; i < conjunto->total; i++) {
+        if (conjunto->entradas[i].pagina == menor && !avancar_entrada(&conjunto->entradas[i])) {
+            return -1;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Apaga deltas em sequência a partir de um número, até o primeiro que não existe
+ * (ou até o último indicado, se ate_delta >= 0)
+ */
+static void apagar_deltas(const char* caminho, int de_delta, int ate_delta) {
+    char nome[MAX_CAMINHO_PONTO_CONTROLE + 32];
+    for (int numero = de_delta; ate_delta < 0 || numero <= ate_delta; numero++) {
+        if (!caminho_delta(nome, caminho, numero) || (remove(nome) != 0 && ate_delta < 0)) {
+            break;
+        }
+    }
+}
+
+// =============================================================================
+// FUSÃO DOS DELTAS
+// =============================================================================
+
+/**
+ * Funde à imagem base os deltas até o número indicado
+ */
+bool fundir_deltas(const char* caminho, int ate_delta) {
+    ConjuntoPontoControle* conjunto = (ConjuntoPontoControle*)malloc(sizeof(ConjuntoPontoControle));
+    if (conjunto == NULL) {
+        return false;
+    }
+    if (!abrir_conjunto(conjunto, caminho, ate_delta)) {
+        free(conjunto);
+        return false;
+    }
+    if (conjunto->total == 1) {
+        // Nenhum delta novo (outra fusão já os incorporou)
+        fechar_conjunto(conjunto);
+        free(conjunto);
+        return true;
+    }
+
+    char temporario[MAX_CAMINHO_PONTO_CONTROLE + 32];
+    snprintf(temporario, sizeof(temporario), "%s.fusao.tmp", caminho);
+    FILE* arquivo = fopen(temporario, "wb");
+    if (arquivo == NULL) {
+        printf("Erro: Não foi possível criar '%s' (%s)!\n", temporario, strerror(errno));
+        fechar_conjunto(conjunto);
+        free(conjunto);
+        return false;
+    }
+
+    BufferPagina buffer = {NULL, 0, 0, 0};
+    bool ok = escrever_cabecalho(arquivo, MARCA_BASE, conjunto->geracao, conjunto->ultimo_delta,
+                                 conjunto->usadas, &buffer);
+    uint32_t pagina;
+    int resultado;
+    while (ok && (resultado = proxima_pagina(conjunto, &pagina, &buffer)) != 0) {
+        if (resultado < 0) {
+            printf("Erro: Ponto de controle '%s' corrompido!\n", caminho);
+            ok = false;
+            break;
+        }
+        // Páginas que ficaram sem títulos não precisam ir para a imagem base
+        bool vazia = buffer.tamanho >= 2 && buffer.dados[0] == 0 && buffer.dados[1] == 0;
+        if (!vazia) {
+            ok = escrever_pagina(arquivo, pagina, buffer.dados, (uint32_t)buffer.tamanho);
+        }
+    }
+    free(buffer.dados);
+
+    int numero_base = conjunto->numero_base;
+    int ultimo_delta = conjunto->ultimo_delta;
+    fechar_conjunto(conjunto);
+    free(conjunto);
+
+    if (!ok) {
+        fclose(arquivo);
+        remove(temporario);
+        return false;
+    }
+    if (!concluir_arquivo(arquivo, temporario, caminho)) {
+        return false;
+    }
+
+    // A nova imagem base já registra que incorporou esses deltas: se o programa
+    // parar antes de apagá-los, a recuperação simplesmente os ignora
+    apagar_deltas(caminho, numero_base + 1, ultimo_delta);
+    return true;
+}
+
+/**
+ * Corpo da thread de fusão
+ */
+static void* executar_fusao(void* argumento) {
+    struct FusaoDeltas* fusao = (struct FusaoDeltas*)argumento;
+    bool sucesso = fundir_deltas(fusao->caminho, fusao->ate_delta);
+
+    pthread_mutex_lock(&fusao->trava);
+    fusao->sucesso = sucesso;
+    fusao->terminou = true;
+    pthread_mutex_unlock(&fusao->trava);
+    return NULL;
+}
+
+/**
+ * Começa a fundir em segundo plano os deltas gravados até agora
+ */
+static void iniciar_fusao(PaginasCatalogo* paginas) {
+    struct FusaoDeltas* fusao = (struct FusaoDeltas*)calloc(1, sizeof(struct FusaoDeltas));
+    if (fusao == NULL) {
+        return; // Fica para o próximo ponto de controle
+    }
+    strcpy(fusao->caminho, paginas->caminho);
+    fusao->ate_delta = paginas->ultimo_delta;
+    pthread_mutex_init(&fusao->trava, NULL);
+
+    paginas->fusao = fusao;
+    if (pthread_create(&fusao->thread, NULL, executar_fusao, fusao) != 0) {
+        // Sem thread: funde aqui mesmo e recolhe o resultado na hora
+        executar_fusao(fusao);
+        verificar_fusao(paginas, true);
+    }
+}
+
+/**
+ * Recolhe a fusão em segundo plano, se já terminou
+ */
+bool verificar_fusao(PaginasCatalogo* paginas, bool aguardar) {
+    if (paginas == NULL || paginas->fusao == NULL) {
+        return true;
+    }
+
+    struct FusaoDeltas* fusao = paginas->fusao;
+    pthread_mutex_lock(&fusao->trava);
+    bool terminou = fusao->terminou;
+    pthread_mutex_unlock(&fusao->trava);
+    if (!terminou && !aguardar) {
+        return false;
+    }
+
+    pthread_join(fusao->thread, NULL);
+    if (fusao->sucesso) {
+        if (fusao->ate_delta > paginas->deltas_na_base) {
+            paginas->deltas_na_base = fusao->ate_delta;
+        }
+    } else {
+        printf("\nErro: Falha ao fundir os deltas de '%s' (tentando de novo no próximo ponto de controle)!\n",
+               fusao->caminho);
+    }
+    pthread_mutex_destroy(&fusao->trava);
+    free(fusao);
+    paginas->fusao = NULL;
+    return true;
+}
+
+// =============================================================================
+// PONTOS DE CONTROLE
+// =============================================================================
+
+/**
+ * Nova geração para uma imagem base (distingue os deltas de bases anteriores)
+ */
+static uint64_t nova_geracao() {
+    static uint64_t contador = 0;
+    uint64_t geracao = ((uint64_t)time(NULL) << 24) ^ ((uint64_t)getpid() << 8) ^ ++contador;
+    return geracao != 0 ? geracao : 1;
+}
+
+/**
+ * Grava um ponto de controle do catálogo
+ */
+int salvar_ponto_controle(ListaLivros* lista, const char* caminho) {
+    if (lista == NULL || lista->paginas == NULL || caminho == NULL) {
+        return -1;
+    }
+    if (strlen(caminho) >= MAX_CAMINHO_PONTO_CONTROLE) {
+        printf("Erro: Caminho muito longo!\n");
+        return -1;
+    }
+
+    PaginasCatalogo* paginas = lista->paginas;
+    verificar_fusao(paginas, false);
+
+    bool base = paginas->geracao == 0 || strcmp(paginas->caminho, caminho) != 0;
+    if (base) {
+        // A fusão em andamento é da imagem base anterior
+        verificar_fusao(paginas, true);
+    }
+
+    char destino[MAX_CAMINHO_PONTO_CONTROLE + 32];
+    char temporario[MAX_CAMINHO_PONTO_CONTROLE + 48];
+    uint64_t geracao = base ? nova_geracao() : paginas->geracao;
+    int numero = base ? 0 : paginas->ultimo_delta + 1;
+    if (base) {
+        strcpy(destino, caminho);
+    } else if (!caminho_delta(destino, caminho, numero)) {
+        printf("Erro: Caminho muito longo!\n");
+        return -1;
+    }
+    snprintf(temporario, sizeof(temporario), "%s.tmp", destino);
+
+    FILE* arquivo = fopen(temporario, "wb");
+    if (arquivo == NULL) {
+        printf("Erro: Não foi possível criar '%s' (%s)!\n", temporario, strerror(errno));
+        return -1;
+    }
+
+    BufferPagina buffer = {NULL, 0, 0, 0};
+    bool ok = escrever_cabecalho(arquivo, base ? MARCA_BASE : MARCA_DELTA, geracao, numero,
+                                 paginas->usadas, &buffer);
+    int total_paginas = (paginas->usadas + LIVROS_POR_PAGINA - 1) / LIVROS_POR_PAGINA;
+    int gravadas = 0;
+
+    for (int pagina = 0; ok && pagina < total_paginas; pagina++) {
+        uint64_t palavra = paginas->sujas[pagina / 64];
+        if (!base && palavra == 0) {
+            pagina |= 63; // Palavra inteira limpa: pula 64 páginas
+            continue;
+        }
+        if (!base && (palavra & ((uint64_t)1 << (pagina % 64))) == 0) continue;
+
+        ok = codificar_pagina(paginas, pagina, &buffer);
+        bool vazia = buffer.tamanho == 2 && buffer.dados[0] == 0 && buffer.dados[1] == 0;
+        if (ok && !(base && vazia)) {
+            // Em um delta, uma página que ficou vazia também vai: ela apaga a versão anterior
+            ok = escrever_pagina(arquivo, (uint32_t)pagina, buffer.dados, (uint32_t)buffer.tamanho);
+            gravadas++;
+        }
+    }
+    free(buffer.dados);
+
+    if (!ok) {
+        printf("Erro: Falha ao gravar o ponto de controle '%s'!\n", destino);
+        fclose(arquivo);
+        remove(temporario);
+        return -1;
+    }
+    if (!concluir_arquivo(arquivo, temporario, destino)) {
+        return -1;
+    }
+
+    if (base) {
+        // Deltas que sobraram de uma imagem anterior com o mesmo caminho
+        apagar_deltas(caminho, 1, -1);
+        strcpy(paginas->caminho, caminho);
+        paginas->geracao = geracao;
+        paginas->deltas_na_base = 0;
+    }
+    paginas->ultimo_delta = numero;
+
+    // Só agora as páginas estão no disco
+    if (paginas->sujas != NULL) {
+        memset(paginas->sujas, 0, paginas->capacidade / LIVROS_POR_PAGINA / 64 * sizeof(uint64_t));
+    }
+    paginas->total_sujas = 0;
+
+    if (paginas->fusao == NULL && paginas->ultimo_delta - paginas->deltas_na_base >= DELTAS_PARA_FUSAO) {
+        iniciar_fusao(paginas);
+    }
+    return gravadas;
+}
+
+/**
+ * Cadastra os títulos de uma página recuperada nas suas vagas
+ */
+static int recuperar_pagina(Biblioteca* bib, uint32_t pagina, BufferPagina* buffer,
+                            Exemplar** situacao, int* capacidade_situacao) {
+    ListaLivros* lista = bib->catalogo;
+    uint64_t titulos;
+    if (!ler_inteiro(buffer, 2, &titulos) || titulos > LIVROS_POR_PAGINA) {
+        return -1;
+    }
+
+    for (uint64_t t = 0; t < titulos; t++) {
+        Livro livro;
+        uint64_t posicao, ano, quantidade, emprestimos, soma, devolucoes;
+        memset(&livro, 0, sizeof(Livro));
+        if (!ler_inteiro(buffer, 1, &posicao) || posicao >= LIVROS_POR_PAGINA ||
+            !ler_texto(buffer, livro.titulo, MAX_TITULO) ||
+            !ler_texto(buffer, livro.autor, MAX_AUTOR) ||
+            !ler_texto(buffer, livro.isbn, MAX_ISBN) ||
+            !ler_inteiro(buffer, 4, &ano) || !ler_inteiro(buffer, 4, &quantidade) ||
+            !ler_inteiro(buffer, 4, &emprestimos) || !ler_inteiro(buffer, 8, &soma) ||
+            !ler_inteiro(buffer, 4, &devolucoes) ||
+            (int32_t)quantidade < 1 || quantidade > buffer->tamanho) {
+            return -1;
+        }
+
+        // Situação de cada exemplar, lida antes de cadastrar o título
+        if ((int)quantidade > *capacidade_situacao) {
+            Exemplar* maior = (Exemplar*)realloc(*situacao, quantidade * sizeof(Exemplar));
+            if (maior == NULL) {
+                printf("Erro: Falha ao alocar memória para a recuperação!\n");
+                return -1;
+            }
+            *situacao = maior;
+            *capacidade_situacao = (int)quantidade;
+        }
+        for (uint64_t e = 0; e < quantidade; e++) {
+            Exemplar* exemplar = &(*situacao)[e];
+            uint64_t estado, data1, data2;
+            exemplar->status = true;
+            exemplar->nome_leitor_atual[0] = '\0';
+            exemplar->nome_reserva[0] = '\0';
+            if (!ler_inteiro(buffer, 1, &estado)) {
+                return -1;
+            }
+            if (estado == EXEMPLAR_EMPRESTADO) {
+                if (!ler_texto(buffer, exemplar->nome_leitor_atual, MAX_NOME_LEITOR) ||
+                    !ler_inteiro(buffer, 8, &data1) || !ler_inteiro(buffer, 8, &data2)) {
+                    return -1;
+                }
+                exemplar->status = false;
+                exemplar->data_emprestimo = (time_t)(int64_t)data1;
+                exemplar->data_devolucao_prevista = (time_t)(int64_t)data2;
+            } else if (estado == EXEMPLAR_SEPARADO) {
+                if (!ler_texto(buffer, exemplar->nome_reserva, MAX_NOME_LEITOR) ||
+                    !ler_inteiro(buffer, 8, &data1)) {
+                    return -1;
+                }
+                exemplar->fim_reserva = (time_t)(int64_t)data1;
+            } else if (estado != 0) {
+                return -1;
+            }
+        }
+
+        livro.ano_publicacao = (int)(int32_t)ano;
+        livro.quantidade = (int)quantidade;
+        livro.status = true;
+        if (!adicionar_livro(lista, livro)) {
+            return -1;
+        }
+
+        // Daqui em diante, um título pela metade sai do catálogo (com o que já foi vinculado)
+        NoLivro* novo = lista->cauda;
+        int vaga = (int)pagina * LIVROS_POR_PAGINA + (int)posicao;
+        if (!garantir_vaga(lista->paginas, vaga) || lista->paginas->vagas[vaga] != NULL) {
+            remover_livro(lista, livro.titulo);
+            return -1;
+        }
+        lista->paginas->vagas[vaga] = novo;
+        novo->vaga = vaga;
+        novo->total_emprestimos = (int)(int32_t)emprestimos;
+        novo->soma_duracoes = (long long)(int64_t)soma;
+        novo->total_devolucoes = (int)(int32_t)devolucoes;
+        if (!restaurar_situacao_livro(bib, novo, *situacao)) {
+            printf("Erro: Falha ao restaurar os empréstimos de '%s'!\n", livro.titulo);
+            remover_livro(lista, livro.titulo);
+            return -1;
+        }
+    }
+    return (int)titulos;
+}
+
+/**
+ * Reconstrói o catálogo a partir da imagem base e dos seus deltas
+ */
+int recuperar_ponto_controle(Biblioteca* bib, const char* caminho) {
+    if (bib == NULL || bib->catalogo == NULL || caminho == NULL) {
+        return -1;
+    }
+    if (strlen(caminho) >= MAX_CAMINHO_PONTO_CONTROLE) {
+        printf("Erro: Caminho muito longo!\n");
+        return -1;
+    }
+
+    ListaLivros* lista = bib->catalogo;
+    PaginasCatalogo* paginas = lista->paginas;
+    if (lista->total > 0) {
+        printf("Erro: A recuperação precisa de um catálogo vazio!\n");
+        return -1;
+    }
+
+    // Uma fusão em segundo plano apagaria deltas e disputaria o .fusao.tmp com a daqui
+    verificar_fusao(paginas, true);
+
+    ConjuntoPontoControle* conjunto = (ConjuntoPontoControle*)malloc(sizeof(ConjuntoPontoControle));
+    if (conjunto == NULL) {
+        return -1;
+    }
+
+    // Deltas demais para abrir juntos: funde os primeiros antes de ler
+    while (true) {
+        if (!abrir_conjunto(conjunto, caminho, -1)) {
+            free(conjunto);
+            return -1;
+        }
+        if (conjunto->total <= MAX_DELTAS_FUSAO) break;
+
+        int ate_delta = conjunto->ultimo_delta;
+        fechar_conjunto(conjunto);
+        if (!fundir_deltas(caminho, ate_delta)) {
+            free(conjunto);
+            return -1;
+        }
+    }
+
+    BufferPagina buffer = {NULL, 0, 0, 0};
+    Exemplar* situacao = NULL;
+    int capacidade_situacao = 0;
+    int recuperados = 0;
+    uint32_t pagina;
+    int resultado;
+
+    paginas->recuperando = true;
+    while ((resultado = proxima_pagina(conjunto, &pagina, &buffer)) > 0) {
+        int titulos = recuperar_pagina(bib, pagina, &buffer, &situacao, &capacidade_situacao);
+        if (titulos < 0) {
+            resultado = -1;
+            break;
+        }
+        recuperados += titulos;
+    }
+    paginas->recuperando = false;
+    free(buffer.dados);
+    free(situacao);
+
+    uint64_t geracao = conjunto->geracao;
+    int numero_base = conjunto->numero_base;
+    int ultimo_delta = conjunto->ultimo_delta;
+    int usadas = conjunto->usadas;
+    fechar_conjunto(conjunto);
+    free(conjunto);
+
+    // Vagas vazias no meio das usadas voltam para a pilha (as menores saem primeiro)
+    if (usadas > 0 && !garantir_vaga(paginas, usadas - 1)) {
+        return -1;
+    }
+    if (usadas > paginas->usadas) {
+        paginas->usadas = usadas;
+    }
+    paginas->total_vazias = 0;
+    for (int vaga = paginas->usadas - 1; vaga >= 0; vaga--) {
+        if (paginas->vagas[vaga] == NULL) {
+            paginas->vazias[paginas->total_vazias++] = vaga;
+        }
+    }
+
+    if (resultado < 0) {
+        // O que entrou fica no catálogo; o próximo ponto de controle começa uma imagem nova
+        printf("Erro: Ponto de controle '%s' corrompido (%d títulos recuperados)!\n", caminho, recuperados);
+        paginas->geracao = 0;
+        return -1;
+    }
+
+    // O catálogo em memória é igual ao do disco: os próximos pontos continuam a sequência
+    if (paginas->sujas != NULL) {
+        memset(paginas->sujas, 0, paginas->capacidade / LIVROS_POR_PAGINA / 64 * sizeof(uint64_t));
+    }
+    paginas->total_sujas = 0;
+    strcpy(paginas->caminho, caminho);
+    paginas->geracao = geracao;
+    paginas->deltas_na_base = numero_base;
+    paginas->ultimo_delta = ultimo_delta;
+    return recuperados;
+}
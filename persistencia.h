@@ -0,0 +1,160 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: persistencia.h
+ * Descrição: Pontos de controle incrementais do catálogo (páginas sujas,
+ *            imagem base + deltas e fusão em segundo plano)
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef PERSISTENCIA_H
+#define PERSISTENCIA_H
+
+#include "biblioteca.h"
+
+// =============================================================================
+// CONSTANTES DA PERSISTÊNCIA
+// =============================================================================
+
+#define LIVROS_POR_PAGINA 64            // Vagas de títulos em cada página
+#define DELTAS_PARA_FUSAO 8             // Deltas acumulados que disparam a fusão em segundo plano
+#define MAX_DELTAS_FUSAO 64             // Deltas abertos ao mesmo tempo em uma fusão
+#define MAX_CAMINHO_PONTO_CONTROLE 512  // Tamanho máximo do caminho da imagem base
+
+/*
+ * Arquivos de um ponto de controle com caminho C:
+ *   - C: imagem base com todas as páginas não vazias
+ *   - C.delta.N: só as páginas alteradas entre o ponto N-1 e o N
+ * Os dois começam com uma marca, a geração da imagem base (deltas de outra
+ * geração são ignorados), o número do último delta incorporado (base) ou do
+ * próprio delta e o total de vagas usadas. Em seguida vêm as páginas em ordem
+ * crescente, cada uma com número, tamanho e conteúdo (títulos da página com
+ * seus exemplares emprestados ou separados), e uma página final de número
+ * 0xFFFFFFFF. Os arquivos são gravados com outro nome e renomeados no fim,
+ * então um ponto de controle interrompido nunca é lido pela metade.
+ */
+
+// =============================================================================
+// ESTRUTURAS DA PERSISTÊNCIA
+// =============================================================================
+
+struct FusaoDeltas; // Fusão em segundo plano (definida em persistencia.c)
+
+/**
+ * Páginas do catálogo
+ * Cada título ocupa uma vaga fixa (NoLivro.vaga); a página de uma vaga é
+ * vaga / LIVROS_POR_PAGINA. Toda alteração em um título ou nos seus exemplares
+ * marca a página dele como suja, e o próximo ponto de controle grava só as
+ * páginas marcadas.
+ */
+typedef struct PaginasCatalogo {
+    NoLivro** vagas;            // Título de cada vaga (NULL = vaga vazia)
+    int capacidade;             // Vagas alocadas (múltiplo de LIVROS_POR_PAGINA)
+    int usadas;                 // Vagas já ocupadas alguma vez (as seguintes estão vazias)
+    int* vazias;                // Pilha de vagas esvaziadas por remoções
+    int total_vazias;           // Topo da pilha de vagas vazias
+    uint64_t* sujas;            // Um bit por página alterada desde o último ponto de controle
+    int total_sujas;            // Páginas marcadas em sujas
+    bool recuperando;           // Recuperação em andamento: as vagas vêm do arquivo
+    char caminho[MAX_CAMINHO_PONTO_CONTROLE]; // Imagem base dos pontos de controle
+    uint64_t geracao;           // Geração da imagem base em uso (0 = nenhuma gravada)
+    int ultimo_delta;           // Número do último delta gravado
+    int deltas_na_base;         // Deltas já incorporados à imagem base
+    struct FusaoDeltas* fusao;  // Fusão em segundo plano (NULL = nenhuma)
+} PaginasCatalogo;
+
+// =============================================================================
+// FUNÇÕES DAS PÁGINAS
+// =============================================================================
+
+/**
+ * Cria o controle de páginas de um catálogo vazio
+ * Retorna: Ponteiro para o controle criado, ou NULL em caso de erro
+ */
+PaginasCatalogo* criar_paginas_catalogo();
+
+/**
+ * Libera o controle de páginas (espera a fusão em andamento, se houver)
+ * Parâmetros:
+ *   - paginas: Ponteiro para o controle
+ */
+void liberar_paginas_catalogo(PaginasCatalogo* paginas);
+
+/**
+ * Coloca um título novo em uma vaga (a última esvaziada, ou uma nova no fim)
+ * Durante a recuperação não faz nada: a vaga vem do arquivo.
+ * Parâmetros:
+ *   - paginas: Ponteiro para o controle
+ *   - livro: Título cadastrado
+ * Retorna: true se colocado, false se faltou memória
+ */
+bool paginas_inserir(PaginasCatalogo* paginas, NoLivro* livro);
+
+/**
+ * Esvazia a vaga de um título removido
+ * Parâmetros:
+ *   - paginas: Ponteiro para o controle
+ *   - livro: Título removido
+ */
+void paginas_remover(PaginasCatalogo* paginas, NoLivro* livro);
+
+/**
+ * Marca como suja a página de um título alterado (O(1))
+ * Parâmetros:
+ *   - paginas: Ponteiro para o controle
+ *   - livro: Título alterado
+ */
+void paginas_marcar(PaginasCatalogo* paginas, const NoLivro* livro);
+
+// =============================================================================
+// FUNÇÕES DOS PONTOS DE CONTROLE
+// =============================================================================
+
+/**
+ * Grava um ponto de controle do catálogo
+ * O primeiro grava a imagem base completa; os seguintes gravam em C.delta.N só
+ * as páginas sujas. A cada DELTAS_PARA_FUSAO deltas, uma thread começa a fundi-los
+ * à imagem base.
+ * Parâmetros:
+ *   - lista: Ponteiro para o catálogo
+ *   - caminho: Caminho da imagem base
+ * Retorna: Quantidade de páginas gravadas, ou -1 em caso de erro
+ */
+int salvar_ponto_controle(ListaLivros* lista, const char* caminho);
+
+/**
+ * Reconstrói o catálogo a partir da imagem base e dos seus deltas
+ * As páginas são lidas em ordem, com a versão mais nova de cada uma; empréstimos
+ * e reservas voltam aos leitores e aos prazos. Depois da recuperação, os
+ * próximos pontos de controle continuam como deltas da mesma imagem base.
+ * Parâmetros:
+ *   - bib: Ponteiro para a biblioteca (catálogo vazio)
+ *   - caminho: Caminho da imagem base
+ * Retorna: Quantidade de títulos recuperados, ou -1 em caso de erro
+ */
+int recuperar_ponto_controle(Biblioteca* bib, const char* caminho);
+
+/**
+ * Funde à imagem base os deltas até o número indicado
+ * Só lê e grava arquivos (não toca no catálogo em memória); é o que a thread
+ * de fusão executa. Os deltas fundidos são apagados no fim.
+ * Parâmetros:
+ *   - caminho: Caminho da imagem base
+ *   - ate_delta: Último delta a fundir
+ * Retorna: true se a nova imagem base foi gravada
+ */
+bool fundir_deltas(const char* caminho, int ate_delta);
+
+/**
+ * Recolhe a fusão em segundo plano, se já terminou
+ * Parâmetros:
+ *   - paginas: Ponteiro para o controle
+ *   - aguardar: true para esperar a fusão terminar
+ * Retorna: true se não há mais fusão em andamento
+ */
+bool verificar_fusao(PaginasCatalogo* paginas, bool aguardar);
+
+#endif // PERSISTENCIA_H
@@ -0,0 +1,468 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: prazos.c
+ * Descrição: Implementação do controle de prazos de devolução e de reservas
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#include "prazos.h"
+
+// =============================================================================
+// FUNÇÕES AUXILIARES DO HEAP
+// =============================================================================
+
+/**
+ * Data prevista de devolução do exemplar na posição i do heap
+ */
+static time_t prazo_em(ControlePrazos* prazos, int i) {
+    return prazos->heap[i]->data_devolucao_prevista;
+}
+
+/**
+ * Coloca um exemplar em uma posição do heap, atualizando a posição guardada no nó
+ */
+static void colocar_no_heap(ControlePrazos* prazos, int i, Exemplar* exemplar) {
+    prazos->heap[i] = exemplar;
+    exemplar->posicao_prazo = i;
+}
+
+/**
+ * Sobe o elemento da posição i até restaurar a ordem do heap
+ */
+static void subir(ControlePrazos* prazos, int i) {
+    Exemplar* exemplar = prazos->heap[i];
+    time_t prazo = exemplar->data_devolucao_prevista;
+
+    while (i > 0) {
+        int pai = (i - 1) / 2;
+        if (prazo_em(prazos, pai) <= prazo) {
+            break;
+        }
+        colocar_no_heap(prazos, i, prazos->heap[pai]);
+        i = pai;
+    }
+    colocar_no_heap(prazos, i, exemplar);
+}
+
+/**
+ * Desce o elemento da posição i até restaurar a ordem do heap
+ */
+static void descer(ControlePrazos* prazos, int i) {
+    Exemplar* exemplar = prazos->heap[i];
+    time_t prazo = exemplar->data_devolucao_prevista;
+
+    while (true) {
+        int filho = 2 * i + 1;
+        if (filho >= prazos->total) {
+            break;
+        }
+        if (filho + 1 < prazos->total && prazo_em(prazos, filho + 1) < prazo_em(prazos, filho)) {
+            filho++;
+        }
+        if (prazo <= prazo_em(prazos, filho)) {
+            break;
+        }
+        colocar_no_heap(prazos, i, prazos->heap[filho]);
+        i = filho;
+    }
+    colocar_no_heap(prazos, i, exemplar);
+}
+
+/**
+ * Retira do heap o exemplar da posição i
+ */
+static void retirar_do_heap(ControlePrazos* prazos, int i) {
+    Exemplar* exemplar = prazos->heap[i];
+    prazos->total--;
+
+    if (i < prazos->total) {
+        // O último elemento ocupa o lugar e é reposicionado
+        colocar_no_heap(prazos, i, prazos->heap[prazos->total]);
+        subir(prazos, i);
+        descer(prazos, i);
+    }
+
+    exemplar->posicao_prazo = SEM_PRAZO;
+}
+
+/**
+ * Comparador para qsort: ordena livros pela data prevista de devolução
+ */
+static int comparar_prazos(const void* a, const void* b) {
+    time_t prazo_a = (*(Exemplar* const*)a)->data_devolucao_prevista;
+    time_t prazo_b = (*(Exemplar* const*)b)->data_devolucao_prevista;
+    return (prazo_a > prazo_b) - (prazo_a < prazo_b);
+}
+
+// =============================================================================
+// FUNÇÕES DO CONTROLE DE PRAZOS
+// =============================================================================
+
+/**
+ * Cria um controle de prazos vazio
+ */
+ControlePrazos* criar_controle_prazos() {
+    ControlePrazos* prazos = (ControlePrazos*)malloc(sizeof(ControlePrazos));
+    if (prazos == NULL) {
+        return NULL;
+    }
+
+    prazos->capacidade = CAPACIDADE_INICIAL_PRAZOS;
+    prazos->heap = (Exemplar**)malloc(prazos->capacidade * sizeof(Exemplar*));
+    if (prazos->heap == NULL) {
+        free(prazos);
+        return NULL;
+    }
+
+    prazos->total = 0;
+    prazos->atrasados_inicio = NULL;
+    prazos->atrasados_fim = NULL;
+    prazos->total_atrasados = 0;
+    return prazos;
+}
+
+/**
+ * Registra o prazo de um exemplar emprestado
+ */
+bool prazos_registrar(ControlePrazos* prazos, Exemplar* exemplar) {
+    if (prazos == NULL || exemplar == NULL) {
+        return false;
+    }
+
+    // Um exemplar tem no máximo um prazo em aberto
+    prazos_remover(prazos, exemplar);
+
+    if (prazos->total == prazos->capacidade) {
+        int nova_capacidade = prazos->capacidade * 2;
+        Exemplar** novo = (Exemplar**)realloc(prazos->heap, nova_capacidade * sizeof(Exemplar*));
+        if (novo == NULL) {
+            printf("Erro: Falha ao alocar memória para o controle de prazos!\n");
+            return false;
+        }
+        prazos->heap = novo;
+        prazos->capacidade = nova_capacidade;
+    }
+
+    colocar_no_heap(prazos, prazos->total, exemplar);
+    prazos->total++;
+    subir(prazos, prazos->total - 1);
+    return true;
+}
+
+/**
+ * Retira o prazo de um exemplar (do heap ou da lista de atrasados)
+ */
+void prazos_remover(ControlePrazos* prazos, Exemplar* exemplar) {
+    if (prazos == NULL || exemplar == NULL) return;
+
+    if (exemplar->posicao_prazo >= 0) {
+        retirar_do_heap(prazos, exemplar->posicao_prazo);
+    } else if (exemplar->posicao_prazo == PRAZO_VENCIDO) {
+        if (exemplar->anterior_atrasado != NULL) {
+            exemplar->anterior_atrasado->proximo_atrasado = exemplar->proximo_atrasado;
+        } else {
+            prazos->atrasados_inicio = exemplar->proximo_atrasado;
+        }
+        if (exemplar->proximo_atrasado != NULL) {
+            exemplar->proximo_atrasado->anterior_atrasado = exemplar->anterior_atrasado;
+        } else {
+            prazos->atrasados_fim = exemplar->anterior_atrasado;
+        }
+
+        exemplar->anterior_atrasado = NULL;
+        exemplar->proximo_atrasado = NULL;
+        exemplar->posicao_prazo = SEM_PRAZO;
+        prazos->total_atrasados--;
+    }
+}
+
+/**
+ * Varredura: move para a lista de atrasados os prazos vencidos até agora
+ */
+int prazos_varrer(ControlePrazos* prazos, time_t agora, Exemplar** vencidos, int max) {
+    if (prazos == NULL || vencidos == NULL) {
+        return 0;
+    }
+
+    int encontrados = 0;
+
+    // O menor prazo está sempre na raiz: só olha os que realmente venceram
+    while (encontrados < max && prazos->total > 0 && prazo_em(prazos, 0) <= agora) {
+        Exemplar* exemplar = prazos->heap[0];
+        retirar_do_heap(prazos, 0);
+
+        // Insere no fim da lista de atrasados (que continua ordenada pelo prazo)
+        exemplar->posicao_prazo = PRAZO_VENCIDO;
+        exemplar->proximo_atrasado = NULL;
+        exemplar->anterior_atrasado = prazos->atrasados_fim;
+        if (prazos->atrasados_fim != NULL) {
+            prazos->atrasados_fim->proximo_atrasado = exemplar;
+        } else {
+            prazos->atrasados_inicio = exemplar;
+        }
+        prazos->atrasados_fim = exemplar;
+        prazos->total_atrasados++;
+
+        vencidos[encontrados++] = exemplar;
+    }
+
+    return encontrados;
+}
+
+/**
+ * Busca os livros atrasados em ordem de vencimento
+ */
+int buscar_atrasados(ControlePrazos* prazos, time_t agora, Exemplar** resultados, int max) {
+    if (prazos == NULL || resultados == NULL || max <= 0) {
+        return 0;
+    }
+
+    int encontrados = 0;
+
+    // 1) Atrasos já notificados (vencidos até a última varredura)
+    Exemplar* atual = prazos->atrasados_inicio;
+    while (atual != NULL && encontrados < max) {
+        if (atual->data_devolucao_prevista <= agora) {
+            resultados[encontrados++] = atual;
+        }
+        atual = atual->proximo_atrasado;
+    }
+
+    if (encontrados == max || prazos->total == 0 || prazo_em(prazos, 0) > agora) {
+        qsort(resultados, encontrados, sizeof(Exemplar*), comparar_prazos);
+        return encontrados;
+    }
+
+    // 2) Prazos vencidos que ainda estão no heap: percorre só a parte do heap com
+    //    prazo <= agora, usando uma fronteira (heap auxiliar de posições) para
+    //    devolvê-los em ordem. Cada resultado custa O(log k).
+    int* fronteira = (int*)malloc((max + 2) * sizeof(int));
+    if (fronteira == NULL) {
+        return encontrados;
+    }
+
+    int tamanho = 0;
+    fronteira[tamanho++] = 0;
+
+    while (tamanho > 0 && encontrados < max) {
+        // Retira a posição de menor prazo da fronteira
+        int menor = fronteira[0];
+        fronteira[0] = fronteira[--tamanho];
+        int i = 0;
+        while (true) {
+            int filho = 2 * i + 1;
+            if (filho >= tamanho) break;
+            if (filho + 1 < tamanho &&
+                prazo_em(prazos, fronteira[filho + 1]) < prazo_em(prazos, fronteira[filho])) {
+                filho++;
+            }
+            if (prazo_em(prazos, fronteira[i]) <= prazo_em(prazos, fronteira[filho])) break;
+            int temp = fronteira[i];
+            fronteira[i] = fronteira[filho];
+            fronteira[filho] = temp;
+            i = filho;
+        }
+
+        resultados[encontrados++] = prazos->heap[menor];
+
+        // Os filhos no heap só podem estar vencidos se o pai estiver
+        for (int f = 2 * menor + 1; f <= 2 * menor + 2; f++) {
+            if (f < prazos->total && prazo_em(prazos, f) <= agora) {
+                int j = tamanho++;
+                fronteira[j] = f;
+                while (j > 0 && prazo_em(prazos, fronteira[(j - 1) / 2]) > prazo_em(prazos, f)) {
+                    fronteira[j] = fronteira[(j - 1) / 2];
+                    j = (j - 1) / 2;
+                }
+                fronteira[j] = f;
+            }
+        }
+    }
+
+    free(fronteira);
+
+    // Os atrasados da lista vêm antes dos do heap; a ordenação junta as duas partes
+    qsort(resultados, encontrados, sizeof(Exemplar*), comparar_prazos);
+    return encontrados;
+}
+
+/**
+ * Exibe todos os livros atrasados no momento
+ */
+int listar_livros_atrasados(ControlePrazos* prazos) {
+    if (prazos == NULL) {
+        return 0;
+    }
+
+    time_t agora = time(NULL);
+    int max = prazos->total + prazos->total_atrasados;
+    if (max == 0) {
+        printf("\nNão há livros emprestados no momento.\n");
+        return 0;
+    }
+
+    Exemplar** atrasados = (Exemplar**)malloc(max * sizeof(Exemplar*));
+    if (atrasados == NULL) {
+        printf("Erro: Falha ao alocar memória!\n");
+        return 0;
+    }
+
+    int encontrados = buscar_atrasados(prazos, agora, atrasados, max);
+
+    printf("\n=== LIVROS ATRASADOS ===\n");
+    for (int i = 0; i < encontrados; i++) {
+        Exemplar* exemplar = atrasados[i];
+        char data_str[30];
+        formatar_data(exemplar->data_devolucao_prevista, data_str, sizeof(data_str));
+        long dias = (long)((agora - exemplar->data_devolucao_prevista) / SEGUNDOS_POR_DIA);
+
+        printf("\n[%d] Título: %s (exemplar %d)\n", i + 1,
+               exemplar->livro->dados.titulo, exemplar->numero);
+        printf("    Emprestado para: %s\n", exemplar->nome_leitor_atual);
+        printf("    Devolução prevista: %s (%ld dia(s) de atraso)\n", data_str, dias);
+    }
+
+    if (encontrados == 0) {
+        printf("Nenhum livro atrasado.\n");
+    } else {
+        printf("\nTotal de livros atrasados: %d\n", encontrados);
+    }
+
+    free(atrasados);
+    return encontrados;
+}
+
+/**
+ * Libera toda a memória do controle de prazos
+ */
+void liberar_controle_prazos(ControlePrazos* prazos) {
+    if (prazos == NULL) return;
+
+    free(prazos->heap);
+    free(prazos);
+}
+
+// =============================================================================
+// FUNÇÕES DA RODA DE RESERVAS
+// =============================================================================
+
+/**
+ * Cria uma roda de reservas vazia
+ */
+RodaReservas* criar_roda_reservas(time_t agora) {
+    RodaReservas* roda = (RodaReservas*)malloc(sizeof(RodaReservas));
+    if (roda == NULL) {
+        return NULL;
+    }
+
+    roda->posicoes = (Exemplar**)calloc(POSICOES_RODA_RESERVAS, sizeof(Exemplar*));
+    if (roda->posicoes == NULL) {
+        free(roda);
+        return NULL;
+    }
+
+    roda->ultimo_passo = (long long)agora / RESOLUCAO_RESERVAS - 1;
+    roda->total = 0;
+    return roda;
+}
+
+/**
+ * Agenda a expiração da reserva de um exemplar
+ */
+void roda_reservas_adicionar(RodaReservas* roda, Exemplar* exemplar) {
+    if (roda == NULL || exemplar == NULL) return;
+
+    roda_reservas_remover(roda, exemplar);
+
+    // Uma reserva que já venceu entra no próximo passo (a roda já passou pela posição dela)
+    long long passo = (long long)exemplar->fim_reserva / RESOLUCAO_RESERVAS;
+    if (passo <= roda->ultimo_passo) {
+        passo = roda->ultimo_passo + 1;
+    }
+    int posicao = (int)(passo % POSICOES_RODA_RESERVAS);
+
+    // Insere no início da lista da posição
+    exemplar->balde_reserva = posicao;
+    exemplar->anterior_reserva = NULL;
+    exemplar->proximo_reserva = roda->posicoes[posicao];
+    if (roda->posicoes[posicao] != NULL) {
+        roda->posicoes[posicao]->anterior_reserva = exemplar;
+    }
+    roda->posicoes[posicao] = exemplar;
+    roda->total++;
+}
+
+/**
+ * Cancela a reserva de um exemplar
+ */
+void roda_reservas_remover(RodaReservas* roda, Exemplar* exemplar) {
+    if (roda == NULL || exemplar == NULL || exemplar->balde_reserva == SEM_RESERVA) return;
+
+    if (exemplar->anterior_reserva != NULL) {
+        exemplar->anterior_reserva->proximo_reserva = exemplar->proximo_reserva;
+    } else {
+        roda->posicoes[exemplar->balde_reserva] = exemplar->proximo_reserva;
+    }
+    if (exemplar->proximo_reserva != NULL) {
+        exemplar->proximo_reserva->anterior_reserva = exemplar->anterior_reserva;
+    }
+
+    exemplar->balde_reserva = SEM_RESERVA;
+    exemplar->anterior_reserva = NULL;
+    exemplar->proximo_reserva = NULL;
+    roda->total--;
+}
+
+/**
+ * Avança a roda até o instante informado, retirando as reservas expiradas
+ */
+int roda_reservas_avancar(RodaReservas* roda, time_t agora, Exemplar** expiradas, int max) {
+    if (roda == NULL || expiradas == NULL) {
+        return 0;
+    }
+
+    // Só processa passos que já terminaram por completo (atraso máximo de uma resolução)
+    long long alvo = (long long)agora / RESOLUCAO_RESERVAS - 1;
+    int encontradas = 0;
+
+    // Depois de uma volta completa todas as posições já foram visitadas
+    if (alvo - roda->ultimo_passo > POSICOES_RODA_RESERVAS) {
+        roda->ultimo_passo = alvo - POSICOES_RODA_RESERVAS;
+    }
+
+    while (roda->ultimo_passo < alvo) {
+        long long passo = roda->ultimo_passo + 1;
+        Exemplar* atual = roda->posicoes[passo % POSICOES_RODA_RESERVAS];
+
+        // Reservas de voltas futuras ficam na posição até a volta delas
+        while (atual != NULL) {
+            Exemplar* proximo = atual->proximo_reserva;
+            if (atual->fim_reserva <= agora) {
+                if (encontradas == max) {
+                    return encontradas; // Posição será revisitada na próxima chamada
+                }
+                roda_reservas_remover(roda, atual);
+                expiradas[encontradas++] = atual;
+            }
+            atual = proximo;
+        }
+
+        roda->ultimo_passo = passo;
+    }
+
+    return encontradas;
+}
+
+/**
+ * Libera toda a memória da roda de reservas
+ */
+void liberar_roda_reservas(RodaReservas* roda) {
+    if (roda == NULL) return;
+
+    free(roda->posicoes);
+    free(roda);
+}
@@ -0,0 +1,176 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: prazos.h
+ * Descrição: Controle dos prazos de devolução e das reservas de livros devolvidos
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef PRAZOS_H
+#define PRAZOS_H
+
+#include "biblioteca.h"
+
+// =============================================================================
+// CONSTANTES DOS PRAZOS
+// =============================================================================
+
+#define PRAZO_EMPRESTIMO_DIAS 14        // Dias para devolver um exemplar emprestado
+#define SEGUNDOS_POR_DIA 86400          // Segundos em um dia
+#define CAPACIDADE_INICIAL_PRAZOS 16    // Posições iniciais do heap de prazos
+#define LOTE_VARREDURA 16               // Atrasos processados por chamada da varredura
+#define SEM_PRAZO -1                    // posicao_prazo: exemplar não está emprestado
+#define PRAZO_VENCIDO -2                // posicao_prazo: atraso já notificado
+#define PRAZO_RESERVA_HORAS 48          // Horas que um exemplar devolvido fica separado
+#define RESOLUCAO_RESERVAS 60           // Segundos por posição da roda de reservas
+#define POSICOES_RODA_RESERVAS 4096     // Posições da roda (uma volta ~ 68 horas)
+#define SEM_RESERVA -1                  // balde_reserva: exemplar não está separado
+
+// =============================================================================
+// HEAP DE PRAZOS (EMPRÉSTIMOS ORDENADOS PELA DATA DE DEVOLUÇÃO)
+// =============================================================================
+
+/**
+ * Controle dos prazos de devolução
+ * Os empréstimos ainda não notificados ficam em um heap mínimo ordenado pela data
+ * prevista de devolução; cada nó guarda sua posição no heap (posicao_prazo), então
+ * a devolução retira o exemplar em O(log n). Quando a varredura encontra um prazo
+ * vencido, o exemplar sai do heap e vai para o fim da lista de atrasados, que por
+ * isso também fica ordenada pela data de devolução.
+ */
+typedef struct ControlePrazos {
+    Exemplar** heap;            // Heap mínimo pela data prevista de devolução
+    int total;                  // Empréstimos no heap
+    int capacidade;             // Capacidade do vetor do heap
+    Exemplar* atrasados_inicio; // Atraso notificado há mais tempo
+    Exemplar* atrasados_fim;    // Atraso notificado mais recentemente
+    int total_atrasados;        // Exemplares na lista de atrasados
+} ControlePrazos;
+
+/**
+ * Cria um controle de prazos vazio
+ * Retorna: Ponteiro para o controle criado, ou NULL em caso de erro
+ */
+ControlePrazos* criar_controle_prazos();
+
+/**
+ * Registra o prazo de um exemplar emprestado (usa data_devolucao_prevista)
+ * Parâmetros:
+ *   - prazos: Ponteiro para o controle
+ *   - exemplar: Exemplar emprestado
+ * Retorna: true se registrado, false se faltou memória
+ */
+bool prazos_registrar(ControlePrazos* prazos, Exemplar* exemplar);
+
+/**
+ * Retira o prazo de um exemplar (devolução ou remoção do catálogo)
+ * Parâmetros:
+ *   - prazos: Ponteiro para o controle
+ *   - exemplar: Exemplar do livro
+ */
+void prazos_remover(ControlePrazos* prazos, Exemplar* exemplar);
+
+/**
+ * Varredura: retira do heap os empréstimos que venceram até o instante informado
+ * Cada empréstimo é devolvido uma única vez, em ordem de vencimento, e passa para
+ * a lista de atrasados. Chame novamente enquanto o retorno for igual a max.
+ * Parâmetros:
+ *   - prazos: Ponteiro para o controle
+ *   - agora: Instante de referência
+ *   - vencidos: Vetor que receberá os exemplares que acabaram de vencer
+ *   - max: Tamanho do vetor
+ * Retorna: Quantidade de exemplares colocados no vetor
+ */
+int prazos_varrer(ControlePrazos* prazos, time_t agora, Exemplar** vencidos, int max);
+
+/**
+ * Busca os livros atrasados no instante informado, do prazo mais antigo ao mais recente
+ * Percorre apenas os atrasados, sem olhar os demais empréstimos: O(k log k) para k resultados.
+ * Parâmetros:
+ *   - prazos: Ponteiro para o controle
+ *   - agora: Instante de referência
+ *   - resultados: Vetor que receberá os exemplares atrasados
+ *   - max: Tamanho do vetor
+ * Retorna: Quantidade de exemplares colocados no vetor
+ */
+int buscar_atrasados(ControlePrazos* prazos, time_t agora, Exemplar** resultados, int max);
+
+/**
+ * Exibe todos os livros atrasados no momento
+ * Parâmetros:
+ *   - prazos: Ponteiro para o controle
+ * Retorna: Quantidade de exemplares atrasados
+ */
+int listar_livros_atrasados(ControlePrazos* prazos);
+
+/**
+ * Libera toda a memória do controle (os exemplares não são liberados)
+ * Parâmetros:
+ *   - prazos: Ponteiro para o controle a ser liberado
+ */
+void liberar_controle_prazos(ControlePrazos* prazos);
+
+// =============================================================================
+// RODA DE RESERVAS (LIVROS SEPARADOS PARA O PRÓXIMO DA FILA)
+// =============================================================================
+
+/**
+ * Roda de temporizadores com hash para as reservas
+ * Cada posição cobre RESOLUCAO_RESERVAS segundos; uma reserva entra na posição
+ * do seu instante de expiração (módulo o número de posições), em uma lista
+ * duplamente encadeada guardada no próprio nó. Separar e cancelar custam O(1),
+ * e avançar a roda só visita as posições cujo tempo já passou.
+ */
+typedef struct RodaReservas {
+    Exemplar** posicoes;        // Lista de reservas de cada posição
+    long long ultimo_passo;     // Último passo (instante / resolução) já processado
+    int total;                  // Reservas ativas
+} RodaReservas;
+
+/**
+ * Cria uma roda de reservas vazia
+ * Parâmetros:
+ *   - agora: Instante a partir do qual a roda começa a contar
+ * Retorna: Ponteiro para a roda criada, ou NULL em caso de erro
+ */
+RodaReservas* criar_roda_reservas(time_t agora);
+
+/**
+ * Agenda a expiração da reserva de um exemplar (usa fim_reserva)
+ * Parâmetros:
+ *   - roda: Ponteiro para a roda
+ *   - exemplar: Exemplar separado
+ */
+void roda_reservas_adicionar(RodaReservas* roda, Exemplar* exemplar);
+
+/**
+ * Cancela a reserva de um exemplar (retirada pelo leitor ou remoção do catálogo)
+ * Parâmetros:
+ *   - roda: Ponteiro para a roda
+ *   - exemplar: Exemplar do livro
+ */
+void roda_reservas_remover(RodaReservas* roda, Exemplar* exemplar);
+
+/**
+ * Avança a roda até o instante informado, retirando as reservas expiradas
+ * Chame novamente enquanto o retorno for igual a max.
+ * Parâmetros:
+ *   - roda: Ponteiro para a roda
+ *   - agora: Instante atual
+ *   - expiradas: Vetor que receberá os exemplares cuja reserva expirou
+ *   - max: Tamanho do vetor
+ * Retorna: Quantidade de exemplares colocados no vetor
+ */
+int roda_reservas_avancar(RodaReservas* roda, time_t agora, Exemplar** expiradas, int max);
+
+/**
+ * Libera toda a memória da roda (os exemplares não são liberados)
+ * Parâmetros:
+ *   - roda: Ponteiro para a roda a ser liberada
+ */
+void liberar_roda_reservas(RodaReservas* roda);
+
+#endif // PRAZOS_H
@@ -0,0 +1,583 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: saida.c
+ * Descrição: Implementação da renderização de relatórios em buffer
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L // localtime_r() e writev() com -std=c99
+
+#include "saida.h"
+#include "prazos.h"
+#include <errno.h>
+#include <stdarg.h>
+
+#ifdef _WIN32
+// MinGW não tem writev() nem localtime_r(): escrever_partes() faz um _write()
+// por parte e localtime_s() tem os parâmetros na ordem inversa
+#include <io.h>
+#include <sys/types.h>
+struct iovec {
+    void* iov_base;     // Início do trecho
+    size_t iov_len;     // Tamanho do trecho
+};
+#define localtime_r(instante, partes) localtime_s((partes), (instante))
+#else
+#include <sys/uio.h>
+#endif
+#include <unistd.h>
+
+// Formato dos relatórios do menu (escolhido no submenu de histórico)
+static int formato_padrao = FORMATO_TEXTO;
+
+// =============================================================================
+// BUFFER E ESCRITA
+// =============================================================================
+
+/**
+ * Escreve vários trechos de uma vez: writev() no POSIX; no Windows, um _write()
+ * por trecho (mesmo retorno: bytes escritos, ou -1 se nada foi escrito)
+ */
+static ssize_t escrever_partes(int descritor, struct iovec* partes, int total) {
+#ifdef _WIN32
+    ssize_t escritos = 0;
+    for (int i = 0; i < total; i++) {
+        int n = _write(descritor, partes[i].iov_base, (unsigned int)partes[i].iov_len);
+        if (n < 0) {
+            return escritos > 0 ? escritos : -1;
+        }
+        escritos += n;
+        if ((size_t)n < partes[i].iov_len) {
+            break; // Escrita parcial: o chamador continua de onde parou
+        }
+    }
+    return escritos;
+#else
+    return writev(descritor, partes, total);
+#endif
+}
+
+/**
+ * Escreve o buffer e, em seguida, um trecho extra, na mesma chamada writev()
+ */
+static bool descarregar(SaidaRelatorio* saida, const char* extra, size_t tamanho_extra) {
+    // O que já foi escrito com printf() precisa sair antes
+    if (saida->descritor == STDOUT_FILENO) {
+        fflush(stdout);
+    }
+
+    struct iovec partes[2];
+    partes[0].iov_base = saida->buffer;
+    partes[0].iov_len = saida->usado;
+    partes[1].iov_base = (char*)extra;
+    partes[1].iov_len = tamanho_extra;
+
+    int primeira = 0;
+    while (primeira < 2 && !saida->erro) {
+        if (partes[primeira].iov_len == 0) {
+            primeira++;
+            continue;
+        }
+
+        ssize_t escritos = escrever_partes(saida->descritor, partes + primeira, 2 - primeira);
+        if (escritos < 0) {
+            if (errno != EINTR) {
+                saida->erro = true;
+            }
+            continue;
+        }
+
+        // Escrita parcial: avança sobre o que já saiu
+        while (escritos > 0 && primeira < 2) {
+            size_t avanco = (size_t)escritos < partes[primeira].iov_len ? (size_t)escritos
+                                                                        : partes[primeira].iov_len;
+            partes[primeira].iov_base = (char*)partes[primeira].iov_base + avanco;
+            partes[primeira].iov_len -= avanco;
+            escritos -= (ssize_t)avanco;
+            if (partes[primeira].iov_len == 0) {
+                primeira++;
+            }
+        }
+    }
+
+    saida->usado = 0;
+    return !saida->erro;
+}
+
+/**
+ * Garante espaço para n bytes no buffer (n nunca passa de TAMANHO_BUFFER_SAIDA)
+ * Retorna: Onde escrever os bytes
+ */
+static char* reservar(SaidaRelatorio* saida, size_t n) {
+    if (saida->usado + n > TAMANHO_BUFFER_SAIDA) {
+        descarregar(saida, NULL, 0);
+    }
+    return saida->buffer + saida->usado;
+}
+
+/**
+ * Escreve um caractere
+ */
+static void escrever_caractere(SaidaRelatorio* saida, char c) {
+    *reservar(saida, 1) = c;
+    saida->usado++;
+}
+
+/**
+ * Escreve um texto terminado em '\0'
+ */
+static void escrever_texto(SaidaRelatorio* saida, const char* texto) {
+    saida_escrever(saida, texto, strlen(texto));
+}
+
+/**
+ * Escreve um inteiro em decimal
+ */
+static void escrever_inteiro(SaidaRelatorio* saida, long long valor) {
+    char digitos[24];
+    int total = 0;
+    unsigned long long resto = valor < 0 ? 0ULL - (unsigned long long)valor : (unsigned long long)valor;
+
+    do {
+        digitos[total++] = (char)('0' + resto % 10);
+        resto /= 10;
+    } while (resto > 0);
+    if (valor < 0) {
+        digitos[total++] = '-';
+    }
+
+    char* destino = reservar(saida, total);
+    for (int i = 0; i < total; i++) {
+        destino[i] = digitos[total - 1 - i];
+    }
+    saida->usado += total;
+}
+
+/**
+ * Escreve um texto entre aspas, com o escape do JSON
+ */
+static void escrever_texto_json(SaidaRelatorio* saida, const char* texto) {
+    static const char hexa[] = "0123456789abcdef";
+
+    escrever_caractere(saida, '"');
+    for (; *texto != '\0'; texto++) {
+        unsigned char c = (unsigned char)*texto;
+        char* destino = reservar(saida, 6);
+
+        if (c == '"' || c == '\\') {
+            destino[0] = '\\';
+            destino[1] = (char)c;
+            saida->usado += 2;
+        } else if (c == '\n') {
+            destino[0] = '\\';
+            destino[1] = 'n';
+            saida->usado += 2;
+        } else if (c < 0x20) {
+            memcpy(destino, "\\u00", 4);
+            destino[4] = hexa[c >> 4];
+            destino[5] = hexa[c & 0x0F];
+            saida->usado += 6;
+        } else {
+            destino[0] = (char)c; // UTF-8 passa como está
+            saida->usado++;
+        }
+    }
+    escrever_caractere(saida, '"');
+}
+
+/**
+ * Escreve um campo do CSV (entre aspas só quando tem vírgula, aspas ou quebra de linha)
+ */
+static void escrever_texto_csv(SaidaRelatorio* saida, const char* texto) {
+    if (strpbrk(texto, ",\"\r\n") == NULL) {
+        escrever_texto(saida, texto);
+        return;
+    }
+
+    escrever_caractere(saida, '"');
+    for (; *texto != '\0'; texto++) {
+        if (*texto == '"') {
+            escrever_caractere(saida, '"'); // Aspas viram aspas duplas
+        }
+        escrever_caractere(saida, *texto);
+    }
+    escrever_caractere(saida, '"');
+}
+
+// =============================================================================
+// CACHE DE DATAS
+// =============================================================================
+
+/**
+ * Esvazia um cache de datas
+ */
+void iniciar_cache_datas(CacheDatas* cache) {
+    cache->inicio = 0;
+    cache->fim = 0;
+    cache->formato_ultimo = -1;
+}
+
+/**
+ * Segundos decorridos no dia de um horário local
+ */
+static int segundos_do_dia(const struct tm* partes) {
+    return partes->tm_hour * 3600 + partes->tm_min * 60 + partes->tm_sec;
+}
+
+/**
+ * Converte o dia de um instante e calcula até onde a conversão vale
+ */
+static void carregar_dia(CacheDatas* cache, time_t instante) {
+    struct tm partes;
+    localtime_r(&instante, &partes);
+
+    cache->dia = partes.tm_mday;
+    cache->mes = partes.tm_mon + 1;
+    cache->ano = partes.tm_year + 1900;
+
+    // O dia vale inteiro se começa à meia-noite e termina às 23:59:59 sem
+    // mudança de horário de verão no meio; senão, só este segundo
+    time_t inicio = instante - segundos_do_dia(&partes);
+    time_t ultimo = inicio + SEGUNDOS_POR_DIA - 1;
+    struct tm partes_inicio;
+    struct tm partes_ultimo;
+    localtime_r(&inicio, &partes_inicio);
+    localtime_r(&ultimo, &partes_ultimo);
+
+    if (partes_inicio.tm_mday == partes.tm_mday && segundos_do_dia(&partes_inicio) == 0 &&
+        partes_ultimo.tm_mday == partes.tm_mday && segundos_do_dia(&partes_ultimo) == SEGUNDOS_POR_DIA - 1) {
+        cache->inicio = inicio;
+        cache->fim = ultimo + 1;
+        cache->segundos_inicio = 0;
+    } else {
+        cache->inicio = instante;
+        cache->fim = instante + 1;
+        cache->segundos_inicio = segundos_do_dia(&partes);
+    }
+}
+
+/**
+ * Escreve um número com dois dígitos
+ */
+static void dois_digitos(char* destino, int valor) {
+    destino[0] = (char)('0' + valor / 10);
+    destino[1] = (char)('0' + valor % 10);
+}
+
+/**
+ * Formata uma data usando o cache
+ */
+int formatar_data_cache(CacheDatas* cache, time_t instante, int formato, char* buffer) {
+    int tamanho = 19;
+
+    // Mesmo segundo (e mesmo formato) da última chamada
+    if (formato == cache->formato_ultimo && instante == cache->ultimo) {
+        memcpy(buffer, cache->ultimo_texto, tamanho + 1);
+        return tamanho;
+    }
+
+    if (instante < cache->inicio || instante >= cache->fim) {
+        carregar_dia(cache, instante);
+    }
+
+    int segundos = cache->segundos_inicio + (int)(instante - cache->inicio);
+    int hora = segundos / 3600;
+    int minuto = segundos / 60 % 60;
+    int segundo = segundos % 60;
+    int ano = cache->ano;
+
+    if (formato == FORMATO_TEXTO) {
+        // DD/MM/AAAA HH:MM:SS
+        dois_digitos(buffer, cache->dia);
+        buffer[2] = '/';
+        dois_digitos(buffer + 3, cache->mes);
+        buffer[5] = '/';
+        dois_digitos(buffer + 6, ano / 100 % 100);
+        dois_digitos(buffer + 8, ano % 100);
+        buffer[10] = ' ';
+    } else {
+        // AAAA-MM-DDTHH:MM:SS
+        dois_digitos(buffer, ano / 100 % 100);
+        dois_digitos(buffer + 2, ano % 100);
+        buffer[4] = '-';
+        dois_digitos(buffer + 5, cache->mes);
+        buffer[7] = '-';
+        dois_digitos(buffer + 8, cache->dia);
+        buffer[10] = 'T';
+    }
+    dois_digitos(buffer + 11, hora);
+    buffer[13] = ':';
+    dois_digitos(buffer + 14, minuto);
+    buffer[16] = ':';
+    dois_digitos(buffer + 17, segundo);
+    buffer[19] = '\0';
+
+    cache->ultimo = instante;
+    cache->formato_ultimo = formato;
+    memcpy(cache->ultimo_texto, buffer, tamanho + 1);
+    return tamanho;
+}
+
+// =============================================================================
+// RELATÓRIOS
+// =============================================================================
+
+/**
+ * Cria a saída de um relatório
+ */
+SaidaRelatorio* criar_saida(int descritor, int formato) {
+    SaidaRelatorio* saida = (SaidaRelatorio*)malloc(sizeof(SaidaRelatorio));
+    if (saida == NULL) {
+        return NULL;
+    }
+
+    saida->buffer = (char*)malloc(TAMANHO_BUFFER_SAIDA);
+    if (saida->buffer == NULL) {
+        free(saida);
+        return NULL;
+    }
+
+    saida->descritor = descritor;
+    saida->formato = formato;
+    saida->usado = 0;
+    saida->erro = false;
+    saida->registros = 0;
+    saida->campos = 0;
+    iniciar_cache_datas(&saida->datas);
+    return saida;
+}
+
+/**
+ * Escreve bytes sem conversão
+ */
+void saida_escrever(SaidaRelatorio* saida, const char* texto, size_t tamanho) {
+    if (saida->usado + tamanho <= TAMANHO_BUFFER_SAIDA) {
+        memcpy(saida->buffer + saida->usado, texto, tamanho);
+        saida->usado += tamanho;
+    } else {
+        // Não cabe: o buffer e o trecho saem juntos, sem copiar o trecho
+        descarregar(saida, texto, tamanho);
+    }
+}
+
+/**
+ * Escreve uma linha de texto livre (só no formato texto)
+ */
+void saida_nota(SaidaRelatorio* saida, const char* formato, ...) {
+    if (saida->formato != FORMATO_TEXTO) {
+        return;
+    }
+
+    char linha[512];
+    va_list argumentos;
+    va_start(argumentos, formato);
+    int tamanho = vsnprintf(linha, sizeof(linha), formato, argumentos);
+    va_end(argumentos);
+
+    if (tamanho > 0) {
+        saida_escrever(saida, linha, (size_t)tamanho < sizeof(linha) ? (size_t)tamanho : sizeof(linha) - 1);
+    }
+}
+
+/**
+ * Começa um relatório
+ */
+void saida_iniciar_relatorio(SaidaRelatorio* saida, const char* titulo, const char* colunas) {
+    saida->registros = 0;
+
+    switch (saida->formato) {
+        case FORMATO_CSV:
+            escrever_texto(saida, colunas);
+            escrever_caractere(saida, '\n');
+            break;
+        case FORMATO_JSON:
+            escrever_caractere(saida, '[');
+            break;
+        case FORMATO_JSON_LINHAS:
+            break;
+        default:
+            escrever_texto(saida, "\n=== ");
+            escrever_texto(saida, titulo);
+            escrever_texto(saida, " ===\n");
+            break;
+    }
+}
+
+/**
+ * Começa um registro
+ */
+void saida_iniciar_registro(SaidaRelatorio* saida) {
+    saida->registros++;
+    saida->campos = 0;
+
+    if (saida->formato == FORMATO_JSON) {
+        escrever_texto(saida, saida->registros == 1 ? "\n  {" : ",\n  {");
+    } else if (saida->formato == FORMATO_JSON_LINHAS) {
+        escrever_caractere(saida, '{');
+    }
+}
+
+/**
+ * Separador e nome de um campo
+ */
+static void iniciar_campo(SaidaRelatorio* saida, const char* rotulo, const char* chave) {
+    switch (saida->formato) {
+        case FORMATO_CSV:
+            if (saida->campos > 0) {
+                escrever_caractere(saida, ',');
+            }
+            break;
+        case FORMATO_JSON:
+        case FORMATO_JSON_LINHAS:
+            if (saida->campos > 0) {
+                escrever_texto(saida, ", ");
+            }
+            escrever_caractere(saida, '"');
+            escrever_texto(saida, chave);
+            escrever_texto(saida, "\": ");
+            break;
+        default:
+            // Primeiro campo: "\n[n] Rótulo: "; demais: "    Rótulo: "
+            if (saida->campos == 0) {
+                escrever_texto(saida, "\n[");
+                escrever_inteiro(saida, saida->registros);
+                escrever_texto(saida, "] ");
+            } else {
+                escrever_texto(saida, "    ");
+            }
+            escrever_texto(saida, rotulo);
+            escrever_texto(saida, ": ");
+            break;
+    }
+    saida->campos++;
+}
+
+/**
+ * Termina a linha de um campo no formato texto
+ */
+static void terminar_campo(SaidaRelatorio* saida) {
+    if (saida->formato == FORMATO_TEXTO) {
+        escrever_caractere(saida, '\n');
+    }
+}
+
+/**
+ * Escreve um campo de texto
+ */
+void saida_campo_texto(SaidaRelatorio* saida, const char* rotulo, const char* chave, const char* valor) {
+    iniciar_campo(saida, rotulo, chave);
+    switch (saida->formato) {
+        case FORMATO_CSV: escrever_texto_csv(saida, valor); break;
+        case FORMATO_JSON:
+        case FORMATO_JSON_LINHAS: escrever_texto_json(saida, valor); break;
+        default: escrever_texto(saida, valor); break;
+    }
+    terminar_campo(saida);
+}
+
+/**
+ * Escreve um campo inteiro
+ */
+void saida_campo_inteiro(SaidaRelatorio* saida, const char* rotulo, const char* chave, long long valor) {
+    iniciar_campo(saida, rotulo, chave);
+    escrever_inteiro(saida, valor);
+    terminar_campo(saida);
+}
+
+/**
+ * Escreve um campo de data
+ */
+void saida_campo_data(SaidaRelatorio* saida, const char* rotulo, const char* chave, time_t instante) {
+    char data[24];
+    int tamanho = formatar_data_cache(&saida->datas, instante, saida->formato, data);
+
+    iniciar_campo(saida, rotulo, chave);
+    if (saida->formato == FORMATO_JSON || saida->formato == FORMATO_JSON_LINHAS) {
+        escrever_caractere(saida, '"');
+        saida_escrever(saida, data, tamanho);
+        escrever_caractere(saida, '"');
+    } else {
+        saida_escrever(saida, data, tamanho);
+    }
+    terminar_campo(saida);
+}
+
+/**
+ * Termina o registro atual
+ */
+void saida_terminar_registro(SaidaRelatorio* saida) {
+    switch (saida->formato) {
+        case FORMATO_CSV: escrever_caractere(saida, '\n'); break;
+        case FORMATO_JSON: escrever_caractere(saida, '}'); break;
+        case FORMATO_JSON_LINHAS: escrever_texto(saida, "}\n"); break;
+        default: break;
+    }
+}
+
+/**
+ * Termina o relatório
+ */
+void saida_terminar_relatorio(SaidaRelatorio* saida) {
+    if (saida->formato == FORMATO_JSON) {
+        escrever_texto(saida, saida->registros > 0 ? "\n]\n" : "]\n");
+    }
+}
+
+/**
+ * Escreve no descritor tudo o que está no buffer
+ */
+bool saida_descarregar(SaidaRelatorio* saida) {
+    if (saida == NULL) {
+        return false;
+    }
+    return descarregar(saida, NULL, 0);
+}
+
+/**
+ * Descarrega o buffer e libera a saída
+ */
+void liberar_saida(SaidaRelatorio* saida) {
+    if (saida == NULL) return;
+
+    if (!descarregar(saida, NULL, 0)) {
+        printf("Erro: Falha ao escrever o relatório!\n");
+    }
+    free(saida->buffer);
+    free(saida);
+}
+
+// =============================================================================
+// FORMATO PADRÃO
+// =============================================================================
+
+/**
+ * Define o formato usado pelos relatórios do menu
+ */
+void saida_definir_formato_padrao(int formato) {
+    if (formato == FORMATO_TEXTO || formato == FORMATO_CSV || formato == FORMATO_JSON) {
+        formato_padrao = formato;
+    }
+}
+
+/**
+ * Formato usado pelos relatórios do menu
+ */
+int saida_formato_padrao() {
+    return formato_padrao;
+}
+
+/**
+ * Nome de um formato
+ */
+const char* saida_nome_formato(int formato) {
+    switch (formato) {
+        case FORMATO_CSV: return "CSV";
+        case FORMATO_JSON: return "JSON";
+        case FORMATO_JSON_LINHAS: return "JSON Lines";
+        default: return "texto";
+    }
+}
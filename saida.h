@@ -0,0 +1,209 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: saida.h
+ * Descrição: Renderização de relatórios em buffer (texto, CSV e JSON)
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef SAIDA_H
+#define SAIDA_H
+
+#include "biblioteca.h"
+
+// =============================================================================
+// CONSTANTES DA SAÍDA
+// =============================================================================
+
+#define FORMATO_TEXTO 0             // Layout das listagens do menu
+#define FORMATO_CSV 1               // Uma linha por registro, com cabeçalho
+#define FORMATO_JSON 2              // Vetor de objetos
+#define FORMATO_JSON_LINHAS 3       // Um objeto por linha (JSON Lines)
+
+#define TAMANHO_BUFFER_SAIDA (64 * 1024) // Bytes acumulados antes de cada writev()
+
+// =============================================================================
+// ESTRUTURAS DA SAÍDA
+// =============================================================================
+
+/**
+ * Datas já convertidas pelo localtime_r()
+ * Dentro de um mesmo dia, a hora sai da diferença para o início do dia, sem
+ * consultar o fuso de novo; o último segundo formatado fica pronto para reuso.
+ */
+typedef struct CacheDatas {
+    time_t inicio;                  // Primeiro instante em que dia, mês e ano valem
+    time_t fim;                     // Depois do último (inicio == fim: cache vazio)
+    int segundos_inicio;            // Segundos do dia no instante inicio
+    int dia;                        // Dia do mês
+    int mes;                        // Mês (1 a 12)
+    int ano;                        // Ano com quatro dígitos
+    time_t ultimo;                  // Último instante formatado
+    int formato_ultimo;             // Formato de ultimo_texto (-1 = vazio)
+    char ultimo_texto[24];          // Texto do último instante formatado
+} CacheDatas;
+
+/**
+ * Destino de um relatório
+ * Tudo é montado no buffer e vai para o descritor em poucas chamadas writev().
+ */
+typedef struct SaidaRelatorio {
+    int descritor;                  // Arquivo de destino (STDOUT_FILENO para a tela)
+    int formato;                    // FORMATO_*
+    char* buffer;                   // Bytes ainda não escritos
+    size_t usado;                   // Bytes ocupados do buffer
+    bool erro;                      // Alguma escrita falhou
+    int registros;                  // Registros iniciados no relatório
+    int campos;                     // Campos do registro atual
+    CacheDatas datas;               // Datas já formatadas
+} SaidaRelatorio;
+
+// =============================================================================
+// FUNÇÕES DA SAÍDA
+// =============================================================================
+
+/**
+ * Cria a saída de um relatório
+ * Parâmetros:
+ *   - descritor: Arquivo de destino (ex.: STDOUT_FILENO)
+ *   - formato: FORMATO_TEXTO, FORMATO_CSV, FORMATO_JSON ou FORMATO_JSON_LINHAS
+ * Retorna: Ponteiro para a saída criada, ou NULL se faltar memória
+ */
+SaidaRelatorio* criar_saida(int descritor, int formato);
+
+/**
+ * Escreve bytes sem nenhuma conversão (trechos maiores que o buffer vão direto no writev())
+ * Parâmetros:
+ *   - saida: Ponteiro para a saída
+ *   - texto: Bytes a escrever
+ *   - tamanho: Quantidade de bytes
+ */
+void saida_escrever(SaidaRelatorio* saida, const char* texto, size_t tamanho);
+
+/**
+ * Escreve uma linha de texto livre, só no formato texto (totais, avisos)
+ * Parâmetros:
+ *   - saida: Ponteiro para a saída
+ *   - formato: Formato no estilo printf
+ */
+void saida_nota(SaidaRelatorio* saida, const char* formato, ...);
+
+/**
+ * Começa um relatório: título no texto, cabeçalho no CSV, "[" no JSON (nada no JSON Lines)
+ * Parâmetros:
+ *   - saida: Ponteiro para a saída
+ *   - titulo: Título exibido no formato texto
+ *   - colunas: Chaves dos campos separadas por vírgula (cabeçalho do CSV)
+ */
+void saida_iniciar_relatorio(SaidaRelatorio* saida, const char* titulo, const char* colunas);
+
+/**
+ * Começa um registro (numerado a partir de 1 no formato texto)
+ * Parâmetros:
+ *   - saida: Ponteiro para a saída
+ */
+void saida_iniciar_registro(SaidaRelatorio* saida);
+
+/**
+ * Escreve um campo de texto do registro atual (com o escape do CSV ou do JSON)
+ * Parâmetros:
+ *   - saida: Ponteiro para a saída
+ *   - rotulo: Nome exibido no formato texto
+ *   - chave: Nome do campo no JSON (no CSV vale a ordem de colunas)
+ *   - valor: Texto do campo
+ */
+void saida_campo_texto(SaidaRelatorio* saida, const char* rotulo, const char* chave, const char* valor);
+
+/**
+ * Escreve um campo inteiro do registro atual
+ * Parâmetros:
+ *   - saida: Ponteiro para a saída
+ *   - rotulo: Nome exibido no formato texto
+ *   - chave: Nome do campo no JSON
+ *   - valor: Número do campo
+ */
+void saida_campo_inteiro(SaidaRelatorio* saida, const char* rotulo, const char* chave, long long valor);
+
+/**
+ * Escreve um campo de data do registro atual
+ * Texto: DD/MM/AAAA HH:MM:SS, como formatar_data(); CSV e JSON: AAAA-MM-DDTHH:MM:SS.
+ * Parâmetros:
+ *   - saida: Ponteiro para a saída
+ *   - rotulo: Nome exibido no formato texto
+ *   - chave: Nome do campo no JSON
+ *   - instante: Data e hora (horário local)
+ */
+void saida_campo_data(SaidaRelatorio* saida, const char* rotulo, const char* chave, time_t instante);
+
+/**
+ * Termina o registro atual
+ * Parâmetros:
+ *   - saida: Ponteiro para a saída
+ */
+void saida_terminar_registro(SaidaRelatorio* saida);
+
+/**
+ * Termina o relatório ("]" no JSON)
+ * Parâmetros:
+ *   - saida: Ponteiro para a saída
+ */
+void saida_terminar_relatorio(SaidaRelatorio* saida);
+
+/**
+ * Escreve no descritor tudo o que está no buffer
+ * Parâmetros:
+ *   - saida: Ponteiro para a saída
+ * Retorna: true se todas as escritas até aqui funcionaram
+ */
+bool saida_descarregar(SaidaRelatorio* saida);
+
+/**
+ * Descarrega o buffer e libera a saída (o descritor não é fechado)
+ * Parâmetros:
+ *   - saida: Ponteiro para a saída
+ */
+void liberar_saida(SaidaRelatorio* saida);
+
+/**
+ * Formata uma data usando o cache (texto como formatar_data(), ou ISO 8601)
+ * Parâmetros:
+ *   - cache: Cache de datas (zerado com iniciar_cache_datas())
+ *   - instante: Data e hora
+ *   - formato: FORMATO_TEXTO (DD/MM/AAAA HH:MM:SS) ou outro (AAAA-MM-DDTHH:MM:SS)
+ *   - buffer: Recebe o texto (pelo menos 20 bytes)
+ * Retorna: Quantidade de caracteres escritos (sem o '\0')
+ */
+int formatar_data_cache(CacheDatas* cache, time_t instante, int formato, char* buffer);
+
+/**
+ * Esvazia um cache de datas
+ * Parâmetros:
+ *   - cache: Cache a ser esvaziado
+ */
+void iniciar_cache_datas(CacheDatas* cache);
+
+/**
+ * Define o formato usado pelos relatórios do menu
+ * Parâmetros:
+ *   - formato: FORMATO_TEXTO, FORMATO_CSV ou FORMATO_JSON
+ */
+void saida_definir_formato_padrao(int formato);
+
+/**
+ * Formato usado pelos relatórios do menu
+ * Retorna: FORMATO_TEXTO (padrão), FORMATO_CSV ou FORMATO_JSON
+ */
+int saida_formato_padrao();
+
+/**
+ * Nome de um formato ("texto", "CSV", "JSON" ou "JSON Lines")
+ * Parâmetros:
+ *   - formato: FORMATO_*
+ * Retorna: Nome para exibição
+ */
+const char* saida_nome_formato(int formato);
+
+#endif // SAIDA_H
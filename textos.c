@@ -0,0 +1,308 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: textos.c
+ * Descrição: Implementação da comparação e da busca de textos sem caixa
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#include "textos.h"
+
+// As versões vetoriais só existem em x86 com GCC/Clang (atributo target e cpuid)
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TEXTOS_VETORIAIS 1
+#include <immintrin.h>
+#endif
+
+// =============================================================================
+// VERSÃO ESCALAR
+// =============================================================================
+
+/**
+ * Minúscula ASCII de um byte (os demais bytes ficam como estão)
+ */
+static inline unsigned char minuscula(unsigned char c) {
+    return (unsigned char)(c | ((unsigned char)(c - 'A') < 26 ? 0x20 : 0));
+}
+
+/**
+ * Compara n bytes ignorando maiúsculas
+ */
+static bool iguais_escalar(const char* a, const char* b, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (minuscula((unsigned char)a[i]) != minuscula((unsigned char)b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Procura o trecho (m bytes) no texto (n bytes) a partir de uma posição
+ */
+static const char* procurar_escalar_desde(const char* texto, size_t n, const char* trecho, size_t m,
+                                          size_t inicio) {
+    unsigned char primeiro = minuscula((unsigned char)trecho[0]);
+
+    for (size_t i = inicio; i + m <= n; i++) {
+        if (minuscula((unsigned char)texto[i]) == primeiro && iguais_escalar(texto + i + 1, trecho + 1, m - 1)) {
+            return texto + i;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Procura o trecho no texto, um byte por vez
+ */
+static const char* procurar_escalar(const char* texto, size_t n, const char* trecho, size_t m) {
+    return procurar_escalar_desde(texto, n, trecho, m, 0);
+}
+
+// =============================================================================
+// VERSÕES SSE2 E AVX2
+// =============================================================================
+
+#ifdef TEXTOS_VETORIAIS
+
+/**
+ * Minúsculas ASCII de 16 bytes
+ * Subtrair 'A' + 128 leva 'A'..'Z' para -128..-103, os únicos valores abaixo de
+ * -102 na comparação com sinal; só esses bytes recebem o bit 0x20.
+ */
+__attribute__((target("sse2")))
+static inline __m128i minusculas_sse2(__m128i bytes) {
+    __m128i deslocados = _mm_sub_epi8(bytes, _mm_set1_epi8((char)('A' + 128)));
+    __m128i maiusculas = _mm_cmplt_epi8(deslocados, _mm_set1_epi8((char)(-128 + 26)));
+    return _mm_or_si128(bytes, _mm_and_si128(maiusculas, _mm_set1_epi8(0x20)));
+}
+
+/**
+ * Compara n bytes ignorando maiúsculas, 16 por vez
+ * Sempre expandida no chamador: dentro das versões AVX2 vira código VEX, sem a
+ * penalidade de alternar entre instruções SSE e AVX a cada texto.
+ */
+__attribute__((target("sse2"), always_inline))
+static inline bool iguais_sse2(const char* a, const char* b, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = minusculas_sse2(_mm_loadu_si128((const __m128i*)(a + i)));
+        __m128i y = minusculas_sse2(_mm_loadu_si128((const __m128i*)(b + i)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) != 0xFFFF) {
+            return false;
+        }
+    }
+    return iguais_escalar(a + i, b + i, n - i);
+}
+
+/**
+ * Procura o trecho no texto, 16 posições iniciais por vez
+ * Em cada bloco, compara o primeiro e o último byte do trecho com 16 posições
+ * de uma vez; só as posições em que os dois batem são conferidas por inteiro.
+ */
+__attribute__((target("sse2"), always_inline))
+static inline const char* procurar_sse2(const char* texto, size_t n, const char* trecho, size_t m) {
+    __m128i primeiro = _mm_set1_epi8((char)minuscula((unsigned char)trecho[0]));
+    __m128i ultimo = _mm_set1_epi8((char)minuscula((unsigned char)trecho[m - 1]));
+    size_t i = 0;
+
+    // O bloco que começa no último byte do trecho não pode passar do fim do texto
+    for (; i + m - 1 + 16 <= n; i += 16) {
+        __m128i inicio = minusculas_sse2(_mm_loadu_si128((const __m128i*)(texto + i)));
+        __m128i fim = minusculas_sse2(_mm_loadu_si128((const __m128i*)(texto + i + m - 1)));
+        unsigned int candidatos = (unsigned int)_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(inicio, primeiro), _mm_cmpeq_epi8(fim, ultimo)));
+
+        while (candidatos != 0) {
+            size_t posicao = i + (size_t)__builtin_ctz(candidatos);
+            if (m <= 2 || iguais_escalar(texto + posicao + 1, trecho + 1, m - 2)) {
+                return texto + posicao;
+            }
+            candidatos &= candidatos - 1;
+        }
+    }
+
+    return procurar_escalar_desde(texto, n, trecho, m, i);
+}
+
+/**
+ * Minúsculas ASCII de 32 bytes (mesma ideia de minusculas_sse2)
+ */
+__attribute__((target("avx2")))
+static inline __m256i minusculas_avx2(__m256i bytes) {
+    __m256i deslocados = _mm256_sub_epi8(bytes, _mm256_set1_epi8((char)('A' + 128)));
+    __m256i maiusculas = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(-128 + 26)), deslocados);
+    return _mm256_or_si256(bytes, _mm256_and_si256(maiusculas, _mm256_set1_epi8(0x20)));
+}
+
+/**
+ * Compara n bytes ignorando maiúsculas, 32 por vez
+ */
+__attribute__((target("avx2")))
+static bool iguais_avx2(const char* a, const char* b, size_t n) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i x = minusculas_avx2(_mm256_loadu_si256((const __m256i*)(a + i)));
+        __m256i y = minusculas_avx2(_mm256_loadu_si256((const __m256i*)(b + i)));
+        if ((unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)) != 0xFFFFFFFFu) {
+            return false;
+        }
+    }
+    return iguais_sse2(a + i, b + i, n - i);
+}
+
+/**
+ * Procura o trecho no texto, 32 posições iniciais por vez
+ */
+__attribute__((target("avx2")))
+static const char* procurar_avx2(const char* texto, size_t n, const char* trecho, size_t m) {
+    __m256i primeiro = _mm256_set1_epi8((char)minuscula((unsigned char)trecho[0]));
+    __m256i ultimo = _mm256_set1_epi8((char)minuscula((unsigned char)trecho[m - 1]));
+    size_t i = 0;
+
+    for (; i + m - 1 + 32 <= n; i += 32) {
+        __m256i inicio = minusculas_avx2(_mm256_loadu_si256((const __m256i*)(texto + i)));
+        __m256i fim = minusculas_avx2(_mm256_loadu_si256((const __m256i*)(texto + i + m - 1)));
+        unsigned int candidatos = (unsigned int)_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(inicio, primeiro), _mm256_cmpeq_epi8(fim, ultimo)));
+
+        while (candidatos != 0) {
+            size_t posicao = i + (size_t)__builtin_ctz(candidatos);
+            if (m <= 2 || iguais_escalar(texto + posicao + 1, trecho + 1, m - 2)) {
+                return texto + posicao;
+            }
+            candidatos &= candidatos - 1;
+        }
+    }
+
+    // O resto (e textos curtos, o caso comum em títulos e nomes) usa blocos de 16
+    return procurar_sse2(texto + i, n - i, trecho, m);
+}
+
+#endif // TEXTOS_VETORIAIS
+
+// =============================================================================
+// ESCOLHA DA IMPLEMENTAÇÃO
+// =============================================================================
+
+static bool (*iguais_atual)(const char*, const char*, size_t) = iguais_escalar;
+static const char* (*procurar_atual)(const char*, size_t, const char*, size_t) = procurar_escalar;
+
+/**
+ * Indica se o processador executa uma implementação
+ */
+static bool implementacao_suportada(int implementacao) {
+    switch (implementacao) {
+        case IMPLEMENTACAO_ESCALAR:
+            return true;
+#ifdef TEXTOS_VETORIAIS
+        case IMPLEMENTACAO_SSE2:
+            return __builtin_cpu_supports("sse2");
+        case IMPLEMENTACAO_AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+/**
+ * Escolhe a implementação das funções de texto
+ */
+int textos_escolher_implementacao(int implementacao) {
+#ifdef TEXTOS_VETORIAIS
+    __builtin_cpu_init();
+#endif
+
+    // Automática (ou não suportada): a mais larga que o processador executa
+    if (implementacao == IMPLEMENTACAO_AUTOMATICA || !implementacao_suportada(implementacao)) {
+        implementacao = IMPLEMENTACAO_AVX2;
+        while (!implementacao_suportada(implementacao)) {
+            implementacao--;
+        }
+    }
+
+    switch (implementacao) {
+#ifdef TEXTOS_VETORIAIS
+        case IMPLEMENTACAO_AVX2:
+            iguais_atual = iguais_avx2;
+            procurar_atual = procurar_avx2;
+            break;
+        case IMPLEMENTACAO_SSE2:
+            iguais_atual = iguais_sse2;
+            procurar_atual = procurar_sse2;
+            break;
+#endif
+        default:
+            iguais_atual = iguais_escalar;
+            procurar_atual = procurar_escalar;
+            break;
+    }
+
+    return implementacao;
+}
+
+/**
+ * Nome de uma implementação
+ */
+const char* textos_nome_implementacao(int implementacao) {
+    switch (implementacao) {
+        case IMPLEMENTACAO_SSE2: return "SSE2";
+        case IMPLEMENTACAO_AVX2: return "AVX2";
+        case IMPLEMENTACAO_ESCALAR: return "escalar";
+        default: return "automática";
+    }
+}
+
+// =============================================================================
+// FUNÇÕES DE TEXTO
+// =============================================================================
+
+/**
+ * Compara dois textos ignorando maiúsculas/minúsculas ASCII
+ */
+bool iguais_sem_caixa(const char* a, const char* b) {
+    // Tamanhos diferentes já decidem (a maioria das comparações termina aqui)
+    size_t n = strlen(a);
+    if (strlen(b) != n) {
+        return false;
+    }
+    return iguais_atual(a, b, n);
+}
+
+/**
+ * Procura um trecho em um texto ignorando maiúsculas/minúsculas ASCII
+ */
+const char* procurar_sem_caixa(const char* texto, const char* trecho) {
+    size_t m = strlen(trecho);
+    if (m == 0) {
+        return texto;
+    }
+
+    size_t n = strlen(texto);
+    if (m > n) {
+        return NULL;
+    }
+    return procurar_atual(texto, n, trecho, m);
+}
+
+/**
+ * Hash de um texto ignorando maiúsculas (mesmo FNV-1a de calcular_hash())
+ */
+unsigned int hash_sem_caixa(const char* texto) {
+    return continuar_hash_sem_caixa(2166136261u, texto);
+}
+
+/**
+ * Continua um hash com mais um texto, ignorando maiúsculas
+ */
+unsigned int continuar_hash_sem_caixa(unsigned int hash, const char* texto) {
+    while (*texto) {
+        hash ^= minuscula((unsigned char)*texto++);
+        hash *= 16777619u;
+    }
+    return hash;
+}
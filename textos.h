@@ -0,0 +1,86 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: textos.h
+ * Descrição: Comparação e busca de textos sem diferenciar maiúsculas (SSE2/AVX2)
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef TEXTOS_H
+#define TEXTOS_H
+
+#include "biblioteca.h"
+
+// =============================================================================
+// CONSTANTES DOS TEXTOS
+// =============================================================================
+
+#define IMPLEMENTACAO_AUTOMATICA 0  // A melhor que o processador suporta
+#define IMPLEMENTACAO_ESCALAR 1     // Um byte por vez (qualquer processador)
+#define IMPLEMENTACAO_SSE2 2        // 16 bytes por vez
+#define IMPLEMENTACAO_AVX2 3        // 32 bytes por vez
+
+// =============================================================================
+// COMPARAÇÃO SEM DIFERENCIAR MAIÚSCULAS
+// =============================================================================
+
+/**
+ * Compara dois textos ignorando maiúsculas/minúsculas ASCII, sem copiá-los
+ * Dá o mesmo resultado que para_minusculo() nos dois seguido de strcmp() == 0
+ * (bytes UTF-8 acima de 127 são comparados como estão).
+ * Parâmetros:
+ *   - a: Primeiro texto
+ *   - b: Segundo texto
+ * Retorna: true se os textos são iguais
+ */
+bool iguais_sem_caixa(const char* a, const char* b);
+
+/**
+ * Procura um trecho em um texto ignorando maiúsculas/minúsculas ASCII, sem copiá-los
+ * Dá o mesmo resultado que strstr() sobre as versões em minúsculas.
+ * Parâmetros:
+ *   - texto: Texto onde procurar
+ *   - trecho: Trecho procurado
+ * Retorna: Ponteiro para a primeira ocorrência em texto, ou NULL se não há
+ */
+const char* procurar_sem_caixa(const char* texto, const char* trecho);
+
+/**
+ * Hash de um texto ignorando maiúsculas/minúsculas ASCII, sem copiá-lo
+ * Igual a calcular_hash() do texto depois de para_minusculo().
+ * Parâmetros:
+ *   - texto: Texto a ser espalhado
+ * Retorna: Valor do hash
+ */
+unsigned int hash_sem_caixa(const char* texto);
+
+/**
+ * Continua um hash de hash_sem_caixa() com mais um texto (chaves compostas)
+ * Parâmetros:
+ *   - hash: Hash dos textos anteriores
+ *   - texto: Texto acrescentado à chave
+ * Retorna: Valor do hash
+ */
+unsigned int continuar_hash_sem_caixa(unsigned int hash, const char* texto);
+
+/**
+ * Escolhe a implementação das funções acima (chamada por inicializar_biblioteca())
+ * Deve ser chamada antes de qualquer varredura paralela, nunca durante uma.
+ * Parâmetros:
+ *   - implementacao: IMPLEMENTACAO_* (uma não suportada cai para a melhor suportada)
+ * Retorna: Implementação em uso
+ */
+int textos_escolher_implementacao(int implementacao);
+
+/**
+ * Nome de uma implementação ("escalar", "SSE2" ou "AVX2")
+ * Parâmetros:
+ *   - implementacao: IMPLEMENTACAO_*
+ * Retorna: Nome para exibição
+ */
+const char* textos_nome_implementacao(int implementacao);
+
+#endif // TEXTOS_H
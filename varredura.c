@@ -0,0 +1,337 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: varredura.c
+ * Descrição: Implementação da varredura paralela do catálogo
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#define _POSIX_C_SOURCE 200809L // pthreads e sysconf() com -std=c99
+
+#include "varredura.h"
+#include "visoes.h"
+#include <pthread.h>
+#include <unistd.h>
+
+// =============================================================================
+// ESTRUTURAS INTERNAS
+// =============================================================================
+
+/**
+ * Faixa de trechos [inicio, fim) ainda não avaliados de uma thread
+ * A dona tira trechos do início; quem rouba leva a metade do fim.
+ */
+typedef struct FaixaTrechos {
+    pthread_mutex_t trava;      // Protege inicio e fim
+    int inicio;                 // Próximo trecho da dona
+    int fim;                    // Depois do último trecho
+} FaixaTrechos;
+
+/**
+ * Livros encontrados em um trecho
+ */
+typedef struct TrechoResultado {
+    NoLivro** livros;           // Livros do trecho que satisfazem a condição
+    int total;                  // Quantidade de livros
+} TrechoResultado;
+
+/**
+ * Dados compartilhados por todas as threads de uma varredura
+ */
+typedef struct TrabalhoVarredura {
+    ListaLivros* lista;         // Catálogo varrido (só leitura)
+    PredicadoLivro predicado;   // Condição avaliada
+    const void* contexto;       // Dados do predicado
+    TrechoResultado* trechos;   // Resultado de cada trecho (cada um escrito por uma thread)
+    FaixaTrechos* faixas;       // Faixa de cada thread
+    int total_threads;          // Quantidade de faixas
+} TrabalhoVarredura;
+
+/**
+ * Uma thread da varredura
+ */
+typedef struct TrabalhadorVarredura {
+    TrabalhoVarredura* trabalho; // Dados compartilhados
+    int indice;                  // Faixa desta thread
+    bool falhou;                 // Faltou memória em algum trecho
+    pthread_t thread;            // Thread criada (as demais além da que chamou)
+    bool iniciado;               // pthread_create() funcionou
+} TrabalhadorVarredura;
+
+// =============================================================================
+// DISTRIBUIÇÃO DOS TRECHOS
+// =============================================================================
+
+/**
+ * Pega o próximo trecho da própria faixa ou rouba metade da faixa de outra thread
+ * Retorna: Trecho a avaliar, ou -1 se não restou nenhum
+ */
+static int pegar_trecho(TrabalhoVarredura* trabalho, int indice) {
+    FaixaTrechos* propria = &trabalho->faixas[indice];
+    int trecho = -1;
+
+    pthread_mutex_lock(&propria->trava);
+    if (propria->inicio < propria->fim) {
+        trecho = propria->inicio++;
+    }
+    pthread_mutex_unlock(&propria->trava);
+    if (trecho >= 0) {
+        return trecho;
+    }
+
+    // Faixa vazia: procura uma vítima a partir da vizinha
+    for (int k = 1; k < trabalho->total_threads; k++) {
+        FaixaTrechos* vitima = &trabalho->faixas[(indice + k) % trabalho->total_threads];
+        int inicio = 0;
+        int fim = 0;
+
+        pthread_mutex_lock(&vitima->trava);
+        int restantes = vitima->fim - vitima->inicio;
+        if (restantes > 0) {
+            fim = vitima->fim;
+            inicio = fim - (restantes + 1) / 2;
+            vitima->fim = inicio;
+        }
+        pthread_mutex_unlock(&vitima->trava);
+
+        if (fim > inicio) {
+            // O primeiro trecho roubado é avaliado agora; o resto vira a nova faixa
+            pthread_mutex_lock(&propria->trava);
+            propria->inicio = inicio + 1;
+            propria->fim = fim;
+            pthread_mutex_unlock(&propria->trava);
+            return inicio;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * Avalia a condição nos livros de um trecho
+ * Parâmetros:
+ *   - buffer: Espaço para LIVROS_POR_TRECHO livros
+ * Retorna: true se avaliado, false se faltou memória
+ */
+static bool avaliar_trecho(TrabalhoVarredura* trabalho, int trecho, NoLivro** buffer) {
+    int lidos = visao_pagina(trabalho->lista->visoes, ORDEM_TITULO, trecho * LIVROS_POR_TRECHO,
+                             buffer, LIVROS_POR_TRECHO);
+
+    // Os encontrados são compactados no início do próprio buffer
+    int encontrados = 0;
+    for (int i = 0; i < lidos; i++) {
+        if (trabalho->predicado(buffer[i], trabalho->contexto)) {
+            buffer[encontrados++] = buffer[i];
+        }
+    }
+
+    if (encontrados == 0) {
+        return true;
+    }
+
+    NoLivro** livros = (NoLivro**)malloc(encontrados * sizeof(NoLivro*));
+    if (livros == NULL) {
+        return false;
+    }
+    memcpy(livros, buffer, encontrados * sizeof(NoLivro*));
+
+    trabalho->trechos[trecho].livros = livros;
+    trabalho->trechos[trecho].total = encontrados;
+    return true;
+}
+
+/**
+ * Laço de uma thread: avalia trechos até não restar nenhum
+ */
+static void* executar_trabalhador(void* argumento) {
+    TrabalhadorVarredura* trabalhador = (TrabalhadorVarredura*)argumento;
+    TrabalhoVarredura* trabalho = trabalhador->trabalho;
+
+    NoLivro** buffer = (NoLivro**)malloc(LIVROS_POR_TRECHO * sizeof(NoLivro*));
+    if (buffer == NULL) {
+        // Os trechos desta faixa serão roubados pelas outras threads
+        trabalhador->falhou = true;
+        return NULL;
+    }
+
+    int trecho;
+    while ((trecho = pegar_trecho(trabalho, trabalhador->indice)) >= 0) {
+        if (!avaliar_trecho(trabalho, trecho, buffer)) {
+            trabalhador->falhou = true;
+        }
+    }
+
+    free(buffer);
+    return NULL;
+}
+
+// =============================================================================
+// FUNÇÕES DA VARREDURA
+// =============================================================================
+
+/**
+ * Quantidade de threads usada por padrão
+ */
+int varredura_threads_padrao() {
+    long processadores = 1;
+#ifdef _SC_NPROCESSORS_ONLN
+    processadores = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (processadores < 1) {
+        processadores = 1;
+    }
+    if (processadores > MAX_THREADS_VARREDURA) {
+        processadores = MAX_THREADS_VARREDURA;
+    }
+    return (int)processadores;
+}
+
+/**
+ * Junta os trechos na ordem das posições
+ */
+static bool juntar_trechos(TrechoResultado* trechos, int total_trechos, ResultadoVarredura* resultado) {
+    int total = 0;
+    for (int t = 0; t < total_trechos; t++) {
+        total += trechos[t].total;
+    }
+    if (total == 0) {
+        return true;
+    }
+
+    resultado->livros = (NoLivro**)malloc(total * sizeof(NoLivro*));
+    if (resultado->livros == NULL) {
+        return false;
+    }
+
+    for (int t = 0; t < total_trechos; t++) {
+        if (trechos[t].total > 0) {
+            memcpy(resultado->livros + resultado->total, trechos[t].livros,
+                   trechos[t].total * sizeof(NoLivro*));
+            resultado->total += trechos[t].total;
+        }
+    }
+    return true;
+}
+
+/**
+ * Avalia uma condição em todos os livros do catálogo
+ */
+bool varrer_catalogo(ListaLivros* lista, PredicadoLivro predicado, const void* contexto,
+                     int threads, ResultadoVarredura* resultado) {
+    if (resultado == NULL) {
+        return false;
+    }
+    resultado->livros = NULL;
+    resultado->total = 0;
+
+    if (lista == NULL || predicado == NULL) {
+        return false;
+    }
+    if (lista->total == 0) {
+        return true;
+    }
+
+    int total_trechos = (lista->total + LIVROS_POR_TRECHO - 1) / LIVROS_POR_TRECHO;
+    if (threads <= 0) {
+        threads = varredura_threads_padrao();
+    }
+    if (threads > MAX_THREADS_VARREDURA) {
+        threads = MAX_THREADS_VARREDURA;
+    }
+    if (threads > total_trechos) {
+        threads = total_trechos; // Catálogo pequeno: sem threads ociosas
+    }
+
+    TrechoResultado* trechos = (TrechoResultado*)calloc(total_trechos, sizeof(TrechoResultado));
+    FaixaTrechos* faixas = (FaixaTrechos*)malloc(threads * sizeof(FaixaTrechos));
+    TrabalhadorVarredura* trabalhadores =
+        (TrabalhadorVarredura*)malloc(threads * sizeof(TrabalhadorVarredura));
+    if (trechos == NULL || faixas == NULL || trabalhadores == NULL) {
+        free(trechos);
+        free(faixas);
+        free(trabalhadores);
+        return false;
+    }
+
+    TrabalhoVarredura trabalho;
+    trabalho.lista = lista;
+    trabalho.predicado = predicado;
+    trabalho.contexto = contexto;
+    trabalho.trechos = trechos;
+    trabalho.faixas = faixas;
+    trabalho.total_threads = threads;
+
+    // Faixas iniciais do mesmo tamanho; o roubo corrige o desequilíbrio
+    for (int i = 0; i < threads; i++) {
+        pthread_mutex_init(&faixas[i].trava, NULL);
+        faixas[i].inicio = (int)((long long)total_trechos * i / threads);
+        faixas[i].fim = (int)((long long)total_trechos * (i + 1) / threads);
+
+        trabalhadores[i].trabalho = &trabalho;
+        trabalhadores[i].indice = i;
+        trabalhadores[i].falhou = false;
+        trabalhadores[i].iniciado = false;
+    }
+
+    // A thread que chamou é a trabalhadora 0; se uma thread não puder ser
+    // criada, a faixa dela é roubada pelas outras
+    for (int i = 1; i < threads; i++) {
+        trabalhadores[i].iniciado =
+            pthread_create(&trabalhadores[i].thread, NULL, executar_trabalhador, &trabalhadores[i]) == 0;
+    }
+    executar_trabalhador(&trabalhadores[0]);
+
+    for (int i = 1; i < threads; i++) {
+        if (trabalhadores[i].iniciado) {
+            pthread_join(trabalhadores[i].thread, NULL);
+        }
+    }
+
+    // As travas só são destruídas depois que nenhuma thread pode mais roubar
+    bool sucesso = true;
+    for (int i = 0; i < threads; i++) {
+        if (trabalhadores[i].falhou) {
+            sucesso = false;
+        }
+        pthread_mutex_destroy(&faixas[i].trava);
+    }
+
+    // Trechos que sobraram: a trabalhadora 0 não conseguiu o buffer e nenhuma
+    // outra thread existia para roubá-los
+    for (int i = 0; i < threads && sucesso; i++) {
+        if (faixas[i].inicio < faixas[i].fim) {
+            sucesso = false;
+        }
+    }
+
+    if (sucesso) {
+        sucesso = juntar_trechos(trechos, total_trechos, resultado);
+    }
+    if (!sucesso) {
+        free(resultado->livros);
+        resultado->livros = NULL;
+        resultado->total = 0;
+    }
+
+    for (int t = 0; t < total_trechos; t++) {
+        free(trechos[t].livros);
+    }
+    free(trechos);
+    free(faixas);
+    free(trabalhadores);
+    return sucesso;
+}
+
+/**
+ * Libera o vetor de um resultado
+ */
+void liberar_resultado_varredura(ResultadoVarredura* resultado) {
+    if (resultado == NULL) return;
+
+    free(resultado->livros);
+    resultado->livros = NULL;
+    resultado->total = 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: varredura.h
+ * Descrição: Varredura paralela do catálogo para consultas sem índice
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef VARREDURA_H
+#define VARREDURA_H
+
+#include "biblioteca.h"
+
+// =============================================================================
+// CONSTANTES DA VARREDURA
+// =============================================================================
+
+#define LIVROS_POR_TRECHO 4096      // Livros consecutivos avaliados de uma vez por uma thread
+#define MAX_THREADS_VARREDURA 64    // Limite de threads de uma varredura
+
+// =============================================================================
+// VARREDURA PARALELA
+// =============================================================================
+
+/**
+ * Condição avaliada em cada livro
+ * Roda ao mesmo tempo em várias threads: só pode ler o livro e o contexto.
+ * Parâmetros:
+ *   - livro: Livro avaliado
+ *   - contexto: Dados da consulta (ex.: trecho do autor procurado)
+ * Retorna: true se o livro faz parte do resultado
+ */
+typedef bool (*PredicadoLivro)(const NoLivro* livro, const void* contexto);
+
+/**
+ * Livros que satisfizeram uma varredura, em ordem alfabética de título
+ */
+typedef struct ResultadoVarredura {
+    NoLivro** livros;           // Livros encontrados (NULL se nenhum)
+    int total;                  // Quantidade de livros encontrados
+} ResultadoVarredura;
+
+/**
+ * Avalia uma condição em todos os livros do catálogo
+ * O catálogo é dividido em trechos de LIVROS_POR_TRECHO posições consecutivas da
+ * ordem por título (cada trecho começa com uma busca O(log n) na skip list).
+ * Cada thread recebe uma faixa de trechos e, quando termina a sua, rouba metade
+ * da faixa restante de outra thread. Os trechos são juntados na ordem das
+ * posições, então o resultado não depende de qual thread avaliou cada trecho.
+ * O catálogo não pode ser alterado durante a varredura.
+ * Parâmetros:
+ *   - lista: Ponteiro para a lista de livros
+ *   - predicado: Condição avaliada em cada livro
+ *   - contexto: Dados repassados ao predicado
+ *   - threads: Quantidade de threads (0 = uma por processador)
+ *   - resultado: Recebe os livros encontrados (liberar com liberar_resultado_varredura())
+ * Retorna: true se concluída, false se faltou memória (resultado fica vazio)
+ */
+bool varrer_catalogo(ListaLivros* lista, PredicadoLivro predicado, const void* contexto,
+                     int threads, ResultadoVarredura* resultado);
+
+/**
+ * Quantidade de threads usada por padrão (uma por processador)
+ * Retorna: Número de processadores disponíveis, entre 1 e MAX_THREADS_VARREDURA
+ */
+int varredura_threads_padrao();
+
+/**
+ * Libera o vetor de um resultado (os livros pertencem ao catálogo)
+ * Parâmetros:
+ *   - resultado: Resultado a ser liberado
+ */
+void liberar_resultado_varredura(ResultadoVarredura* resultado);
+
+#endif // VARREDURA_H
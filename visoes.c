@@ -0,0 +1,419 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: visoes.c
+ * Descrição: Implementação das visões ordenadas do catálogo (skip lists indexáveis)
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#include "visoes.h"
+
+// =============================================================================
+// FUNÇÕES AUXILIARES
+// =============================================================================
+
+/**
+ * Compara dois textos ignorando maiúsculas/minúsculas (mesma ordem de para_minusculo + strcmp)
+ */
+static int comparar_sem_caixa(const char* a, const char* b) {
+    while (*a != '\0' && tolower((unsigned char)*a) == tolower((unsigned char)*b)) {
+        a++;
+        b++;
+    }
+    return tolower((unsigned char)*a) - tolower((unsigned char)*b);
+}
+
+/**
+ * Compara a posição de um livro na ordem com uma chave
+ * Retorna: < 0 se o livro vem antes da chave, 0 se é a chave, > 0 se vem depois
+ */
+static int comparar_com_chave(int ordem, const NoLivro* livro, const ChaveVisao* chave) {
+    int resultado;
+
+    if (ordem == ORDEM_AUTOR) {
+        resultado = comparar_sem_caixa(livro->dados.autor, chave->texto);
+    } else if (ordem == ORDEM_ANO) {
+        resultado = (livro->dados.ano_publicacao > chave->ano) -
+                    (livro->dados.ano_publicacao < chave->ano);
+    } else {
+        resultado = strcmp(livro->titulo_busca, chave->texto);
+    }
+
+    if (resultado != 0) {
+        return resultado;
+    }
+
+    // Títulos são únicos no catálogo: o desempate separa quaisquer dois livros
+    return strcmp(livro->titulo_busca, chave->titulo_busca);
+}
+
+/**
+ * Monta a chave de um livro em uma ordem
+ */
+static void chave_do_livro(int ordem, const NoLivro* livro, ChaveVisao* chave) {
+    if (ordem == ORDEM_AUTOR) {
+        para_minusculo(chave->texto, livro->dados.autor);
+    } else if (ordem == ORDEM_ANO) {
+        strcpy(chave->texto, "");
+    } else {
+        strcpy(chave->texto, livro->titulo_busca);
+    }
+    chave->ano = livro->dados.ano_publicacao;
+    strcpy(chave->titulo_busca, livro->titulo_busca);
+}
+
+/**
+ * Sorteia a quantidade de níveis de um novo nó (cada nível extra com chance 1/4)
+ */
+static int sortear_niveis(VisoesOrdenadas* visoes) {
+    int niveis = 1;
+
+    while (niveis < MAX_NIVEIS_VISAO) {
+        // xorshift32: rápido e sem interferir no rand() do restante do programa
+        unsigned int x = visoes->semente;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        visoes->semente = x;
+
+        if ((x & 3) != 0) {
+            break;
+        }
+        niveis++;
+    }
+    return niveis;
+}
+
+/**
+ * Aloca um nó da skip list com a quantidade de níveis informada
+ */
+static NoVisao* criar_no_visao(NoLivro* livro, int niveis) {
+    NoVisao* no = (NoVisao*)malloc(sizeof(NoVisao) + niveis * sizeof(NivelVisao));
+    if (no == NULL) {
+        return NULL;
+    }
+
+    no->livro = livro;
+    no->niveis = niveis;
+    for (int i = 0; i < niveis; i++) {
+        no->nivel[i].proximo = NULL;
+        no->nivel[i].largura = 0;
+    }
+    return no;
+}
+
+// =============================================================================
+// OPERAÇÕES DE UMA SKIP LIST
+// =============================================================================
+
+/**
+ * Insere um nó já alocado na posição da sua chave
+ */
+static void inserir_no(VisaoOrdenada* visao, NoVisao* novo) {
+    NoVisao* anteriores[MAX_NIVEIS_VISAO];
+    int posicoes[MAX_NIVEIS_VISAO]; // Posição (contando a sentinela como 0) de cada anterior
+    ChaveVisao chave;
+    chave_do_livro(visao->ordem, novo->livro, &chave);
+
+    // Desce pelos níveis somando as larguras percorridas
+    NoVisao* atual = visao->cabeca;
+    for (int i = visao->niveis - 1; i >= 0; i--) {
+        posicoes[i] = (i == visao->niveis - 1) ? 0 : posicoes[i + 1];
+        while (atual->nivel[i].proximo != NULL &&
+               comparar_com_chave(visao->ordem, atual->nivel[i].proximo->livro, &chave) < 0) {
+            posicoes[i] += atual->nivel[i].largura;
+            atual = atual->nivel[i].proximo;
+        }
+        anteriores[i] = atual;
+    }
+
+    // Níveis novos partem da sentinela, que pula a lista inteira
+    if (novo->niveis > visao->niveis) {
+        for (int i = visao->niveis; i < novo->niveis; i++) {
+            posicoes[i] = 0;
+            anteriores[i] = visao->cabeca;
+            visao->cabeca->nivel[i].proximo = NULL;
+            visao->cabeca->nivel[i].largura = visao->total;
+        }
+        visao->niveis = novo->niveis;
+    }
+
+    // Encadeia o nó e divide as larguras dos ponteiros que passavam por cima dele
+    for (int i = 0; i < novo->niveis; i++) {
+        int distancia = posicoes[0] - posicoes[i];
+        novo->nivel[i].proximo = anteriores[i]->nivel[i].proximo;
+        anteriores[i]->nivel[i].proximo = novo;
+        novo->nivel[i].largura = anteriores[i]->nivel[i].largura - distancia;
+        anteriores[i]->nivel[i].largura = distancia + 1;
+    }
+
+    // Os níveis acima do nó agora pulam um livro a mais
+    for (int i = novo->niveis; i < visao->niveis; i++) {
+        anteriores[i]->nivel[i].largura++;
+    }
+
+    visao->total++;
+}
+
+/**
+ * Desencadeia o nó de um livro
+ * Retorna: O nó retirado (para ser liberado), ou NULL se o livro não está na visão
+ */
+static NoVisao* retirar_no(VisaoOrdenada* visao, NoLivro* livro) {
+    NoVisao* anteriores[MAX_NIVEIS_VISAO] = {NULL}; // Só os visao->niveis primeiros são usados
+    ChaveVisao chave;
+    chave_do_livro(visao->ordem, livro, &chave);
+
+    NoVisao* atual = visao->cabeca;
+    for (int i = visao->niveis - 1; i >= 0; i--) {
+        while (atual->nivel[i].proximo != NULL &&
+               comparar_com_chave(visao->ordem, atual->nivel[i].proximo->livro, &chave) < 0) {
+            atual = atual->nivel[i].proximo;
+        }
+        anteriores[i] = atual;
+    }
+
+    NoVisao* alvo = anteriores[0]->nivel[0].proximo;
+    if (alvo == NULL || alvo->livro != livro) {
+        return NULL;
+    }
+
+    for (int i = 0; i < visao->niveis; i++) {
+        if (anteriores[i]->nivel[i].proximo == alvo) {
+            anteriores[i]->nivel[i].largura += alvo->nivel[i].largura - 1;
+            anteriores[i]->nivel[i].proximo = alvo->nivel[i].proximo;
+        } else {
+            anteriores[i]->nivel[i].largura--;
+        }
+    }
+
+    // Descarta os níveis que ficaram vazios
+    while (visao->niveis > 1 && visao->cabeca->nivel[visao->niveis - 1].proximo == NULL) {
+        visao->niveis--;
+    }
+
+    visao->total--;
+    return alvo;
+}
+
+/**
+ * Busca o nó de uma posição (0 = primeiro) usando as larguras
+ */
+static NoVisao* no_na_posicao(VisaoOrdenada* visao, int posicao) {
+    int alvo = posicao + 1; // A sentinela ocupa a posição 0
+    int percorridos = 0;
+    NoVisao* atual = visao->cabeca;
+
+    for (int i = visao->niveis - 1; i >= 0; i--) {
+        while (atual->nivel[i].proximo != NULL && percorridos + atual->nivel[i].largura <= alvo) {
+            percorridos += atual->nivel[i].largura;
+            atual = atual->nivel[i].proximo;
+        }
+        if (percorridos == alvo) {
+            return atual;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Busca o primeiro nó depois de uma chave
+ * Parâmetros:
+ *   - posicao: Recebe a posição (0 = primeiro) do nó encontrado
+ */
+static NoVisao* primeiro_depois(VisaoOrdenada* visao, const ChaveVisao* chave, int* posicao) {
+    int percorridos = 0;
+    NoVisao* atual = visao->cabeca;
+
+    for (int i = visao->niveis - 1; i >= 0; i--) {
+        while (atual->nivel[i].proximo != NULL &&
+               comparar_com_chave(visao->ordem, atual->nivel[i].proximo->livro, chave) <= 0) {
+            percorridos += atual->nivel[i].largura;
+            atual = atual->nivel[i].proximo;
+        }
+    }
+
+    *posicao = percorridos;
+    return atual->nivel[0].proximo;
+}
+
+// =============================================================================
+// FUNÇÕES DAS VISÕES ORDENADAS
+// =============================================================================
+
+/**
+ * Cria as visões ordenadas vazias
+ */
+VisoesOrdenadas* criar_visoes_ordenadas() {
+    VisoesOrdenadas* visoes = (VisoesOrdenadas*)malloc(sizeof(VisoesOrdenadas));
+    if (visoes == NULL) {
+        return NULL;
+    }
+
+    for (int ordem = 0; ordem < TOTAL_ORDENS; ordem++) {
+        VisaoOrdenada* visao = &visoes->visoes[ordem];
+        visao->ordem = ordem;
+        visao->niveis = 1;
+        visao->total = 0;
+        visao->cabeca = criar_no_visao(NULL, MAX_NIVEIS_VISAO);
+
+        if (visao->cabeca == NULL) {
+            for (int i = 0; i < ordem; i++) {
+                free(visoes->visoes[i].cabeca);
+            }
+            free(visoes);
+            return NULL;
+        }
+    }
+
+    visoes->semente = 2463534242u;
+    return visoes;
+}
+
+/**
+ * Insere um livro em todas as visões
+ */
+bool visoes_adicionar(VisoesOrdenadas* visoes, NoLivro* livro) {
+    if (visoes == NULL || livro == NULL) {
+        return false;
+    }
+
+    // Aloca os nós de todas as visões antes de inserir (tudo ou nada)
+    NoVisao* nos[TOTAL_ORDENS];
+    for (int ordem = 0; ordem < TOTAL_ORDENS; ordem++) {
+        nos[ordem] = criar_no_visao(livro, sortear_niveis(visoes));
+        if (nos[ordem] == NULL) {
+            for (int i = 0; i < ordem; i++) {
+                free(nos[i]);
+            }
+            return false;
+        }
+    }
+
+    for (int ordem = 0; ordem < TOTAL_ORDENS; ordem++) {
+        inserir_no(&visoes->visoes[ordem], nos[ordem]);
+    }
+    return true;
+}
+
+/**
+ * Retira um livro de todas as visões
+ */
+void visoes_remover(VisoesOrdenadas* visoes, NoLivro* livro) {
+    if (visoes == NULL || livro == NULL) return;
+
+    for (int ordem = 0; ordem < TOTAL_ORDENS; ordem++) {
+        free(retirar_no(&visoes->visoes[ordem], livro));
+    }
+}
+
+/**
+ * Copia uma página de livros a partir de uma posição da ordem
+ */
+int visao_pagina(VisoesOrdenadas* visoes, int ordem, int inicio, NoLivro** saida, int max) {
+    if (visoes == NULL || saida == NULL || ordem < 0 || ordem >= TOTAL_ORDENS || inicio < 0) {
+        return 0;
+    }
+
+    NoVisao* atual = no_na_posicao(&visoes->visoes[ordem], inicio);
+    int copiados = 0;
+
+    while (atual != NULL && copiados < max) {
+        saida[copiados++] = atual->livro;
+        atual = atual->nivel[0].proximo;
+    }
+    return copiados;
+}
+
+/**
+ * Posiciona um cursor no início de uma ordem
+ */
+void visao_cursor_iniciar(CursorVisao* cursor, int ordem) {
+    if (cursor == NULL) return;
+
+    cursor->ordem = (ordem >= 0 && ordem < TOTAL_ORDENS) ? ordem : ORDEM_TITULO;
+    cursor->iniciado = false;
+}
+
+/**
+ * Posiciona um cursor logo antes do primeiro livro com campo principal >= chave
+ */
+void visao_cursor_buscar(CursorVisao* cursor, int ordem, const char* texto, int ano) {
+    if (cursor == NULL) return;
+
+    visao_cursor_iniciar(cursor, ordem);
+    cursor->iniciado = true;
+
+    // O desempate vazio vem antes de qualquer título com o mesmo campo principal
+    char texto_limitado[MAX_TITULO];
+    strncpy(texto_limitado, texto != NULL ? texto : "", MAX_TITULO - 1);
+    texto_limitado[MAX_TITULO - 1] = '\0';
+    para_minusculo(cursor->ultima.texto, texto_limitado);
+    cursor->ultima.ano = ano;
+    strcpy(cursor->ultima.titulo_busca, "");
+}
+
+/**
+ * Copia a próxima página de um cursor e avança o cursor
+ */
+int visao_proxima_pagina(VisoesOrdenadas* visoes, CursorVisao* cursor, NoLivro** saida, int max) {
+    if (visoes == NULL || cursor == NULL || saida == NULL) {
+        return 0;
+    }
+
+    VisaoOrdenada* visao = &visoes->visoes[cursor->ordem];
+    NoVisao* atual;
+    if (cursor->iniciado) {
+        int posicao;
+        atual = primeiro_depois(visao, &cursor->ultima, &posicao);
+    } else {
+        atual = visao->cabeca->nivel[0].proximo;
+    }
+
+    int copiados = 0;
+    while (atual != NULL && copiados < max) {
+        saida[copiados++] = atual->livro;
+        atual = atual->nivel[0].proximo;
+    }
+
+    // O cursor guarda a chave do último livro entregue
+    if (copiados > 0) {
+        chave_do_livro(cursor->ordem, saida[copiados - 1], &cursor->ultima);
+        cursor->iniciado = true;
+    }
+    return copiados;
+}
+
+/**
+ * Posição do primeiro livro depois do cursor
+ */
+int visao_posicao_cursor(VisoesOrdenadas* visoes, const CursorVisao* cursor) {
+    if (visoes == NULL || cursor == NULL || !cursor->iniciado) {
+        return 0;
+    }
+
+    int posicao;
+    primeiro_depois(&visoes->visoes[cursor->ordem], &cursor->ultima, &posicao);
+    return posicao;
+}
+
+/**
+ * Libera toda a memória das visões
+ */
+void liberar_visoes_ordenadas(VisoesOrdenadas* visoes) {
+    if (visoes == NULL) return;
+
+    for (int ordem = 0; ordem < TOTAL_ORDENS; ordem++) {
+        NoVisao* atual = visoes->visoes[ordem].cabeca;
+        while (atual != NULL) {
+            NoVisao* proximo = atual->nivel[0].proximo;
+            free(atual);
+            atual = proximo;
+        }
+    }
+
+    free(visoes);
+}
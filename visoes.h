@@ -0,0 +1,170 @@
+/**
+ * =============================================================================
+ * SISTEMA DE GERENCIAMENTO DE BIBLIOTECA
+ * =============================================================================
+ * Arquivo: visoes.h
+ * Descrição: Visões ordenadas do catálogo (por título, autor e ano) com paginação
+ * Autores: [INSIRA NOMES DA EQUIPE]
+ * Data: Outubro 2025
+ * =============================================================================
+ */
+
+#ifndef VISOES_H
+#define VISOES_H
+
+#include "biblioteca.h"
+
+// =============================================================================
+// CONSTANTES DAS VISÕES ORDENADAS
+// =============================================================================
+
+#define ORDEM_TITULO 0              // Ordem alfabética de título
+#define ORDEM_AUTOR 1               // Ordem alfabética de autor (depois título)
+#define ORDEM_ANO 2                 // Ano de publicação (depois título)
+#define TOTAL_ORDENS 3              // Quantidade de visões mantidas
+#define MAX_NIVEIS_VISAO 32         // Níveis da skip list (suficiente para 4^32 livros)
+
+// =============================================================================
+// SKIP LIST INDEXÁVEL
+// =============================================================================
+
+/**
+ * Um nível de um nó da skip list
+ * A largura é quantos livros o ponteiro pula no nível de baixo; somando as
+ * larguras do caminho de uma busca obtém-se a posição do livro na ordem.
+ */
+typedef struct NivelVisao {
+    struct NoVisao* proximo;    // Próximo nó neste nível
+    int largura;                // Livros pulados por este ponteiro
+} NivelVisao;
+
+/**
+ * Nó da skip list (um por livro em cada visão)
+ */
+typedef struct NoVisao {
+    NoLivro* livro;             // Livro do catálogo
+    int niveis;                 // Quantidade de níveis deste nó
+    NivelVisao nivel[];         // Ponteiros de cada nível
+} NoVisao;
+
+/**
+ * Uma ordem do catálogo mantida em uma skip list indexável
+ * Inserir, remover, buscar por chave e buscar por posição custam O(log n).
+ */
+typedef struct VisaoOrdenada {
+    int ordem;                  // ORDEM_TITULO, ORDEM_AUTOR ou ORDEM_ANO
+    NoVisao* cabeca;            // Nó sentinela com MAX_NIVEIS_VISAO níveis
+    int niveis;                 // Maior nível em uso
+    int total;                  // Livros na visão
+} VisaoOrdenada;
+
+/**
+ * Conjunto das visões ordenadas do catálogo
+ */
+typedef struct VisoesOrdenadas {
+    VisaoOrdenada visoes[TOTAL_ORDENS]; // Uma skip list por ordem
+    unsigned int semente;               // Estado do sorteio de níveis
+} VisoesOrdenadas;
+
+/**
+ * Chave de uma posição na ordem: campo principal e título como desempate
+ */
+typedef struct ChaveVisao {
+    char texto[MAX_TITULO];             // Título ou autor (ignorado na ordem por ano)
+    int ano;                            // Ano (só na ordem por ano)
+    char titulo_busca[MAX_TITULO];      // Desempate ("" = antes de qualquer título)
+} ChaveVisao;
+
+/**
+ * Cursor de paginação
+ * Guarda a chave do último livro entregue, não um ponteiro: continua válido
+ * depois de inserções e remoções, e cada página recomeça com uma busca O(log n).
+ */
+typedef struct CursorVisao {
+    int ordem;                  // Ordem percorrida
+    bool iniciado;              // false = ainda no início da ordem
+    ChaveVisao ultima;          // Chave do último livro entregue
+} CursorVisao;
+
+/**
+ * Cria as visões ordenadas vazias
+ * Retorna: Ponteiro para as visões criadas, ou NULL em caso de erro
+ */
+VisoesOrdenadas* criar_visoes_ordenadas();
+
+/**
+ * Insere um livro em todas as visões
+ * Parâmetros:
+ *   - visoes: Ponteiro para as visões
+ *   - livro: Nó do livro (título, autor e ano já preenchidos)
+ * Retorna: true se inserido, false se faltou memória (nenhuma visão é alterada)
+ */
+bool visoes_adicionar(VisoesOrdenadas* visoes, NoLivro* livro);
+
+/**
+ * Retira um livro de todas as visões
+ * Parâmetros:
+ *   - visoes: Ponteiro para as visões
+ *   - livro: Nó do livro
+ */
+void visoes_remover(VisoesOrdenadas* visoes, NoLivro* livro);
+
+/**
+ * Copia uma página de livros a partir de uma posição da ordem
+ * Custa O(log n + max): a posição inicial é encontrada pelas larguras da skip list.
+ * Parâmetros:
+ *   - visoes: Ponteiro para as visões
+ *   - ordem: ORDEM_TITULO, ORDEM_AUTOR ou ORDEM_ANO
+ *   - inicio: Posição do primeiro livro da página (0 = primeiro)
+ *   - saida: Vetor que receberá os livros
+ *   - max: Tamanho do vetor
+ * Retorna: Quantidade de livros colocados no vetor
+ */
+int visao_pagina(VisoesOrdenadas* visoes, int ordem, int inicio, NoLivro** saida, int max);
+
+/**
+ * Posiciona um cursor no início de uma ordem
+ * Parâmetros:
+ *   - cursor: Cursor a ser posicionado
+ *   - ordem: ORDEM_TITULO, ORDEM_AUTOR ou ORDEM_ANO
+ */
+void visao_cursor_iniciar(CursorVisao* cursor, int ordem);
+
+/**
+ * Posiciona um cursor logo antes do primeiro livro com campo principal >= chave
+ * Parâmetros:
+ *   - cursor: Cursor a ser posicionado
+ *   - ordem: ORDEM_TITULO, ORDEM_AUTOR ou ORDEM_ANO
+ *   - texto: Título ou autor (qualquer capitalização; ignorado na ordem por ano)
+ *   - ano: Ano (só na ordem por ano)
+ */
+void visao_cursor_buscar(CursorVisao* cursor, int ordem, const char* texto, int ano);
+
+/**
+ * Copia a próxima página de um cursor e avança o cursor
+ * Parâmetros:
+ *   - visoes: Ponteiro para as visões
+ *   - cursor: Cursor (atualizado para depois do último livro copiado)
+ *   - saida: Vetor que receberá os livros
+ *   - max: Tamanho do vetor
+ * Retorna: Quantidade de livros colocados no vetor (0 = fim da ordem)
+ */
+int visao_proxima_pagina(VisoesOrdenadas* visoes, CursorVisao* cursor, NoLivro** saida, int max);
+
+/**
+ * Posição (0 = primeiro) do primeiro livro depois do cursor
+ * Parâmetros:
+ *   - visoes: Ponteiro para as visões
+ *   - cursor: Cursor
+ * Retorna: Posição na ordem (igual ao total se o cursor está no fim)
+ */
+int visao_posicao_cursor(VisoesOrdenadas* visoes, const CursorVisao* cursor);
+
+/**
+ * Libera toda a memória das visões (os nós de livros não são liberados)
+ * Parâmetros:
+ *   - visoes: Ponteiro para as visões a serem liberadas
+ */
+void liberar_visoes_ordenadas(VisoesOrdenadas* visoes);
+
+#endif // VISOES_H